@@ -0,0 +1,119 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "hystart.hpp"
+
+namespace ndn {
+
+HyStart::HyStart(const Options& options)
+  : m_options(options)
+  , m_minRtt(time::nanoseconds::max())
+  , m_isInRound(false)
+  , m_roundEnd(0)
+  , m_roundMinRtt(time::nanoseconds::max())
+  , m_nRoundSamples(0)
+  , m_lastExit(NONE)
+  , m_exitWindow(0)
+{
+}
+
+void
+HyStart::reset()
+{
+  m_isInRound = false;
+}
+
+void
+HyStart::startRound(time::steady_clock::TimePoint now, uint64_t highSent)
+{
+  m_isInRound = true;
+  m_roundEnd = highSent;
+  m_roundStart = m_lastTrainData = now;
+  m_roundMinRtt = time::nanoseconds::max();
+  m_nRoundSamples = 0;
+}
+
+bool
+HyStart::exit(Exit reason, double cwnd)
+{
+  m_lastExit = reason;
+  m_exitWindow = cwnd;
+  m_isInRound = false;
+  return true;
+}
+
+bool
+HyStart::onData(time::steady_clock::TimePoint now, uint64_t seq, uint64_t highSent,
+                time::nanoseconds rtt, double cwnd)
+{
+  m_minRtt = std::min(m_minRtt, rtt);
+  if (!m_isInRound || seq > m_roundEnd) {
+    startRound(now, highSent);
+  }
+  if (cwnd < m_options.lowWindow) {
+    return false;
+  }
+
+  if (m_options.detectAckTrain && now - m_lastTrainData <= m_options.ackDelta) {
+    m_lastTrainData = now;
+    if (now - m_roundStart > m_minRtt / 2) {
+      return exit(ACK_TRAIN, cwnd);
+    }
+  }
+
+  if (m_options.detectDelay) {
+    if (m_nRoundSamples < m_options.nRoundSamples) {
+      m_roundMinRtt = std::min(m_roundMinRtt, rtt);
+      ++m_nRoundSamples;
+    }
+    else {
+      auto threshold = std::min(std::max(m_minRtt / 8, m_options.minDelayThreshold),
+                                m_options.maxDelayThreshold);
+      if (m_roundMinRtt > m_minRtt + threshold) {
+        return exit(DELAY_INCREASE, cwnd);
+      }
+    }
+  }
+  return false;
+}
+
+std::ostream&
+operator<<(std::ostream& os, HyStart::Exit exit)
+{
+  switch (exit) {
+  case HyStart::NONE:
+    os << "none";
+    break;
+  case HyStart::ACK_TRAIN:
+    os << "ACK train";
+    break;
+  case HyStart::DELAY_INCREASE:
+    os << "delay increase";
+    break;
+  }
+  return os;
+}
+
+} // namespace ndn
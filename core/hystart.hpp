@@ -0,0 +1,142 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NDN_TOOLS_CORE_HYSTART_HPP
+#define NDN_TOOLS_CORE_HYSTART_HPP
+
+#include "common.hpp"
+
+namespace ndn {
+
+/**
+ * \brief Delay-based slow start exit (HyStart)
+ *
+ * Ends slow start near the bandwidth-delay product instead of at the first loss or congestion
+ * mark, following the HyStart of Linux TCP CUBIC. The Data of a window are grouped in rounds;
+ * a round ends with the Data of the highest sequence number requested when it started. Slow
+ * start ends when either
+ *  - ACK train: the Data of the current round keep arriving closely spaced for longer than
+ *    half the minimum RTT, i.e. the window already fills the path, or
+ *  - delay increase: the minimum RTT of the first samples of the round exceeds the minimum
+ *    RTT of the path by a threshold, i.e. a queue is building up.
+ *
+ * Both detections only run once the window reaches Options::lowWindow.
+ */
+class HyStart
+{
+public:
+  struct Options
+  {
+    bool detectAckTrain = true;
+    bool detectDelay = true;
+    double lowWindow = 16; ///< window below which slow start is never ended
+    size_t nRoundSamples = 8; ///< RTT samples of a round compared against the minimum RTT
+    time::nanoseconds ackDelta = 2_ms; ///< maximum spacing of the Data of an ACK train
+    time::nanoseconds minDelayThreshold = 4_ms; ///< lower bound of the delay increase threshold
+    time::nanoseconds maxDelayThreshold = 16_ms; ///< upper bound of the delay increase threshold
+  };
+
+  enum Exit {
+    NONE,
+    ACK_TRAIN,
+    DELAY_INCREASE,
+  };
+
+  explicit
+  HyStart(const Options& options);
+
+  /**
+   * \brief Processes a Data received in slow start
+   * \param now arrival time of the Data
+   * \param seq sequence number of the Data
+   * \param highSent highest sequence number requested so far
+   * \param rtt RTT sample of the Data, which must not answer a retransmitted Interest
+   * \param cwnd current window
+   * \return whether slow start should end at the current window
+   */
+  bool
+  onData(time::steady_clock::TimePoint now, uint64_t seq, uint64_t highSent,
+         time::nanoseconds rtt, double cwnd);
+
+  /**
+   * \brief Starts a new round with the next Data, keeping the minimum RTT
+   *
+   * To be called when slow start resumes after a window decrease.
+   */
+  void
+  reset();
+
+  /**
+   * \brief Returns what ended slow start last, NONE if nothing did yet
+   */
+  Exit
+  getLastExit() const
+  {
+    return m_lastExit;
+  }
+
+  /**
+   * \brief Returns the window at which slow start ended last
+   */
+  double
+  getExitWindow() const
+  {
+    return m_exitWindow;
+  }
+
+  time::nanoseconds
+  getMinRtt() const
+  {
+    return m_minRtt;
+  }
+
+private:
+  void
+  startRound(time::steady_clock::TimePoint now, uint64_t highSent);
+
+  bool
+  exit(Exit reason, double cwnd);
+
+private:
+  const Options m_options;
+  time::nanoseconds m_minRtt;
+
+  bool m_isInRound;
+  uint64_t m_roundEnd; ///< sequence number whose Data ends the round
+  time::steady_clock::TimePoint m_roundStart;
+  time::steady_clock::TimePoint m_lastTrainData; ///< arrival of the last Data of the ACK train
+  time::nanoseconds m_roundMinRtt;
+  size_t m_nRoundSamples;
+
+  Exit m_lastExit;
+  double m_exitWindow;
+};
+
+std::ostream&
+operator<<(std::ostream& os, HyStart::Exit exit);
+
+} // namespace ndn
+
+#endif // NDN_TOOLS_CORE_HYSTART_HPP
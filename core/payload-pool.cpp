@@ -0,0 +1,109 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "payload-pool.hpp"
+
+#include <algorithm>
+
+namespace ndn {
+
+PayloadPool::PayloadPool(size_t maxSize)
+  : m_maxSize(maxSize)
+  , m_footprint(0)
+{
+}
+
+const Block&
+PayloadPool::getFilled(size_t size, uint8_t fill)
+{
+  size = std::min(size, m_maxSize);
+  uint64_t key = (static_cast<uint64_t>(size) << 8) | fill;
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto it = m_filled.find(key);
+  if (it != m_filled.end()) {
+    return it->second;
+  }
+
+  auto buffer = make_shared<Buffer>();
+  buffer->assign(size, fill);
+  Block block(tlv::Content, std::move(buffer));
+  m_footprint += block.size();
+  return m_filled.emplace(key, std::move(block)).first->second;
+}
+
+static uint64_t
+hashValue(const uint8_t* begin, const uint8_t* end)
+{
+  // FNV-1a
+  uint64_t hash = 14695981039346656037ULL;
+  for (auto pos = begin; pos != end; ++pos) {
+    hash = (hash ^ *pos) * 1099511628211ULL;
+  }
+  return hash;
+}
+
+const Block&
+PayloadPool::intern(const ConstBufferPtr& content)
+{
+  uint64_t key = hashValue(content->data(), content->data() + content->size());
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto range = m_interned.equal_range(key);
+  for (auto it = range.first; it != range.second; ++it) {
+    const Block& block = it->second;
+    if (block.value_size() == content->size() &&
+        std::equal(block.value_begin(), block.value_end(), content->begin())) {
+      return block;
+    }
+  }
+
+  Block block(tlv::Content, content);
+  m_footprint += block.size();
+  return m_interned.emplace(key, std::move(block))->second;
+}
+
+size_t
+PayloadPool::size() const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_filled.size() + m_interned.size();
+}
+
+size_t
+PayloadPool::getFootprint() const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_footprint;
+}
+
+PayloadPool&
+getPayloadPool()
+{
+  static PayloadPool pool;
+  return pool;
+}
+
+} // namespace ndn
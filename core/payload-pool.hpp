@@ -0,0 +1,105 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NDN_TOOLS_CORE_PAYLOAD_POOL_HPP
+#define NDN_TOOLS_CORE_PAYLOAD_POOL_HPP
+
+#include "common.hpp"
+
+#include <mutex>
+#include <unordered_map>
+
+namespace ndn {
+
+/**
+ * \brief Process-wide store of immutable Content blocks
+ *
+ * Producers that serve the same bytes over and over (ping server, cc producer) take their
+ * Content from the pool instead of building their own copy, so every producer and every
+ * Data packet built from the same content refers to a single buffer.
+ *
+ * Blocks are never released before the pool, so references returned by the pool stay valid.
+ * All member functions are thread-safe.
+ */
+class PayloadPool : noncopyable
+{
+public:
+  /**
+   * \param maxSize sizes above this are clamped to it
+   */
+  explicit
+  PayloadPool(size_t maxSize = MAX_NDN_PACKET_SIZE);
+
+  /**
+   * \brief Returns a Content block whose value is \p size octets of \p fill
+   *
+   * \p size is clamped to getMaxSize().
+   */
+  const Block&
+  getFilled(size_t size, uint8_t fill = 'a');
+
+  /**
+   * \brief Returns a Content block whose value is \p content
+   *
+   * Interning the same bytes twice returns the same block.
+   */
+  const Block&
+  intern(const ConstBufferPtr& content);
+
+  size_t
+  getMaxSize() const
+  {
+    return m_maxSize;
+  }
+
+  /**
+   * \brief Returns the number of distinct blocks in the pool
+   */
+  size_t
+  size() const;
+
+  /**
+   * \brief Returns the number of octets held by the blocks of the pool
+   */
+  size_t
+  getFootprint() const;
+
+private:
+  const size_t m_maxSize;
+  mutable std::mutex m_mutex;
+  std::unordered_map<uint64_t, Block> m_filled; ///< filled blocks keyed by (size << 8 | fill)
+  std::unordered_multimap<uint64_t, Block> m_interned; ///< interned blocks keyed by a hash of their value
+  size_t m_footprint;
+};
+
+/**
+ * \brief Returns the pool shared by all producers of the process
+ */
+PayloadPool&
+getPayloadPool();
+
+} // namespace ndn
+
+#endif // NDN_TOOLS_CORE_PAYLOAD_POOL_HPP
@@ -0,0 +1,122 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tools/cc/client/pacer.hpp"
+#include "tests/benchmarks/timed-execute.hpp"
+
+#include <iostream>
+
+namespace ndn {
+namespace tests {
+
+using cc::client::Pacer;
+
+const uint32_t DATA_SIZE = 8624; // default Dsz of qsccp-client
+
+// Paces with one timer per Interest, the way QsccpConsumer used to: every send arms the timer
+// for dsz / rate (+1 ns) after the send, so timer latency adds up.
+static double
+measureTimerPerPacket(double bytesPerSecond, time::milliseconds duration)
+{
+  boost::asio::io_service io;
+  boost::asio::steady_timer timer(io);
+  uint64_t nSent = 0;
+  bool isRunning = true;
+  auto waitTime = std::chrono::nanoseconds(static_cast<int64_t>(DATA_SIZE * 1e9 / bytesPerSecond) + 1);
+
+  std::function<void()> send = [&] {
+    if (!isRunning) {
+      return;
+    }
+    ++nSent;
+    timer.expires_from_now(waitTime);
+    timer.async_wait([&] (const boost::system::error_code& error) {
+      if (!error) {
+        send();
+      }
+    });
+  };
+
+  boost::asio::steady_timer deadline(io);
+  deadline.expires_from_now(std::chrono::milliseconds(duration.count()));
+  deadline.async_wait([&] (const boost::system::error_code&) {
+    isRunning = false;
+    timer.cancel();
+  });
+
+  auto elapsed = timedExecute([&] {
+    send();
+    io.run();
+  });
+  return perSecond(nSent, elapsed) * DATA_SIZE;
+}
+
+static double
+measurePacer(double bytesPerSecond, const Pacer::Options& options, time::milliseconds duration)
+{
+  boost::asio::io_service io;
+  Pacer pacer(io, options);
+  pacer.setRate(bytesPerSecond / DATA_SIZE);
+
+  boost::asio::steady_timer deadline(io);
+  deadline.expires_from_now(std::chrono::milliseconds(duration.count()));
+  deadline.async_wait([&] (const boost::system::error_code&) { pacer.stop(); });
+
+  auto elapsed = timedExecute([&] {
+    pacer.start([] { return true; });
+    io.run();
+  });
+  return perSecond(pacer.getNSent(), elapsed) * DATA_SIZE;
+}
+
+static int
+main(int argc, char* argv[])
+{
+  time::milliseconds duration(argc > 1 ? std::stol(argv[1]) : 1000);
+
+  std::cout << "configured Gbps, achieved Gbps: timer per Interest, pacer burst 1, burst 8, "
+            << "burst 32, burst 1 busy-poll, burst 8 busy-poll\n";
+  for (double gbps : {0.1, 1.0, 2.5, 5.0, 10.0}) {
+    double bytesPerSecond = gbps * 1e9 / 8;
+    auto toGbps = [] (double bytes) { return bytes * 8 / 1e9; };
+
+    std::cout << gbps << ", " << toGbps(measureTimerPerPacket(bytesPerSecond, duration));
+    for (const auto& options : {Pacer::Options{1, false}, Pacer::Options{8, false}, Pacer::Options{32, false},
+                                Pacer::Options{1, true}, Pacer::Options{8, true}}) {
+      std::cout << ", " << toGbps(measurePacer(bytesPerSecond, options, duration));
+    }
+    std::cout << std::endl;
+  }
+  return 0;
+}
+
+} // namespace tests
+} // namespace ndn
+
+int
+main(int argc, char* argv[])
+{
+  return ndn::tests::main(argc, argv);
+}
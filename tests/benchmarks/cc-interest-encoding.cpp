@@ -0,0 +1,99 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tools/cc/common/interest-template.hpp"
+#include "tests/benchmarks/timed-execute.hpp"
+
+#include <iostream>
+#include <vector>
+
+namespace ndn {
+namespace tests {
+
+// Measures how many cc consumer Interests per second can be built through Name construction
+// and a full Interest encoding, and through the pre-encoded wire template. The decode line
+// isolates the share of the template path spent decoding its wire for the Face.
+static int
+main(int argc, char* argv[])
+{
+  Name prefix(argc > 1 ? argv[1] : "/cc/consumer/benchmark/prefix");
+  size_t nIterations = argc > 2 ? std::stoul(argv[2]) : 1000000;
+
+  Interest prototype(prefix);
+  prototype.setCanBePrefix(false);
+  prototype.setMustBeFresh(true);
+  prototype.setServiceClass(5);
+  prototype.setDsz(8624);
+  prototype.setInterestLifetime(4_s);
+  cc::InterestTemplate interestTemplate(prototype);
+
+  Interest check = interestTemplate.encodeInterest(1000);
+  Interest built = interestTemplate.makeInterest(1000);
+  check.setNonce(built.getNonce());
+  if (check.wireEncode() != built.wireEncode()) {
+    std::cerr << "ERROR: template and encoded Interests differ" << std::endl;
+    return 1;
+  }
+
+  size_t nBytes = 0;
+  auto encodeTime = timedExecute([&] {
+    for (size_t seq = 0; seq < nIterations; ++seq) {
+      nBytes += interestTemplate.encodeInterest(seq).wireEncode().size();
+    }
+  });
+  auto templateTime = timedExecute([&] {
+    for (size_t seq = 0; seq < nIterations; ++seq) {
+      nBytes += interestTemplate.makeInterest(seq).wireEncode().size();
+    }
+  });
+
+  // unparsed copies, as makeInterest hands them to the decoder
+  std::vector<Block> wires;
+  wires.reserve(nIterations);
+  for (size_t seq = 0; seq < nIterations; ++seq) {
+    const Block& wire = interestTemplate.makeInterest(seq).wireEncode();
+    wires.push_back(Block(make_shared<Buffer>(wire.begin(), wire.end())));
+  }
+  auto decodeTime = timedExecute([&] {
+    for (const auto& wire : wires) {
+      nBytes += Interest(wire).getName().size();
+    }
+  });
+
+  std::cout << "prefix=" << prefix << " iterations=" << nIterations << " bytes=" << nBytes << "\n"
+            << "encode   " << encodeTime << " " << perSecond(nIterations, encodeTime) << " Interests/s\n"
+            << "template " << templateTime << " " << perSecond(nIterations, templateTime) << " Interests/s\n"
+            << "decode   " << decodeTime << " " << perSecond(nIterations, decodeTime) << " Interests/s\n";
+  return 0;
+}
+
+} // namespace tests
+} // namespace ndn
+
+int
+main(int argc, char* argv[])
+{
+  return ndn::tests::main(argc, argv);
+}
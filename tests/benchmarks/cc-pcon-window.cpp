@@ -0,0 +1,240 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tools/cc/pcon/pcon-consumer.hpp"
+#include "tests/benchmarks/timed-execute.hpp"
+
+#include <ndn-cxx/lp/tags.hpp>
+#include <ndn-cxx/security/digest-sha256.hpp>
+#include <ndn-cxx/util/dummy-client-face.hpp>
+#include <ndn-cxx/util/scheduler.hpp>
+
+#include <cmath>
+#include <iostream>
+
+namespace ndn {
+namespace tests {
+
+using namespace cc::client;
+
+using TimePoint = time::steady_clock::TimePoint;
+
+// keeps the computed windows from being optimized out
+static volatile double g_sink;
+
+static Options
+makeOptions(CcAlgorithm algorithm, uint64_t nAcks)
+{
+  Options options;
+  options.prefix = "/cc/window";
+  // above every acknowledged sequence number, as if all of them were in flight
+  options.startSeq = nAcks + 2;
+  options.lifetime = 4_s;
+  options.seqMax = -1;
+  options.tos = 0;
+  options.dsz = 1000;
+  options.reqNum = -1;
+  options.initialSendRate = 0;
+  options.fixedRate = 0;
+  options.timingStop = 0;
+  options.delayGreedy = 0;
+  options.greedyRate = 0;
+  options.delayStart = 0;
+  options.printSamples = false;
+  options.ccAlgorithm = algorithm;
+  return options;
+}
+
+// Feeds one marked Data, so that the window leaves slow start, then nAcks unmarked Data to
+// PconConsumer::onData, and returns the time per Data. The Interests are never sent, so the
+// engine bookkeeping is the same for every algorithm and small next to a real consumer.
+static time::nanoseconds
+measureConsumer(CcAlgorithm algorithm, uint64_t nAcks)
+{
+  util::DummyClientFace face;
+  Options options = makeOptions(algorithm, nAcks);
+  PconConsumer consumer(face, options);
+
+  Data data(Name(options.prefix).appendNumber(0));
+  data.setFreshnessPeriod(1_s);
+  data.setContent(std::vector<uint8_t>(options.dsz).data(), options.dsz);
+  DigestSha256 signature;
+  signature.setValue(encoding::makeEmptyBlock(tlv::SignatureValue));
+  data.setSignature(signature);
+  data.wireEncode();
+
+  Data marked(data);
+  marked.setTag(make_shared<lp::CongestionMarkTag>(1));
+
+  SendInfo info{};
+  info.sendTime = time::steady_clock::now();
+  consumer.onData(marked, 1, info);
+
+  auto elapsed = timedExecute([&] {
+    for (uint64_t seq = 2; seq < nAcks + 2; ++seq) {
+      consumer.onData(data, seq, info);
+    }
+  });
+  return elapsed / nAcks;
+}
+
+// The per-Data CUBIC arithmetic before K was kept per congestion event: a clock read, cbrt and
+// pow for every Data.
+static double
+previousCubicTarget(double wMax, double beta, TimePoint lastDecrease)
+{
+  const double t = time::duration_cast<time::microseconds>(time::steady_clock::now() - lastDecrease).count() / 1e6;
+  const double k = std::cbrt(wMax * (1 - beta) / CubicWindow::C);
+  return CubicWindow::C * std::pow(t - k, 3) + wMax;
+}
+
+template<typename F>
+static time::nanoseconds
+measureTarget(uint64_t n, const F& getTarget)
+{
+  double sum = 0;
+  auto elapsed = timedExecute([&] {
+    for (uint64_t i = 0; i < n; ++i) {
+      sum += getTarget(i);
+    }
+  });
+  g_sink = sum;
+  return elapsed / n;
+}
+
+// Starts a PconConsumer with an initial window of nInterests, and returns the time per Interest
+// to fill it, including the Face and DummyClientFace work of expressing each Interest.
+static time::nanoseconds
+measureWindowFill(uint32_t nInterests)
+{
+  util::DummyClientFace face;
+  Options options = makeOptions(AIMD, 0);
+  options.startSeq = 0;
+  options.initialWindowSize = nInterests;
+  PconConsumer consumer(face, options);
+
+  auto elapsed = timedExecute([&] {
+    consumer.start();
+    face.getIoService().poll();
+  });
+  if (face.sentInterests.size() != nInterests) {
+    std::cerr << "expected " << nInterests << " Interests, sent " << face.sentInterests.size() << std::endl;
+  }
+  consumer.stop();
+  return elapsed / nInterests;
+}
+
+// Starts a PconConsumer whose window exceeds the nInterests sequence numbers to request, and
+// returns the number of handlers the io_service runs before it is idle: a send loop that keeps
+// coming back for the missing sequence numbers never lets it be.
+static size_t
+countHandlersToSeqMax(uint32_t nInterests)
+{
+  util::DummyClientFace face;
+  Options options = makeOptions(AIMD, 0);
+  options.startSeq = 0;
+  options.seqMax = nInterests;
+  options.initialWindowSize = 2 * nInterests;
+  PconConsumer consumer(face, options);
+
+  const size_t limit = 100 * nInterests;
+  size_t nHandlers = 0;
+  consumer.start();
+  while (nHandlers < limit && face.getIoService().poll_one() > 0) {
+    ++nHandlers;
+  }
+  if (face.sentInterests.size() != nInterests) {
+    std::cerr << "expected " << nInterests << " Interests, sent " << face.sentInterests.size() << std::endl;
+  }
+  if (nHandlers == limit) {
+    std::cerr << "still busy after " << limit << " handlers past seqMax" << std::endl;
+  }
+  consumer.stop();
+  return nHandlers;
+}
+
+// The scheduling cost the send loop saves: one zero-delay Scheduler event per Interest.
+static time::nanoseconds
+measureEventChain(uint32_t nEvents)
+{
+  boost::asio::io_service io;
+  util::Scheduler scheduler(io);
+  uint32_t nLeft = nEvents;
+  std::function<void()> next = [&] {
+    if (--nLeft > 0) {
+      scheduler.schedule(0_ns, next);
+    }
+  };
+
+  auto elapsed = timedExecute([&] {
+    scheduler.schedule(0_ns, next);
+    io.poll();
+  });
+  return elapsed / nEvents;
+}
+
+static int
+main(int argc, char* argv[])
+{
+  uint64_t nAcks = argc > 1 ? std::stoull(argv[1]) : 10000000;
+  uint32_t window = argc > 2 ? std::stoul(argv[2]) : 100000;
+
+  std::cout << "ns per Interest to fill a window of " << window << "\n"
+            << "  send loop " << measureWindowFill(window).count() << "\n"
+            << "  zero-delay Scheduler event alone " << measureEventChain(window).count() << std::endl;
+  std::cout << "handlers run to request " << window / 2 << " sequence numbers with a window of "
+            << window << ": " << countHandlersToSeqMax(window / 2) << std::endl;
+
+  std::cout << "ns per Data in PconConsumer::onData, in congestion avoidance\n"
+            << "  AIMD " << measureConsumer(AIMD, nAcks).count() << "\n"
+            << "  BIC " << measureConsumer(BIC, nAcks).count() << "\n"
+            << "  CUBIC " << measureConsumer(CUBIC, nAcks).count() << std::endl;
+
+  // the Data arrival times of a 1 Gbps flow of 8 KiB Data
+  const TimePoint start = time::steady_clock::now();
+  const auto interval = time::nanoseconds(65536);
+  const double beta = 0.8;
+  const double wMax = 1000;
+
+  CubicWindow cubic(beta, true, start);
+  cubic.onCongestion(wMax, start);
+
+  std::cout << "ns per CUBIC target window\n"
+            << "  clock read, cbrt and pow per Data "
+            << measureTarget(nAcks, [&] (uint64_t) { return previousCubicTarget(wMax, beta, start); }).count()
+            << "\n  K per congestion event, shared arrival time "
+            << measureTarget(nAcks, [&] (uint64_t i) { return cubic.getTarget(start + interval * i); }).count()
+            << std::endl;
+  return 0;
+}
+
+} // namespace tests
+} // namespace ndn
+
+int
+main(int argc, char* argv[])
+{
+  return ndn::tests::main(argc, argv);
+}
@@ -0,0 +1,82 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tools/cc/server/data-template.hpp"
+#include "tests/benchmarks/timed-execute.hpp"
+
+#include <iostream>
+
+namespace ndn {
+namespace tests {
+
+// Measures how many cc-producer responses per second can be built through a full
+// Data encoding and through the pre-encoded wire template.
+static int
+main(int argc, char* argv[])
+{
+  size_t payloadSize = argc > 1 ? std::stoul(argv[1]) : 1024;
+  size_t nIterations = argc > 2 ? std::stoul(argv[2]) : 1000000;
+
+  PayloadPool payloads(payloadSize);
+  cc::server::DataTemplate dataTemplate(payloads, 4_s, 0);
+
+  std::vector<Name> names;
+  for (uint64_t seq = 0; seq < 1024; ++seq) {
+    names.push_back(Name("/cc/producer/benchmark").appendNumber(seq));
+    names.back().wireEncode();
+  }
+
+  if (dataTemplate.makeWire(names[0], payloadSize, 5) !=
+      dataTemplate.encodeData(names[0], payloadSize, 5).wireEncode()) {
+    std::cerr << "ERROR: template and encoded responses differ" << std::endl;
+    return 1;
+  }
+
+  size_t nBytes = 0;
+  auto encodeTime = timedExecute([&] {
+    for (size_t i = 0; i < nIterations; ++i) {
+      nBytes += dataTemplate.encodeData(names[i % names.size()], payloadSize, 5).wireEncode().size();
+    }
+  });
+  auto templateTime = timedExecute([&] {
+    for (size_t i = 0; i < nIterations; ++i) {
+      nBytes += dataTemplate.makeWire(names[i % names.size()], payloadSize, 5).size();
+    }
+  });
+
+  std::cout << "payload=" << payloadSize << " iterations=" << nIterations << " bytes=" << nBytes << "\n"
+            << "encode   " << encodeTime << " " << perSecond(nIterations, encodeTime) << " pkt/s\n"
+            << "template " << templateTime << " " << perSecond(nIterations, templateTime) << " pkt/s\n";
+  return 0;
+}
+
+} // namespace tests
+} // namespace ndn
+
+int
+main(int argc, char* argv[])
+{
+  return ndn::tests::main(argc, argv);
+}
@@ -0,0 +1,106 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tools/cc/server/ndn-producer.hpp"
+#include "tools/cc/common/logger.hpp"
+#include "tests/benchmarks/timed-execute.hpp"
+
+#include <ndn-cxx/util/dummy-client-face.hpp>
+
+#include <fstream>
+#include <iostream>
+
+namespace ndn {
+namespace tests {
+
+// Measures cc-producer throughput with logging disabled, with the ring-buffered backend
+// and with the legacy synchronous (flush per Interest) output.
+static double
+measure(cc::server::Producer& producer, util::DummyClientFace& face,
+        boost::asio::io_service& io, const std::vector<Interest>& interests, size_t nIterations)
+{
+  auto duration = timedExecute([&] {
+    for (size_t i = 0; i < nIterations; ++i) {
+      producer.onInterest(interests[i % interests.size()]);
+      if (i % 1024 == 1023) {
+        io.poll();
+        face.sentData.clear();
+      }
+    }
+    io.poll();
+    face.sentData.clear();
+  });
+  return perSecond(nIterations, duration);
+}
+
+static int
+main(int argc, char* argv[])
+{
+  std::string logFile = argc > 1 ? argv[1] : "/dev/null";
+  size_t nIterations = argc > 2 ? std::stoul(argv[2]) : 500000;
+
+  boost::asio::io_service io;
+  KeyChain keyChain("pib-memory:", "tpm-memory:");
+  util::DummyClientFace face(io, keyChain);
+
+  cc::server::Options options;
+  options.prefix = "/cc/producer/benchmark";
+  options.payloadSize = 1024;
+  cc::server::Producer producer(face, keyChain, options);
+
+  std::vector<Interest> interests;
+  for (uint64_t seq = 0; seq < 1024; ++seq) {
+    interests.emplace_back(Name(options.prefix).appendNumber(seq));
+    interests.back().setServiceClass(5);
+    interests.back().wireEncode();
+  }
+
+  struct Mode
+  {
+    const char* name;
+    cc::LogLevel level;
+    cc::Logger::Backend backend;
+  };
+  for (const auto& mode : {Mode{"off", cc::LogLevel::NONE, cc::Logger::Backend::RING},
+                           Mode{"ring", cc::LogLevel::TRACE, cc::Logger::Backend::RING},
+                           Mode{"sync", cc::LogLevel::TRACE, cc::Logger::Backend::SYNC}}) {
+    auto file = make_unique<std::ofstream>(logFile, std::ios::trunc);
+    cc::getLogger().configure(mode.level, mode.backend, make_unique<cc::TextLogSink>(std::move(file)));
+    double rate = measure(producer, face, io, interests, nIterations);
+    cc::getLogger().stop();
+
+    std::cout << mode.name << " " << rate << " pkt/s, dropped " << cc::getLogger().getNDropped() << "\n";
+  }
+  return 0;
+}
+
+} // namespace tests
+} // namespace ndn
+
+int
+main(int argc, char* argv[])
+{
+  return ndn::tests::main(argc, argv);
+}
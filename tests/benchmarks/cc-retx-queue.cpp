@@ -0,0 +1,114 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tools/cc/common/sequence-window.hpp"
+#include "tests/benchmarks/timed-execute.hpp"
+
+#include <iostream>
+#include <random>
+#include <set>
+
+namespace ndn {
+namespace tests {
+
+// Replays the retransmission queue of a consumer: a timeout sweep over a window of Interests
+// in flight queues each one that was lost, then the retransmissions pop the queue smallest
+// first, interleaved with late losses of earlier retransmissions.
+template<typename Queue, typename Pop>
+static double
+measure(Queue& queue, const Pop& pop, size_t windowSize, double lossRate, size_t nIterations)
+{
+  std::mt19937_64 rng(1);
+  std::bernoulli_distribution isLost(lossRate);
+  std::vector<bool> lost(windowSize);
+  for (size_t i = 0; i < windowSize; ++i) {
+    lost[i] = isLost(rng);
+  }
+
+  uint64_t base = 0;
+  uint64_t checksum = 0;
+  size_t nOperations = 0;
+  auto duration = timedExecute([&] {
+    while (nOperations < nIterations) {
+      for (size_t i = 0; i < windowSize; ++i) {
+        if (lost[i]) {
+          queue.insert(base + i);
+          ++nOperations;
+        }
+      }
+      size_t nPopped = 0;
+      while (!queue.empty()) {
+        uint64_t seq = pop(queue);
+        checksum += seq;
+        ++nOperations;
+        if (++nPopped % 8 == 0) {
+          // a retransmission lost again, queued behind the current minimum
+          queue.insert(seq + 1);
+          ++nOperations;
+        }
+      }
+      base += windowSize;
+    }
+  });
+
+  if (checksum == 0) {
+    std::cerr << "unexpected checksum\n";
+  }
+  return perSecond(nOperations, duration);
+}
+
+static int
+main(int argc, char* argv[])
+{
+  size_t nIterations = argc > 1 ? std::stoul(argv[1]) : 20000000;
+
+  for (size_t windowSize : {1000, 100000, 2000000}) {
+    for (double lossRate : {0.01, 0.1, 0.3}) {
+      std::set<uint64_t> set;
+      double setRate = measure(set, [] (std::set<uint64_t>& s) {
+                                 uint64_t seq = *s.begin();
+                                 s.erase(s.begin());
+                                 return seq;
+                               }, windowSize, lossRate, nIterations);
+
+      cc::SequenceWindow window;
+      double windowRate = measure(window, [] (cc::SequenceWindow& w) { return w.popMin(); },
+                                  windowSize, lossRate, nIterations);
+
+      std::cout << "window=" << windowSize << " loss=" << lossRate
+                << " std::set " << setRate << " op/s, SequenceWindow " << windowRate << " op/s\n";
+    }
+  }
+  return 0;
+}
+
+} // namespace tests
+} // namespace ndn
+
+int
+main(int argc, char* argv[])
+{
+  return ndn::tests::main(argc, argv);
+}
@@ -0,0 +1,247 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tools/cc/common/timer-wheel.hpp"
+#include "tests/benchmarks/timed-execute.hpp"
+
+#include <boost/multi_index_container.hpp>
+#include <boost/multi_index/member.hpp>
+#include <boost/multi_index/ordered_index.hpp>
+#include <boost/multi_index/tag.hpp>
+
+#include <atomic>
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <new>
+#include <random>
+#include <unordered_map>
+
+// Live heap bytes, tracked by the replacement allocation functions below.
+static std::atomic<size_t> g_liveBytes{0};
+
+namespace {
+
+// keeps the user part aligned like a regular allocation
+constexpr size_t HEADER_SIZE = alignof(std::max_align_t);
+
+} // namespace
+
+void*
+operator new(std::size_t size)
+{
+  void* p = std::malloc(size + HEADER_SIZE);
+  if (p == nullptr) {
+    throw std::bad_alloc();
+  }
+  *static_cast<std::size_t*>(p) = size;
+  g_liveBytes += size;
+  return static_cast<char*>(p) + HEADER_SIZE;
+}
+
+// not inlined, so that the compiler does not pair the free() below with the allocations of callers
+__attribute__((noinline)) void
+operator delete(void* p) noexcept
+{
+  if (p == nullptr) {
+    return;
+  }
+  void* base = static_cast<char*>(p) - HEADER_SIZE;
+  g_liveBytes -= *static_cast<std::size_t*>(base);
+  std::free(base);
+}
+
+void
+operator delete(void* p, std::size_t) noexcept
+{
+  operator delete(p);
+}
+
+namespace ndn {
+namespace tests {
+
+using TimePoint = time::steady_clock::TimePoint;
+
+// The retransmission bookkeeping the pcon and bbr consumers used before the timer wheel.
+class MultiIndexTimers
+{
+public:
+  void
+  insert(uint32_t seq, TimePoint sendTime)
+  {
+    m_timeouts.insert(SeqTimeout{seq, sendTime});
+  }
+
+  void
+  cancel(uint32_t seq)
+  {
+    m_timeouts.erase(seq);
+  }
+
+  template<typename F>
+  void
+  expire(TimePoint until, const F& onExpire)
+  {
+    auto& byTime = m_timeouts.get<ByTime>();
+    while (!byTime.empty() && byTime.begin()->time <= until) {
+      uint32_t seq = byTime.begin()->seq;
+      byTime.erase(byTime.begin());
+      onExpire(seq);
+    }
+  }
+
+private:
+  struct SeqTimeout
+  {
+    uint32_t seq;
+    TimePoint time;
+  };
+  struct BySeq;
+  struct ByTime;
+
+  boost::multi_index_container<
+    SeqTimeout,
+    boost::multi_index::indexed_by<
+      boost::multi_index::ordered_unique<boost::multi_index::tag<BySeq>,
+        boost::multi_index::member<SeqTimeout, uint32_t, &SeqTimeout::seq>>,
+      boost::multi_index::ordered_non_unique<boost::multi_index::tag<ByTime>,
+        boost::multi_index::member<SeqTimeout, TimePoint, &SeqTimeout::time>>>> m_timeouts;
+};
+
+// The retransmission bookkeeping of the consumers: a timer wheel plus the handle of every sequence.
+class WheelTimers
+{
+public:
+  explicit
+  WheelTimers(TimePoint origin)
+    : m_wheel(1_ms, origin)
+  {
+  }
+
+  void
+  insert(uint32_t seq, TimePoint sendTime)
+  {
+    m_handles.emplace(seq, m_wheel.insert(sendTime, seq));
+  }
+
+  void
+  cancel(uint32_t seq)
+  {
+    auto it = m_handles.find(seq);
+    if (it != m_handles.end()) {
+      m_wheel.cancel(it->second);
+      m_handles.erase(it);
+    }
+  }
+
+  template<typename F>
+  void
+  expire(TimePoint until, const F& onExpire)
+  {
+    m_wheel.advance(until, [&] (uint32_t seq) {
+      m_handles.erase(seq);
+      onExpire(seq);
+    });
+  }
+
+private:
+  cc::TimerWheel<uint32_t> m_wheel;
+  std::unordered_map<uint32_t, cc::TimerWheel<uint32_t>::Handle> m_handles;
+};
+
+struct Result
+{
+  double cpuSeconds;
+  size_t peakBytes;
+  size_t nTimeouts;
+};
+
+// Keeps nOutstanding Interests in flight, one sent every microsecond of simulated time. The
+// Data of the oldest Interest arrives with every send, except for a fraction of lost Interests
+// that time out instead; timeouts are checked every 50 ms like the consumers used to.
+template<typename Timers>
+static Result
+measure(Timers& timers, size_t nOutstanding, size_t nIterations, double lossRate, TimePoint start)
+{
+  const auto rto = time::microseconds(nOutstanding) * 3 / 2;
+  std::mt19937 rng(1);
+  std::bernoulli_distribution isLost(lossRate);
+  size_t baseBytes = g_liveBytes;
+  size_t peakBytes = 0;
+  size_t nTimeouts = 0;
+
+  std::clock_t before = std::clock();
+  for (uint32_t seq = 0; seq < nIterations; ++seq) {
+    TimePoint now = start + time::microseconds(seq);
+    timers.insert(seq, now);
+    if (seq >= nOutstanding && !isLost(rng)) {
+      timers.cancel(seq - nOutstanding);
+    }
+    if (seq % 50000 == 0) {
+      timers.expire(now - rto, [&] (uint32_t) { ++nTimeouts; });
+      peakBytes = std::max(peakBytes, g_liveBytes - baseBytes);
+    }
+  }
+  std::clock_t after = std::clock();
+
+  return {static_cast<double>(after - before) / CLOCKS_PER_SEC, peakBytes, nTimeouts};
+}
+
+static int
+main(int argc, char* argv[])
+{
+  size_t nOutstanding = argc > 1 ? std::stoul(argv[1]) : 1000000;
+  size_t nIterations = argc > 2 ? std::stoul(argv[2]) : 10000000;
+  TimePoint start = time::steady_clock::now();
+
+  for (double lossRate : {0.001, 0.01, 0.1}) {
+    Result multiIndex;
+    {
+      MultiIndexTimers timers;
+      multiIndex = measure(timers, nOutstanding, nIterations, lossRate, start);
+    }
+    Result wheel;
+    {
+      WheelTimers timers(start);
+      wheel = measure(timers, nOutstanding, nIterations, lossRate, start);
+    }
+
+    std::cout << "outstanding=" << nOutstanding << " loss=" << lossRate << "\n"
+              << "  multi_index " << multiIndex.cpuSeconds << " s CPU, "
+              << multiIndex.peakBytes / 1024 / 1024 << " MiB, " << multiIndex.nTimeouts << " timeouts\n"
+              << "  timer wheel " << wheel.cpuSeconds << " s CPU, "
+              << wheel.peakBytes / 1024 / 1024 << " MiB, " << wheel.nTimeouts << " timeouts\n";
+  }
+  return 0;
+}
+
+} // namespace tests
+} // namespace ndn
+
+int
+main(int argc, char* argv[])
+{
+  return ndn::tests::main(argc, argv);
+}
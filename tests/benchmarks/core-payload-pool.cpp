@@ -0,0 +1,138 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "core/payload-pool.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+
+// Live heap bytes, tracked by the replacement allocation functions below.
+static std::atomic<size_t> g_liveBytes{0};
+
+namespace {
+
+// keeps the user part aligned like a regular allocation
+constexpr size_t HEADER_SIZE = alignof(std::max_align_t);
+
+} // namespace
+
+void*
+operator new(std::size_t size)
+{
+  void* p = std::malloc(size + HEADER_SIZE);
+  if (p == nullptr) {
+    throw std::bad_alloc();
+  }
+  *static_cast<std::size_t*>(p) = size;
+  g_liveBytes += size;
+  return static_cast<char*>(p) + HEADER_SIZE;
+}
+
+void
+operator delete(void* p) noexcept
+{
+  if (p == nullptr) {
+    return;
+  }
+  void* base = static_cast<char*>(p) - HEADER_SIZE;
+  g_liveBytes -= *static_cast<std::size_t*>(base);
+  std::free(base);
+}
+
+void
+operator delete(void* p, std::size_t) noexcept
+{
+  operator delete(p);
+}
+
+namespace ndn {
+namespace tests {
+
+// Compares the heap footprint of payloads built the way the producers used to (one buffer per
+// producer, one copy per poked Data) with payloads taken from the shared PayloadPool.
+// Each producer keeps nData responses alive, like Data waiting in a transport queue.
+static size_t
+measure(size_t nProducers, size_t nData, const std::function<Block(size_t producer)>& makePayload)
+{
+  size_t before = g_liveBytes;
+  std::vector<Block> payloads;
+  std::vector<Data> responses;
+  responses.reserve(nProducers * nData);
+  for (size_t producer = 0; producer < nProducers; ++producer) {
+    payloads.push_back(makePayload(producer));
+    for (size_t i = 0; i < nData; ++i) {
+      responses.emplace_back(Name("/benchmark").appendNumber(i));
+      responses.back().setContent(payloads.back());
+    }
+  }
+  return g_liveBytes - before;
+}
+
+static int
+main(int argc, char* argv[])
+{
+  size_t payloadSize = argc > 1 ? std::stoul(argv[1]) : 8192;
+  size_t nProducers = argc > 2 ? std::stoul(argv[2]) : 64;
+  size_t nData = argc > 3 ? std::stoul(argv[3]) : 100;
+
+  size_t perTool = measure(nProducers, nData, [&] (size_t) {
+    auto buffer = make_shared<Buffer>();
+    buffer->assign(payloadSize, 'a');
+    return Block(tlv::Content, std::move(buffer));
+  });
+
+  auto input = make_shared<Buffer>();
+  input->assign(payloadSize, 'p');
+  size_t perToolCopy = measure(nProducers, nData, [&] (size_t) {
+    return Block(tlv::Content, make_shared<Buffer>(*input));
+  });
+
+  PayloadPool pool;
+  size_t pooled = measure(nProducers, nData, [&] (size_t) {
+    return pool.getFilled(payloadSize);
+  });
+  size_t interned = measure(nProducers, nData, [&] (size_t) {
+    return pool.intern(make_shared<Buffer>(*input));
+  });
+
+  std::cout << "payload=" << payloadSize << " producers=" << nProducers << " data/producer=" << nData << "\n"
+            << "filled per tool   " << perTool << " bytes\n"
+            << "filled pooled     " << pooled << " bytes\n"
+            << "copied per tool   " << perToolCopy << " bytes\n"
+            << "copied interned   " << interned << " bytes\n"
+            << "pool footprint    " << pool.getFootprint() << " bytes in " << pool.size() << " blocks\n";
+  return 0;
+}
+
+} // namespace tests
+} // namespace ndn
+
+int
+main(int argc, char* argv[])
+{
+  return ndn::tests::main(argc, argv);
+}
@@ -0,0 +1,57 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NDN_TOOLS_TESTS_BENCHMARKS_TIMED_EXECUTE_HPP
+#define NDN_TOOLS_TESTS_BENCHMARKS_TIMED_EXECUTE_HPP
+
+#include "core/common.hpp"
+
+namespace ndn {
+namespace tests {
+
+/** \brief measure the wall-clock time taken by \p f
+ */
+template<typename F>
+time::nanoseconds
+timedExecute(const F& f)
+{
+  auto before = time::steady_clock::now();
+  f();
+  auto after = time::steady_clock::now();
+  return after - before;
+}
+
+/** \brief convert an iteration count and its duration into operations per second
+ */
+inline double
+perSecond(size_t nIterations, time::nanoseconds duration)
+{
+  return nIterations / (duration.count() / 1e9);
+}
+
+} // namespace tests
+} // namespace ndn
+
+#endif // NDN_TOOLS_TESTS_BENCHMARKS_TIMED_EXECUTE_HPP
@@ -0,0 +1,126 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tools/cc/bbr/bbr-consumer.hpp"
+
+#include "tests/test-common.hpp"
+#include <ndn-cxx/util/dummy-client-face.hpp>
+
+namespace ndn {
+namespace cc {
+namespace client {
+namespace tests {
+
+using namespace ndn::tests;
+
+class BbrConsumerFixture : public UnitTestTimeFixture
+{
+protected:
+  BbrConsumerFixture()
+    : face(io, {true, true})
+  {
+    options.prefix = "/cc/bbr";
+    options.startSeq = 0;
+    options.lifetime = 4_s;
+    options.seqMax = 1;
+    options.tos = 0;
+    options.dsz = 1000;
+    options.fixedRate = -1;
+    options.timingStop = -1;
+    options.delayGreedy = -1;
+    options.greedyRate = -1;
+    options.delayStart = 0;
+    options.printSamples = false;
+  }
+
+  ~BbrConsumerFixture()
+  {
+    face.shutdown();
+    io.stop();
+  }
+
+protected:
+  boost::asio::io_service io;
+  util::DummyClientFace face;
+  Options options;
+};
+
+BOOST_AUTO_TEST_SUITE(Cc)
+BOOST_FIXTURE_TEST_SUITE(TestBbrConsumer, BbrConsumerFixture)
+
+BOOST_AUTO_TEST_CASE(RtoRetransmissionThenData)
+{
+  BbrConsumer consumer(face, options);
+  std::vector<uint64_t> timeoutSeqs;
+  consumer.afterTimeout.connect([&] (uint64_t seq) { timeoutSeqs.push_back(seq); });
+  consumer.start();
+  advanceClocks(io, 1_ms);
+  BOOST_REQUIRE_EQUAL(face.sentInterests.size(), 1);
+  BOOST_CHECK_EQUAL(consumer.getNInFlight(), 1);
+
+  // the initial RTO of 1 s expires, and the retransmission takes the place of the lost Interest
+  advanceClocks(io, 10_ms, 150);
+  BOOST_REQUIRE_EQUAL(face.sentInterests.size(), 2);
+  BOOST_CHECK_EQUAL(timeoutSeqs.size(), 1);
+  BOOST_CHECK_EQUAL(consumer.getNInFlight(), 1);
+
+  // the Data satisfies both transmissions, but the sequence number leaves the flight once
+  face.receive(*makeData(Name(options.prefix).appendNumber(0)));
+  advanceClocks(io, 1_ms);
+  BOOST_CHECK_EQUAL(consumer.getCounters().snapshot().nData, 1);
+  BOOST_CHECK_EQUAL(consumer.getNInFlight(), 0);
+
+  // neither does the lifetime of the first transmission count as a second loss
+  advanceClocks(io, 100_ms, 50);
+  BOOST_CHECK_EQUAL(timeoutSeqs.size(), 1);
+  BOOST_CHECK_EQUAL(face.sentInterests.size(), 2);
+  BOOST_CHECK_EQUAL(consumer.getNInFlight(), 0);
+
+  consumer.stop();
+}
+
+BOOST_AUTO_TEST_CASE(LostRetransmission)
+{
+  BbrConsumer consumer(face, options);
+  std::vector<uint64_t> timeoutSeqs;
+  consumer.afterTimeout.connect([&] (uint64_t seq) { timeoutSeqs.push_back(seq); });
+  consumer.start();
+
+  // both transmissions are lost: one loss per expired retransmission timer, none per lifetime
+  advanceClocks(io, 10_ms, 500);
+  BOOST_REQUIRE_GE(face.sentInterests.size(), 2);
+  BOOST_CHECK_EQUAL(timeoutSeqs.size(), face.sentInterests.size() - 1);
+  BOOST_CHECK_EQUAL(consumer.getNInFlight(), 1);
+
+  consumer.stop();
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestBbrConsumer
+BOOST_AUTO_TEST_SUITE_END() // Cc
+
+} // namespace tests
+} // namespace client
+} // namespace cc
+} // namespace ndn
@@ -0,0 +1,233 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tools/cc/bbr/bbr-model.hpp"
+
+#include "tests/test-common.hpp"
+
+#include <cmath>
+#include <map>
+
+namespace ndn {
+namespace cc {
+namespace client {
+namespace tests {
+
+BOOST_AUTO_TEST_SUITE(Cc)
+BOOST_AUTO_TEST_SUITE(TestBbrModel)
+
+using TimePoint = time::steady_clock::TimePoint;
+
+const size_t DATA_SIZE = 1000;
+
+// A consumer driving a BbrModel over a path with a FIFO bottleneck, one Data per Interest.
+class PathFixture
+{
+public:
+  PathFixture(double bandwidth, time::nanoseconds rtt)
+    : now(time::seconds(1))
+    , model(DATA_SIZE, 0, now)
+    , m_sampler(now)
+    , m_bandwidth(bandwidth)
+    , m_rtt(rtt)
+    , m_linkFree(now)
+    , m_nextSend(now)
+  {
+  }
+
+  // Runs until @p end; every @p lossInterval-th Interest is lost, unless 0.
+  void
+  run(TimePoint end, uint64_t lossInterval = 0)
+  {
+    while (now < end) {
+      bool canSend = m_inFlight.size() * DATA_SIZE < model.getCwnd();
+      TimePoint sendTime = std::max(now, m_nextSend);
+      if (canSend && (m_inFlight.empty() || sendTime <= m_inFlight.begin()->first)) {
+        now = sendTime;
+        send(lossInterval > 0 && ++m_nSent % lossInterval == 0);
+        continue;
+      }
+      BOOST_REQUIRE(!m_inFlight.empty());
+      auto packet = m_inFlight.begin();
+      now = packet->first;
+      Packet p = packet->second;
+      m_inFlight.erase(packet);
+      uint64_t inFlight = m_inFlight.size() * DATA_SIZE;
+      if (p.isLost) {
+        model.onLoss(DATA_SIZE, inFlight, now);
+        continue;
+      }
+      auto sample = m_sampler.onDelivered(p.snapshot, DATA_SIZE, now);
+      auto rtt = time::duration_cast<time::nanoseconds>(now - p.snapshot.sentTime);
+      maxRtt = std::max(maxRtt, rtt);
+      model.onData(sample, DATA_SIZE, rtt, false, inFlight, now);
+    }
+  }
+
+  void
+  setRtt(time::nanoseconds rtt)
+  {
+    m_rtt = rtt;
+  }
+
+private:
+  struct Packet
+  {
+    DeliverySnapshot snapshot;
+    bool isLost;
+  };
+
+  void
+  send(bool isLost)
+  {
+    Packet p{m_sampler.onSend(now, m_inFlight.size() * DATA_SIZE, DATA_SIZE), isLost};
+    m_nextSend = now + time::nanoseconds(static_cast<int64_t>(DATA_SIZE / model.getPacingRate() * 1e9));
+
+    // the Data queues behind the previous ones at the bottleneck, on the way back
+    TimePoint arrival = std::max(now + m_rtt / 2, m_linkFree);
+    m_linkFree = arrival + time::nanoseconds(static_cast<int64_t>(DATA_SIZE / m_bandwidth * 1e9));
+    TimePoint done = isLost ? now + m_rtt * 4 : m_linkFree + m_rtt / 2;
+    // keep distinct keys, in arrival order
+    while (m_inFlight.count(done) > 0) {
+      done += time::nanoseconds(1);
+    }
+    m_inFlight.emplace(done, p);
+  }
+
+public:
+  TimePoint now;
+  BbrModel model;
+  time::nanoseconds maxRtt = time::nanoseconds::zero();
+
+private:
+  DeliveryRateSampler m_sampler;
+  double m_bandwidth;
+  time::nanoseconds m_rtt;
+  TimePoint m_linkFree;
+  TimePoint m_nextSend;
+  uint64_t m_nSent = 0;
+  std::map<TimePoint, Packet> m_inFlight;
+};
+
+BOOST_AUTO_TEST_CASE(Initial)
+{
+  auto now = TimePoint(time::seconds(1));
+  BbrModel model(DATA_SIZE, 0, now);
+  BOOST_CHECK_EQUAL(model.getMode(), BbrModel::STARTUP);
+  BOOST_CHECK_EQUAL(model.getCwnd(), BbrModel::INITIAL_CWND * DATA_SIZE);
+  BOOST_CHECK_GT(model.getPacingRate(), 0);
+  BOOST_CHECK_EQUAL(model.getMinRtt(), time::nanoseconds::zero());
+}
+
+BOOST_AUTO_TEST_CASE(ConvergeToBottleneck)
+{
+  // 10 MB/s over a 100 ms RTT: a BDP of 1000 Data
+  PathFixture path(1e7, time::milliseconds(100));
+  auto start = path.now;
+  path.run(start + time::seconds(4));
+
+  BOOST_CHECK(path.model.isFullPipe());
+  BOOST_CHECK_NE(path.model.getMode(), BbrModel::STARTUP);
+  BOOST_CHECK_NE(path.model.getMode(), BbrModel::DRAIN);
+  BOOST_CHECK_CLOSE(path.model.getBandwidth(), 1e7, 5);
+  // the propagation delay, and the time to serialize one Data at the bottleneck
+  BOOST_CHECK_EQUAL(path.model.getMinRtt(), time::microseconds(100100));
+
+  // once drained, the queue stays within the probing headroom
+  path.maxRtt = time::nanoseconds::zero();
+  path.run(start + time::seconds(8));
+  BOOST_CHECK_CLOSE(path.model.getBandwidth(), 1e7, 5);
+  BOOST_CHECK_LT(path.maxRtt, time::milliseconds(150));
+}
+
+BOOST_AUTO_TEST_CASE(ProbeRtt)
+{
+  // 1 ms to serialize a Data at the bottleneck
+  PathFixture path(1e6, time::milliseconds(20));
+  auto start = path.now;
+  path.run(start + time::seconds(1));
+  BOOST_CHECK_EQUAL(path.model.getMinRtt(), time::milliseconds(21));
+
+  // a longer route: no sample refreshes the minimum RTT any more
+  path.setRtt(time::milliseconds(30));
+  bool hasProbedRtt = false;
+  while (path.now < start + time::seconds(7)) {
+    path.run(path.now + time::milliseconds(10));
+    if (path.model.getMode() == BbrModel::PROBE_RTT) {
+      hasProbedRtt = true;
+      // half a BDP of the old route
+      BOOST_CHECK_LE(path.model.getCwnd(), 1e6 * 0.021 / 2 + 1);
+    }
+  }
+  BOOST_CHECK(hasProbedRtt);
+  BOOST_CHECK_NE(path.model.getMode(), BbrModel::PROBE_RTT);
+  BOOST_CHECK_EQUAL(path.model.getMinRtt(), time::milliseconds(21));
+
+  // the minimum of the old route expires after 10 s
+  path.run(start + time::seconds(12));
+  BOOST_CHECK_EQUAL(path.model.getMinRtt(), time::milliseconds(31));
+}
+
+BOOST_AUTO_TEST_CASE(LossBoundsInflight)
+{
+  // 1 Interest in 10 lost, far above the loss threshold
+  PathFixture path(1e7, time::milliseconds(50));
+  BOOST_CHECK(std::isinf(path.model.getInflightHi()));
+  path.run(path.now + time::seconds(3), 10);
+
+  BOOST_CHECK(path.model.isFullPipe());
+  BOOST_CHECK(!std::isinf(path.model.getInflightHi()));
+  // the window stays around the BDP of 500 Data instead of growing with the queue
+  BOOST_CHECK_LT(path.model.getCwnd(), 2 * 500 * DATA_SIZE);
+}
+
+BOOST_AUTO_TEST_CASE(Marks)
+{
+  auto now = TimePoint(time::seconds(1));
+  BbrModel model(DATA_SIZE, 0, now);
+  DeliveryRateSampler sampler(now);
+
+  // a round trip of 10 Data, all marked: STARTUP ends at once
+  std::vector<DeliverySnapshot> snapshots;
+  for (size_t i = 0; i < 10; ++i) {
+    snapshots.push_back(sampler.onSend(now, i * DATA_SIZE, DATA_SIZE));
+  }
+  now += time::milliseconds(10);
+  for (size_t i = 0; i < 10; ++i) {
+    auto sample = sampler.onDelivered(snapshots[i], DATA_SIZE, now);
+    model.onData(sample, DATA_SIZE, time::milliseconds(10), true, (9 - i) * DATA_SIZE, now);
+  }
+  BOOST_CHECK(model.isFullPipe());
+  BOOST_CHECK_NE(model.getMode(), BbrModel::STARTUP);
+  BOOST_CHECK(!std::isinf(model.getInflightHi()));
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestBbrModel
+BOOST_AUTO_TEST_SUITE_END() // Cc
+
+} // namespace tests
+} // namespace client
+} // namespace cc
+} // namespace ndn
@@ -0,0 +1,105 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tools/cc/client/multi-flow.hpp"
+
+#include "tests/test-common.hpp"
+
+namespace ndn {
+namespace cc {
+namespace client {
+namespace tests {
+
+BOOST_AUTO_TEST_SUITE(Cc)
+BOOST_AUTO_TEST_SUITE(TestMultiFlow)
+
+BOOST_AUTO_TEST_CASE(JainIndex)
+{
+  BOOST_CHECK_CLOSE(computeJainIndex({}), 1.0, 1e-9);
+  BOOST_CHECK_CLOSE(computeJainIndex({0, 0}), 1.0, 1e-9);
+  BOOST_CHECK_CLOSE(computeJainIndex({5e6, 5e6, 5e6}), 1.0, 1e-9);
+  BOOST_CHECK_CLOSE(computeJainIndex({1e6, 0, 0, 0}), 0.25, 1e-9);
+  // (1 + 2 + 3)^2 / (3 * (1 + 4 + 9))
+  BOOST_CHECK_CLOSE(computeJainIndex({1, 2, 3}), 36.0 / 42.0, 1e-9);
+}
+
+BOOST_AUTO_TEST_CASE(FlowSpec)
+{
+  Options defaults;
+  defaults.prefix = Name("/cc");
+  defaults.tos = 5;
+  defaults.dsz = 8624;
+  defaults.fixedRate = -1;
+  defaults.delayStart = 0;
+  std::vector<Options> flows(3, defaults);
+
+  applyFlowSpec("1:tos=3,fixedRate=1000000,delayStart=200", flows);
+  BOOST_CHECK_EQUAL(flows[1].tos, 3);
+  BOOST_CHECK_EQUAL(flows[1].fixedRate, 1000000);
+  BOOST_CHECK_EQUAL(flows[1].delayStart, 200);
+  BOOST_CHECK_EQUAL(flows[0].tos, 5);
+  BOOST_CHECK_EQUAL(flows[2].fixedRate, -1);
+
+  applyFlowSpec("2:prefix=/other,dsz=1000", flows);
+  BOOST_CHECK_EQUAL(flows[2].prefix, Name("/other"));
+  BOOST_CHECK_EQUAL(flows[2].dsz, 1000);
+
+  applyFlowSpec("0:rateFilter=kalman:200,0.05,tos=2", flows);
+  BOOST_CHECK_EQUAL(flows[0].rateFilter, "kalman:200,0.05");
+  BOOST_CHECK_EQUAL(flows[0].tos, 2);
+
+  BOOST_CHECK_THROW(applyFlowSpec("tos=3", flows), std::invalid_argument);
+  BOOST_CHECK_THROW(applyFlowSpec("3:tos=3", flows), std::invalid_argument);
+  BOOST_CHECK_THROW(applyFlowSpec("x:tos=3", flows), std::invalid_argument);
+  BOOST_CHECK_THROW(applyFlowSpec("0:tos", flows), std::invalid_argument);
+  BOOST_CHECK_THROW(applyFlowSpec("0:tos=abc", flows), std::invalid_argument);
+  BOOST_CHECK_THROW(applyFlowSpec("0:color=red", flows), std::invalid_argument);
+  BOOST_CHECK_THROW(applyFlowSpec("0:rateFilter=median:100", flows), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(Counters)
+{
+  FlowCounters counters;
+  counters.onData(1000, 2_ms);
+  counters.onData(500, 4_ms);
+
+  auto first = counters.snapshot();
+  BOOST_CHECK_EQUAL(first.nData, 2);
+  BOOST_CHECK_EQUAL(first.nBytes, 1500);
+
+  counters.onData(100, 10_ms);
+  auto diff = counters.snapshot() - first;
+  BOOST_CHECK_EQUAL(diff.nData, 1);
+  BOOST_CHECK_EQUAL(diff.nBytes, 100);
+  BOOST_CHECK_EQUAL(counters.getDelayHistogram().snapshot().getCount(), 3);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestMultiFlow
+BOOST_AUTO_TEST_SUITE_END() // Cc
+
+} // namespace tests
+} // namespace client
+} // namespace cc
+} // namespace ndn
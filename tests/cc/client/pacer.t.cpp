@@ -0,0 +1,154 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tools/cc/client/pacer.hpp"
+
+#include "tests/test-common.hpp"
+
+namespace ndn {
+namespace cc {
+namespace client {
+namespace tests {
+
+BOOST_AUTO_TEST_SUITE(Cc)
+BOOST_AUTO_TEST_SUITE(TestPacer)
+
+class PacerFixture : public UnitTestTimeFixture
+{
+protected:
+  /**
+   * \brief Runs \p pacer at \p rate for \p duration in steps of \p tick of simulated time
+   * \return the number of packets released
+   */
+  uint64_t
+  runFor(Pacer& pacer, double rate, time::nanoseconds tick, time::nanoseconds duration)
+  {
+    uint64_t nSent = 0;
+    pacer.setRate(rate);
+    pacer.start([&] {
+      ++nSent;
+      return true;
+    });
+    advanceClocks(io, tick, duration);
+    pacer.stop();
+    return nSent;
+  }
+
+protected:
+  boost::asio::io_service io;
+};
+
+BOOST_FIXTURE_TEST_CASE(FirstPacketAtZeroRate, PacerFixture)
+{
+  Pacer pacer(io, {});
+  BOOST_CHECK_EQUAL(runFor(pacer, 0, 1_ms, 20_ms), 1);
+  BOOST_CHECK_EQUAL(pacer.getNWakeups(), 0);
+}
+
+BOOST_FIXTURE_TEST_CASE(StopFromCallback, PacerFixture)
+{
+  Pacer pacer(io, {4, false});
+  pacer.setRate(100000);
+
+  int nCalls = 0;
+  pacer.start([&] { return ++nCalls < 10; });
+  advanceClocks(io, 10_us, 1_ms);
+  BOOST_CHECK_EQUAL(nCalls, 10);
+  BOOST_CHECK_EQUAL(pacer.getNSent(), 9);
+  BOOST_CHECK(!pacer.isRunning());
+}
+
+BOOST_FIXTURE_TEST_CASE(Rate, PacerFixture)
+{
+  Pacer pacer(io, {1, false});
+  // the first packet, then one every 500 us
+  BOOST_CHECK_EQUAL(runFor(pacer, 2000, 100_us, 250_ms), 501);
+  BOOST_CHECK_EQUAL(pacer.getNWakeups(), 500);
+}
+
+BOOST_FIXTURE_TEST_CASE(Bursts, PacerFixture)
+{
+  Pacer pacer(io, {16, false});
+  // one wakeup per burst of 16, every 250 us
+  BOOST_CHECK_EQUAL(runFor(pacer, 64000, 50_us, 250_ms), 16001);
+  BOOST_CHECK_EQUAL(pacer.getNWakeups(), 1000);
+}
+
+BOOST_FIXTURE_TEST_CASE(LateWakeups, PacerFixture)
+{
+  Pacer pacer(io, {16, false});
+  // wakeups 1 ms apart find 64 credits, capped at two bursts
+  BOOST_CHECK_EQUAL(runFor(pacer, 64000, 1_ms, 250_ms), 8001);
+  BOOST_CHECK_EQUAL(pacer.getNWakeups(), 250);
+}
+
+BOOST_FIXTURE_TEST_CASE(BusyPoll, PacerFixture)
+{
+  Pacer pacer(io, {8, true});
+  pacer.setRate(200000);
+
+  uint64_t nSent = 0;
+  pacer.start([&] {
+    ++nSent;
+    return true;
+  });
+  // the pacer re-posts itself while spinning, and simulated time only moves between handlers
+  for (int i = 0; i < 200000; ++i) {
+    steadyClock->advance(1_us);
+    io.poll_one();
+  }
+  pacer.stop();
+
+  // bursts of 8 complete every 40 us
+  BOOST_CHECK_EQUAL(nSent, 40001);
+}
+
+BOOST_FIXTURE_TEST_CASE(RateIncrease, PacerFixture)
+{
+  Pacer pacer(io, {1, false});
+  pacer.setRate(1);
+
+  uint64_t nSent = 0;
+  pacer.start([&] {
+    ++nSent;
+    return true;
+  });
+  advanceClocks(io, 1_ms, 10_ms);
+  BOOST_CHECK_EQUAL(nSent, 1);
+
+  // the wakeup one second away is re-armed for the new rate
+  pacer.setRate(1000);
+  advanceClocks(io, 100_us, 100_ms);
+  pacer.stop();
+  BOOST_CHECK_EQUAL(nSent, 101);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestPacer
+BOOST_AUTO_TEST_SUITE_END() // Cc
+
+} // namespace tests
+} // namespace client
+} // namespace cc
+} // namespace ndn
@@ -0,0 +1,155 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tools/cc/client/rate-filter.hpp"
+
+#include "tests/test-common.hpp"
+
+#include <cmath>
+
+namespace ndn {
+namespace cc {
+namespace client {
+namespace tests {
+
+BOOST_AUTO_TEST_SUITE(Cc)
+BOOST_AUTO_TEST_SUITE(TestRateFilter)
+
+// Feeds @p filter with @p sample at @p packetRate for @p duration and returns the filtered rate.
+static double
+feed(RateFilter& filter, time::steady_clock::TimePoint& now, double sample,
+     double packetRate, time::milliseconds duration)
+{
+  auto interval = time::nanoseconds(static_cast<time::nanoseconds::rep>(1e9 / packetRate));
+  auto end = now + duration;
+  double rate = filter.get();
+  for (; now < end; now += interval) {
+    rate = filter.update(sample, now);
+  }
+  return rate;
+}
+
+BOOST_AUTO_TEST_CASE(Create)
+{
+  BOOST_CHECK(dynamic_cast<SampleEwmaFilter*>(RateFilter::create("ewma").get()) != nullptr);
+  BOOST_CHECK(dynamic_cast<SampleEwmaFilter*>(RateFilter::create("ewma:0.5").get()) != nullptr);
+  BOOST_CHECK(dynamic_cast<TimeEwmaFilter*>(RateFilter::create("time-ewma:100").get()) != nullptr);
+  BOOST_CHECK(dynamic_cast<WindowedFilter*>(RateFilter::create("max:1000").get()) != nullptr);
+  BOOST_CHECK(dynamic_cast<WindowedFilter*>(RateFilter::create("min:1000").get()) != nullptr);
+  BOOST_CHECK(dynamic_cast<KalmanFilter*>(RateFilter::create("kalman:200").get()) != nullptr);
+  BOOST_CHECK(dynamic_cast<KalmanFilter*>(RateFilter::create("kalman:200,0.05").get()) != nullptr);
+
+  BOOST_CHECK_THROW(RateFilter::create("median:100"), std::invalid_argument);
+  BOOST_CHECK_THROW(RateFilter::create("ewma:2"), std::invalid_argument);
+  BOOST_CHECK_THROW(RateFilter::create("time-ewma"), std::invalid_argument);
+  BOOST_CHECK_THROW(RateFilter::create("time-ewma:0"), std::invalid_argument);
+  BOOST_CHECK_THROW(RateFilter::create("max:abc"), std::invalid_argument);
+  BOOST_CHECK_THROW(RateFilter::create("kalman:200,-1"), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(SampleEwma)
+{
+  // the historical 0.8 * rate + 0.2 * sample, starting from the first sample
+  SampleEwmaFilter filter;
+  auto now = time::steady_clock::now();
+  BOOST_CHECK_EQUAL(filter.update(1000, now), 1000);
+  BOOST_CHECK_CLOSE(filter.update(2000, now), 1200, 1e-9);
+  BOOST_CHECK_CLOSE(filter.update(2000, now), 1360, 1e-9);
+
+  filter.reset(500, now);
+  BOOST_CHECK_CLOSE(filter.update(1000, now), 600, 1e-9);
+}
+
+BOOST_AUTO_TEST_CASE(TimeEwmaConvergesInTime)
+{
+  // after a step, the estimate covers 1 - e^-1 of it within one time constant at any packet rate
+  for (double packetRate : {1e3, 1e4, 1e5}) {
+    TimeEwmaFilter filter(100_ms);
+    auto now = time::steady_clock::now();
+    filter.reset(1e6, now);
+    double rate = feed(filter, now, 2e6, packetRate, 100_ms);
+    BOOST_CHECK_CLOSE(rate, 1e6 + 1e6 * (1 - std::exp(-1.0)), 1.0);
+    rate = feed(filter, now, 2e6, packetRate, 400_ms);
+    BOOST_CHECK_CLOSE(rate, 2e6, 1.0);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(WindowedMax)
+{
+  WindowedFilter filter(100_ms, true);
+  auto now = time::steady_clock::now();
+  BOOST_CHECK_EQUAL(filter.update(5e6, now), 5e6);
+
+  // lower samples do not replace the maximum while it is in the window
+  double rate = feed(filter, now, 3e6, 1e4, 90_ms);
+  BOOST_CHECK_EQUAL(rate, 5e6);
+
+  // it expires afterwards
+  rate = feed(filter, now, 3e6, 1e4, 200_ms);
+  BOOST_CHECK_EQUAL(rate, 3e6);
+
+  BOOST_CHECK_EQUAL(filter.update(4e6, now), 4e6);
+}
+
+BOOST_AUTO_TEST_CASE(WindowedMin)
+{
+  WindowedFilter filter(100_ms, false);
+  auto now = time::steady_clock::now();
+  filter.update(1e6, now);
+  BOOST_CHECK_EQUAL(feed(filter, now, 3e6, 1e4, 90_ms), 1e6);
+  BOOST_CHECK_EQUAL(feed(filter, now, 3e6, 1e4, 200_ms), 3e6);
+  BOOST_CHECK_EQUAL(filter.update(2e6, now), 2e6);
+}
+
+BOOST_AUTO_TEST_CASE(Kalman)
+{
+  KalmanFilter filter(100_ms, 0.1);
+  auto now = time::steady_clock::now();
+  BOOST_CHECK_EQUAL(filter.update(1e6, now), 1e6);
+
+  double rate = feed(filter, now, 2e6, 1e4, 50_ms);
+  BOOST_CHECK_GT(rate, 1e6);
+  rate = feed(filter, now, 2e6, 1e4, 500_ms);
+  BOOST_CHECK_CLOSE(rate, 2e6, 1.0);
+
+  // a sample after a long silence weighs more than one in a dense stream
+  double before = filter.get();
+  now += 1_s;
+  double afterSilence = filter.update(1e6, now) - before;
+  KalmanFilter dense(100_ms, 0.1);
+  auto t = time::steady_clock::now();
+  dense.reset(2e6, t);
+  feed(dense, t, 2e6, 1e4, 500_ms);
+  double afterDense = dense.update(1e6, t) - 2e6;
+  BOOST_CHECK_LT(afterSilence, afterDense);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestRateFilter
+BOOST_AUTO_TEST_SUITE_END() // Cc
+
+} // namespace tests
+} // namespace client
+} // namespace cc
+} // namespace ndn
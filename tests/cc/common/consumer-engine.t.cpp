@@ -0,0 +1,197 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tools/cc/common/consumer-engine.hpp"
+
+#include "tests/test-common.hpp"
+#include <ndn-cxx/util/dummy-client-face.hpp>
+
+namespace ndn {
+namespace cc {
+namespace tests {
+
+using namespace ndn::tests;
+
+BOOST_AUTO_TEST_SUITE(Cc)
+BOOST_AUTO_TEST_SUITE(TestConsumerEngine)
+
+/**
+ * \brief Controller sending one Interest every 10 ms
+ */
+template<bool RTO>
+class PollingConsumer : public ConsumerEngine<PollingConsumer<RTO>>
+{
+public:
+  using Engine = ConsumerEngine<PollingConsumer<RTO>>;
+
+  static constexpr bool USE_RTO_TIMERS = RTO;
+
+  PollingConsumer(Face& face, const ConsumerOptions& options)
+    : Engine(face, options)
+  {
+  }
+
+  void
+  scheduleNextPacket()
+  {
+    if (!this->m_stopFlag && !this->m_nextInterestEvent) {
+      this->m_nextInterestEvent = this->m_scheduler.schedule(10_ms, [this] { this->sendPacket(); });
+    }
+  }
+
+  void
+  onData(const Data& data, uint64_t seq, const SendInfo& info)
+  {
+    if (info.isRetx) {
+      retxDataSeqs.push_back(seq);
+    }
+    Engine::onData(data, seq, info);
+  }
+
+  void
+  onSequenceExhausted()
+  {
+    ++nExhausted;
+  }
+
+public:
+  std::vector<uint64_t> retxDataSeqs;
+  int nExhausted = 0;
+};
+
+template<bool RTO>
+constexpr bool PollingConsumer<RTO>::USE_RTO_TIMERS;
+
+class ConsumerEngineFixture : public UnitTestTimeFixture
+{
+protected:
+  ConsumerEngineFixture()
+    : face(io, {true, true})
+  {
+    options.prefix = "/cc/engine";
+    options.startSeq = 10;
+    options.lifetime = 4_s;
+    options.seqMax = 13;
+    options.tos = 0;
+    options.dsz = 1000;
+    options.printSamples = false;
+  }
+
+  ~ConsumerEngineFixture()
+  {
+    face.shutdown();
+    io.stop();
+  }
+
+  void
+  receive(uint64_t seq)
+  {
+    face.receive(*makeData(Name(options.prefix).appendNumber(seq)));
+    advanceClocks(io, 1_ms);
+  }
+
+protected:
+  boost::asio::io_service io;
+  util::DummyClientFace face;
+  ConsumerOptions options;
+};
+
+BOOST_FIXTURE_TEST_CASE(Naming, ConsumerEngineFixture)
+{
+  PollingConsumer<true> consumer(face, options);
+  consumer.start();
+  advanceClocks(io, 1_ms, 50);
+
+  BOOST_REQUIRE_EQUAL(face.sentInterests.size(), 3);
+  for (size_t i = 0; i < face.sentInterests.size(); ++i) {
+    BOOST_CHECK_EQUAL(face.sentInterests[i].getName(), Name(options.prefix).appendNumber(10 + i));
+    BOOST_CHECK_EQUAL(face.sentInterests[i].getInterestLifetime(), 4_s);
+  }
+  BOOST_CHECK_GT(consumer.nExhausted, 0);
+
+  consumer.stop();
+}
+
+BOOST_FIXTURE_TEST_CASE(RtoRetransmission, ConsumerEngineFixture)
+{
+  PollingConsumer<true> consumer(face, options);
+  std::vector<uint64_t> timeoutSeqs;
+  consumer.afterTimeout.connect([&] (uint64_t seq) { timeoutSeqs.push_back(seq); });
+  consumer.start();
+  advanceClocks(io, 1_ms, 40);
+  BOOST_REQUIRE_EQUAL(face.sentInterests.size(), 3);
+
+  receive(10);
+  receive(12);
+  BOOST_CHECK(timeoutSeqs.empty());
+
+  // the RTT samples of 10 and 12 bring the RTO down to its 200 ms minimum
+  advanceClocks(io, 10_ms, 30);
+  BOOST_REQUIRE_EQUAL(timeoutSeqs.size(), 1);
+  BOOST_CHECK_EQUAL(timeoutSeqs[0], 11);
+  BOOST_REQUIRE_EQUAL(face.sentInterests.size(), 4);
+  BOOST_CHECK_EQUAL(face.sentInterests[3].getName(), Name(options.prefix).appendNumber(11));
+
+  // Data satisfying both transmissions of 11 is counted once
+  receive(11);
+  BOOST_CHECK_EQUAL(consumer.getCounters().snapshot().nData, 3);
+  BOOST_CHECK_EQUAL(consumer.retxDataSeqs.size(), 1);
+  BOOST_CHECK_EQUAL(consumer.retxDataSeqs.at(0), 11);
+
+  consumer.stop();
+}
+
+BOOST_FIXTURE_TEST_CASE(LifetimeRetransmission, ConsumerEngineFixture)
+{
+  options.lifetime = 2_s;
+  options.seqMax = 11;
+  PollingConsumer<false> consumer(face, options);
+  std::vector<uint64_t> timeoutSeqs;
+  consumer.afterTimeout.connect([&] (uint64_t seq) { timeoutSeqs.push_back(seq); });
+  consumer.start();
+
+  advanceClocks(io, 10_ms, 150);
+  BOOST_CHECK(timeoutSeqs.empty());
+  BOOST_CHECK_EQUAL(face.sentInterests.size(), 1);
+
+  advanceClocks(io, 10_ms, 60);
+  BOOST_REQUIRE_EQUAL(timeoutSeqs.size(), 1);
+  BOOST_CHECK_EQUAL(timeoutSeqs[0], 10);
+  BOOST_REQUIRE_EQUAL(face.sentInterests.size(), 2);
+  BOOST_CHECK_EQUAL(face.sentInterests[1].getName(), Name(options.prefix).appendNumber(10));
+
+  receive(10);
+  BOOST_CHECK_EQUAL(consumer.getCounters().snapshot().nData, 1);
+  BOOST_CHECK_EQUAL(consumer.retxDataSeqs.size(), 1);
+
+  consumer.stop();
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestConsumerEngine
+BOOST_AUTO_TEST_SUITE_END() // Cc
+
+} // namespace tests
+} // namespace cc
+} // namespace ndn
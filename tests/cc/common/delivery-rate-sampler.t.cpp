@@ -0,0 +1,116 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tools/cc/common/delivery-rate-sampler.hpp"
+
+#include "tests/test-common.hpp"
+
+namespace ndn {
+namespace cc {
+namespace tests {
+
+BOOST_AUTO_TEST_SUITE(Cc)
+BOOST_AUTO_TEST_SUITE(TestDeliveryRateSampler)
+
+BOOST_AUTO_TEST_CASE(SteadyFlow)
+{
+  // one 1000-byte Data per ms over a 10 ms RTT, 10 Interests in flight: 1 MB/s
+  auto start = time::steady_clock::TimePoint(time::seconds(1));
+  DeliveryRateSampler sampler(start);
+  std::vector<DeliverySnapshot> snapshots;
+
+  for (int i = 0; i < 100; ++i) {
+    auto now = start + time::milliseconds(i);
+    if (i >= 10) {
+      auto sample = sampler.onDelivered(snapshots.at(i - 10), 1000, now);
+      if (i >= 20) {
+        // a full round trip of Data behind each sample
+        BOOST_CHECK_EQUAL(sample.delivered, 10000);
+        BOOST_CHECK_EQUAL(sample.interval, time::milliseconds(10));
+        BOOST_CHECK_CLOSE(sample.deliveryRate, 1e6, 1e-9);
+        BOOST_CHECK_EQUAL(sample.txInFlight, 10000);
+      }
+    }
+    uint64_t inFlight = std::min(i, 10) * 1000 - (i >= 10 ? 1000 : 0);
+    snapshots.push_back(sampler.onSend(now, inFlight, 1000));
+  }
+  BOOST_CHECK_EQUAL(sampler.getDelivered(), 90000);
+}
+
+BOOST_AUTO_TEST_CASE(AckCompression)
+{
+  // 10 Interests sent 1 ms apart, whose Data arrive in a burst after 20 ms
+  auto start = time::steady_clock::TimePoint(time::seconds(1));
+  DeliveryRateSampler sampler(start);
+  std::vector<DeliverySnapshot> snapshots;
+  for (int i = 0; i < 10; ++i) {
+    snapshots.push_back(sampler.onSend(start + time::milliseconds(i), i * 1000, 1000));
+  }
+
+  auto burst = start + time::milliseconds(20);
+  RateSample sample;
+  for (int i = 0; i < 10; ++i) {
+    sample = sampler.onDelivered(snapshots[i], 1000, burst);
+  }
+  // the send interval (9 ms) is shorter than the arrival interval (20 ms) of the last sample
+  BOOST_CHECK_EQUAL(sample.delivered, 10000);
+  BOOST_CHECK_EQUAL(sample.interval, time::milliseconds(20));
+  BOOST_CHECK_CLOSE(sample.deliveryRate, 5e5, 1e-9);
+
+  // the next Interest measures from the burst, not from the Data that arrived all at once
+  auto next = sampler.onSend(burst, 0, 1000);
+  sample = sampler.onDelivered(next, 1000, burst + time::milliseconds(10));
+  BOOST_CHECK_EQUAL(sample.delivered, 1000);
+  BOOST_CHECK_EQUAL(sample.interval, time::milliseconds(10));
+}
+
+BOOST_AUTO_TEST_CASE(AppLimited)
+{
+  auto start = time::steady_clock::TimePoint(time::seconds(1));
+  DeliveryRateSampler sampler(start);
+  auto first = sampler.onSend(start, 0, 1000);
+  BOOST_CHECK(!first.isAppLimited);
+
+  // nothing more to send while 2000 bytes are in flight
+  auto second = sampler.onSend(start, 1000, 1000);
+  sampler.onAppLimited(2000);
+  BOOST_CHECK(sampler.isAppLimited());
+  auto third = sampler.onSend(start + time::milliseconds(1), 2000, 1000);
+  BOOST_CHECK(third.isAppLimited);
+
+  BOOST_CHECK(!sampler.onDelivered(first, 1000, start + time::milliseconds(10)).isAppLimited);
+  BOOST_CHECK(!sampler.onDelivered(second, 1000, start + time::milliseconds(10)).isAppLimited);
+  BOOST_CHECK(sampler.isAppLimited());
+  BOOST_CHECK(sampler.onDelivered(third, 1000, start + time::milliseconds(11)).isAppLimited);
+  // past the bytes in flight when the consumer ran out of Interests
+  BOOST_CHECK(!sampler.isAppLimited());
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestDeliveryRateSampler
+BOOST_AUTO_TEST_SUITE_END() // Cc
+
+} // namespace tests
+} // namespace cc
+} // namespace ndn
@@ -0,0 +1,300 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tools/cc/common/emulated-link.hpp"
+
+#include "tests/test-common.hpp"
+#include <ndn-cxx/lp/packet.hpp>
+
+namespace ndn {
+namespace cc {
+namespace tests {
+
+using namespace ndn::tests;
+
+BOOST_AUTO_TEST_SUITE(Cc)
+BOOST_AUTO_TEST_SUITE(TestEmulatedLink)
+
+class EmulatedLinkFixture : public UnitTestTimeFixture
+{
+protected:
+  /**
+   * \brief Creates the link and connects both of its ends
+   */
+  void
+  connect(const EmulatedLink::Options& options)
+  {
+    link = make_unique<EmulatedLink>(io, options);
+    for (size_t end = 0; end < 2; ++end) {
+      auto transport = link->getTransport(end);
+      transport->connect(io, [this, end] (const Block& wire) {
+        received[end].push_back(wire);
+        receiveTimes[end].push_back(time::steady_clock::now());
+      });
+      transport->resume();
+    }
+  }
+
+  /**
+   * \brief Sends \p n Data carrying \p payloadSize bytes from end 1 to end 0
+   */
+  void
+  sendData(size_t n, size_t payloadSize = 1000)
+  {
+    std::vector<uint8_t> payload(payloadSize);
+    for (size_t i = 0; i < n; ++i) {
+      auto data = makeData(Name("/cc/link").appendNumber(i));
+      data->setContent(payload.data(), payload.size());
+      signData(data);
+      link->getTransport(1)->send(data->wireEncode());
+    }
+  }
+
+  static bool
+  isMarked(const Block& wire)
+  {
+    lp::Packet packet(wire);
+    return packet.has<lp::CongestionMarkField>() && packet.get<lp::CongestionMarkField>() > 0;
+  }
+
+protected:
+  boost::asio::io_service io;
+  unique_ptr<EmulatedLink> link;
+  std::vector<Block> received[2];
+  std::vector<time::steady_clock::TimePoint> receiveTimes[2];
+};
+
+BOOST_AUTO_TEST_CASE(ParseOptions)
+{
+  auto options = EmulatedLink::parseOptions("bw=100,delay=20,queue=50,loss=0.01,aqm=codel,target=2.5,seed=7");
+  BOOST_CHECK_EQUAL(options.bandwidth, 100e6);
+  BOOST_CHECK_EQUAL(options.delay, 20_ms);
+  BOOST_CHECK_EQUAL(options.queueSize, 50);
+  BOOST_CHECK_EQUAL(options.lossRate, 0.01);
+  BOOST_CHECK_EQUAL(options.aqm, EmulatedLink::CODEL);
+  BOOST_CHECK_EQUAL(options.codelTarget, 2500_us);
+  BOOST_CHECK_EQUAL(options.codelInterval, 100_ms);
+  BOOST_CHECK_EQUAL(options.seed, 7);
+
+  BOOST_CHECK_EQUAL(EmulatedLink::parseOptions("").bandwidth, 0);
+  BOOST_CHECK_THROW(EmulatedLink::parseOptions("bw"), std::invalid_argument);
+  BOOST_CHECK_THROW(EmulatedLink::parseOptions("bw=fast"), std::invalid_argument);
+  BOOST_CHECK_THROW(EmulatedLink::parseOptions("loss=2"), std::invalid_argument);
+  BOOST_CHECK_THROW(EmulatedLink::parseOptions("queue=0"), std::invalid_argument);
+  BOOST_CHECK_THROW(EmulatedLink::parseOptions("aqm=red"), std::invalid_argument);
+  BOOST_CHECK_THROW(EmulatedLink::parseOptions("jitter=1"), std::invalid_argument);
+}
+
+BOOST_FIXTURE_TEST_CASE(SerializationAndDelay, EmulatedLinkFixture)
+{
+  EmulatedLink::Options options;
+  options.bandwidth = 8e6; // one byte per microsecond
+  options.delay = 10_ms;
+  connect(options);
+
+  auto start = time::steady_clock::now();
+  sendData(2);
+  advanceClocks(io, 100_us, 300);
+
+  BOOST_REQUIRE_EQUAL(received[0].size(), 2);
+  BOOST_CHECK(received[1].empty());
+  // the second packet waits for the first one to be serialized, which is seen at the next tick
+  auto size = received[0][0].size();
+  BOOST_CHECK_GE(receiveTimes[0][0] - start, 10_ms + time::microseconds(size));
+  BOOST_CHECK_LT(receiveTimes[0][0] - start, 10_ms + time::microseconds(size) + 100_us);
+  BOOST_CHECK_GE(receiveTimes[0][1] - start, 10_ms + time::microseconds(2 * size));
+  BOOST_CHECK_LT(receiveTimes[0][1] - start, 10_ms + time::microseconds(2 * size) + 200_us);
+
+  BOOST_CHECK_EQUAL(link->getStats(1).nDelivered, 2);
+  BOOST_CHECK_EQUAL(link->getStats(1).nBytesDelivered, 2 * size);
+  BOOST_CHECK_EQUAL(link->getStats(0).nSent, 0);
+}
+
+BOOST_FIXTURE_TEST_CASE(HeaderAndPayload, EmulatedLinkFixture)
+{
+  connect({});
+
+  auto data = makeData("/cc/link/split");
+  lp::Packet packet;
+  packet.add<lp::CongestionMarkField>(1);
+  packet.add<lp::FragmentField>(std::make_pair(data->wireEncode().begin(), data->wireEncode().end()));
+  Block wire = packet.wireEncode();
+  wire.parse();
+
+  // the header announces the length of the whole packet, of which the payload is the Fragment
+  const Block& fragment = wire.elements().back();
+  Block header(wire.getBuffer(), wire.begin(), fragment.begin(), false);
+  link->getTransport(1)->send(header, fragment);
+  advanceClocks(io, 1_ms, 10);
+
+  BOOST_REQUIRE_EQUAL(received[0].size(), 1);
+  BOOST_CHECK(received[0][0] == wire);
+  BOOST_CHECK(isMarked(received[0][0]));
+  BOOST_CHECK_EQUAL(link->getStats(1).nDelivered, 1);
+}
+
+BOOST_FIXTURE_TEST_CASE(TailDrop, EmulatedLinkFixture)
+{
+  EmulatedLink::Options options;
+  options.bandwidth = 8e6;
+  options.queueSize = 2;
+  connect(options);
+
+  // one packet is being serialized while two wait in the queue
+  sendData(5);
+  advanceClocks(io, 1_ms, 10);
+
+  BOOST_CHECK_EQUAL(received[0].size(), 3);
+  BOOST_CHECK_EQUAL(link->getStats(1).nSent, 5);
+  BOOST_CHECK_EQUAL(link->getStats(1).nDropped, 2);
+  BOOST_CHECK_EQUAL(link->getStats(1).maxQueueLength, 2);
+}
+
+BOOST_FIXTURE_TEST_CASE(RandomLoss, EmulatedLinkFixture)
+{
+  EmulatedLink::Options options;
+  options.lossRate = 0.2;
+  options.seed = 42;
+  connect(options);
+
+  sendData(1000, 10);
+  advanceClocks(io, 1_ms);
+
+  const auto& stats = link->getStats(1);
+  BOOST_CHECK_EQUAL(stats.nLost + stats.nDelivered, 1000);
+  BOOST_CHECK_GT(stats.nLost, 150);
+  BOOST_CHECK_LT(stats.nLost, 250);
+  BOOST_CHECK_EQUAL(received[0].size(), stats.nDelivered);
+
+  // the same seed loses the same packets
+  auto nLost = stats.nLost;
+  connect(options);
+  sendData(1000, 10);
+  advanceClocks(io, 1_ms);
+  BOOST_CHECK_EQUAL(link->getStats(1).nLost, nLost);
+}
+
+BOOST_FIXTURE_TEST_CASE(StepMarking, EmulatedLinkFixture)
+{
+  EmulatedLink::Options options;
+  options.bandwidth = 8e6;
+  options.aqm = EmulatedLink::STEP;
+  options.markThreshold = 2;
+  connect(options);
+
+  // the queue holds 4, 3, 2 and 1 packets as the second to the fifth leave it
+  sendData(5);
+  advanceClocks(io, 1_ms, 10);
+
+  BOOST_REQUIRE_EQUAL(received[0].size(), 5);
+  std::vector<bool> marks;
+  for (const auto& wire : received[0]) {
+    marks.push_back(isMarked(wire));
+  }
+  std::vector<bool> expected{false, true, true, false, false};
+  BOOST_CHECK_EQUAL_COLLECTIONS(marks.begin(), marks.end(), expected.begin(), expected.end());
+  BOOST_CHECK_EQUAL(link->getStats(1).nMarked, 2);
+
+  // a marked packet still carries the Data
+  auto fragment = lp::Packet(received[0][1]).get<lp::FragmentField>();
+  Data data(Block(&*fragment.first, std::distance(fragment.first, fragment.second)));
+  BOOST_CHECK_EQUAL(data.getName(), Name("/cc/link").appendNumber(1));
+}
+
+BOOST_FIXTURE_TEST_CASE(CodelMarking, EmulatedLinkFixture)
+{
+  EmulatedLink::Options options;
+  options.bandwidth = 8e6;
+  options.aqm = EmulatedLink::CODEL;
+  connect(options);
+
+  // a burst draining within an interval is not marked
+  sendData(50);
+  advanceClocks(io, 1_ms, 60);
+  BOOST_CHECK_EQUAL(link->getStats(1).nMarked, 0);
+
+  // twice the link bandwidth for 200 ms builds a standing queue
+  for (int i = 0; i < 40; ++i) {
+    sendData(10);
+    advanceClocks(io, 1_ms, 5);
+  }
+  advanceClocks(io, 1_ms, 400);
+
+  const auto& stats = link->getStats(1);
+  BOOST_CHECK_EQUAL(stats.nDelivered, 450);
+  BOOST_CHECK_GT(stats.nMarked, 0);
+  BOOST_CHECK_LT(stats.nMarked, stats.nDelivered / 4);
+  size_t nMarked = std::count_if(received[0].begin(), received[0].end(), &isMarked);
+  BOOST_CHECK_EQUAL(nMarked, stats.nMarked);
+
+  // once the queue has drained, marking stops
+  sendData(1);
+  advanceClocks(io, 1_ms, 5);
+  BOOST_CHECK_EQUAL(stats.nMarked, nMarked);
+}
+
+BOOST_FIXTURE_TEST_CASE(PrefixRegistration, EmulatedLinkFixture)
+{
+  EmulatedLink::Options options;
+  options.delay = 5_ms;
+  link = make_unique<EmulatedLink>(io, options);
+  KeyChain keyChain("pib-memory:", "tpm-memory:");
+  Face consumer(link->getTransport(0), io, keyChain);
+  Face producer(link->getTransport(1), io, keyChain);
+
+  bool isRegistered = false;
+  producer.setInterestFilter("/cc/link",
+                             [&] (const auto&, const Interest& interest) {
+                               producer.put(*makeData(interest.getName()));
+                             },
+                             [&] (const Name&) { isRegistered = true; },
+                             [] (const Name&, const std::string& reason) {
+                               BOOST_ERROR("registration failed: " << reason);
+                             });
+  advanceClocks(io, 1_ms, 10);
+  BOOST_CHECK(isRegistered);
+  // management commands do not cross the link
+  BOOST_CHECK_EQUAL(link->getStats(1).nSent, 0);
+
+  bool hasData = false;
+  consumer.expressInterest(*makeInterest("/cc/link/1"),
+                           [&] (const Interest&, const Data&) { hasData = true; },
+                           [] (const auto&, const auto&) {},
+                           [] (const auto&) {});
+  // the Interest and the Data each cross the 5 ms link
+  advanceClocks(io, 1_ms, 8);
+  BOOST_CHECK(!hasData);
+  advanceClocks(io, 1_ms, 10);
+  BOOST_CHECK(hasData);
+  BOOST_CHECK_EQUAL(link->getStats(0).nDelivered, 1);
+  BOOST_CHECK_EQUAL(link->getStats(1).nDelivered, 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestEmulatedLink
+BOOST_AUTO_TEST_SUITE_END() // Cc
+
+} // namespace tests
+} // namespace cc
+} // namespace ndn
@@ -0,0 +1,106 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tools/cc/common/interest-template.hpp"
+
+#include "tests/test-common.hpp"
+
+#include <set>
+
+namespace ndn {
+namespace cc {
+namespace tests {
+
+BOOST_AUTO_TEST_SUITE(Cc)
+BOOST_AUTO_TEST_SUITE(TestInterestTemplate)
+
+static Interest
+makePrototype(const Name& prefix)
+{
+  Interest interest(prefix);
+  interest.setCanBePrefix(false);
+  interest.setMustBeFresh(true);
+  interest.setServiceClass(3);
+  interest.setDsz(8624);
+  interest.setInterestLifetime(4_s);
+  return interest;
+}
+
+BOOST_AUTO_TEST_CASE(MatchesEncoding)
+{
+  Interest prototype = makePrototype("/cc/template");
+  InterestTemplate interestTemplate(prototype);
+
+  // sequence numbers around every NonNegativeInteger size boundary
+  for (uint64_t seq : {0ULL, 1ULL, 255ULL, 256ULL, 65535ULL, 65536ULL, 4294967295ULL, 4294967296ULL}) {
+    Interest built = interestTemplate.makeInterest(seq);
+    Interest encoded = interestTemplate.encodeInterest(seq);
+
+    BOOST_CHECK_EQUAL(built.getName(), Name("/cc/template").appendNumber(seq));
+    BOOST_CHECK_EQUAL(built.getName().at(-1).toNumber(), seq);
+    BOOST_CHECK_EQUAL(built.getCanBePrefix(), false);
+    BOOST_CHECK_EQUAL(built.getMustBeFresh(), true);
+    BOOST_CHECK_EQUAL(built.getInterestLifetime(), 4_s);
+    BOOST_CHECK(built.getServiceClass() == prototype.getServiceClass());
+    BOOST_CHECK(built.getDsz() == prototype.getDsz());
+
+    // identical up to the Nonce
+    encoded.setNonce(built.getNonce());
+    BOOST_CHECK(built.wireEncode() == encoded.wireEncode());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(FreshNonce)
+{
+  InterestTemplate interestTemplate(makePrototype("/cc/template/nonce"));
+
+  std::set<uint32_t> nonces;
+  for (int i = 0; i < 100; ++i) {
+    nonces.insert(interestTemplate.makeInterest(42).getNonce());
+  }
+  // 100 random 32-bit values hardly ever collide
+  BOOST_CHECK_GE(nonces.size(), 99);
+}
+
+BOOST_AUTO_TEST_CASE(LargePrefix)
+{
+  // a Name long enough to need a multi-byte TLV length in front of it
+  Name prefix("/cc/template");
+  prefix.append(std::string(300, 'n'));
+  InterestTemplate interestTemplate(makePrototype(prefix));
+
+  Interest built = interestTemplate.makeInterest(7);
+  Interest encoded = interestTemplate.encodeInterest(7);
+  BOOST_CHECK_EQUAL(built.getName(), Name(prefix).appendNumber(7));
+  encoded.setNonce(built.getNonce());
+  BOOST_CHECK(built.wireEncode() == encoded.wireEncode());
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestInterestTemplate
+BOOST_AUTO_TEST_SUITE_END() // Cc
+
+} // namespace tests
+} // namespace cc
+} // namespace ndn
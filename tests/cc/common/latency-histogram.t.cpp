@@ -0,0 +1,103 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tools/cc/common/latency-histogram.hpp"
+
+#include "tests/test-common.hpp"
+
+namespace ndn {
+namespace cc {
+namespace tests {
+
+BOOST_AUTO_TEST_SUITE(Cc)
+BOOST_AUTO_TEST_SUITE(TestLatencyHistogram)
+
+BOOST_AUTO_TEST_CASE(Buckets)
+{
+  size_t lastBucket = 0;
+  for (uint64_t value : {1ULL, 255ULL, 256ULL, 257ULL, 1000ULL, 123456789ULL, ~0ULL}) {
+    size_t bucket = LatencyHistogram::getBucket(value);
+    BOOST_CHECK_LT(bucket, LatencyHistogram::N_BUCKETS);
+    BOOST_CHECK_GE(bucket, lastBucket);
+    lastBucket = bucket;
+
+    // the value lies within its bucket, and the bucket is at most 1% wide
+    uint64_t upper = LatencyHistogram::getUpperEdge(bucket);
+    BOOST_CHECK_GE(upper, value);
+    BOOST_CHECK_LT(LatencyHistogram::getUpperEdge(bucket - 1), value);
+    BOOST_CHECK_LE(upper - value, upper / 100);
+  }
+  BOOST_CHECK_EQUAL(LatencyHistogram::getBucket(0), 0);
+  BOOST_CHECK_EQUAL(LatencyHistogram::getUpperEdge(LatencyHistogram::N_BUCKETS - 1), ~0ULL);
+}
+
+BOOST_AUTO_TEST_CASE(Percentiles)
+{
+  LatencyHistogram histogram;
+  BOOST_CHECK_EQUAL(histogram.snapshot().getPercentile(50), 0_ns);
+
+  for (int i = 1; i <= 10000; ++i) {
+    histogram.record(time::microseconds(i));
+  }
+  HistogramSnapshot snapshot = histogram.snapshot();
+  BOOST_CHECK_EQUAL(snapshot.getCount(), 10000);
+
+  auto near = [] (time::nanoseconds actual, time::nanoseconds expected) {
+    return actual >= expected && actual.count() <= expected.count() * 1.01;
+  };
+  BOOST_CHECK(near(snapshot.getPercentile(50), 5_ms));
+  BOOST_CHECK(near(snapshot.getPercentile(99), 9900_us));
+  BOOST_CHECK(near(snapshot.getPercentile(99.9), 9990_us));
+  BOOST_CHECK(near(snapshot.getMax(), 10_ms));
+}
+
+BOOST_AUTO_TEST_CASE(Intervals)
+{
+  LatencyHistogram histogram;
+  for (int i = 0; i < 100; ++i) {
+    histogram.record(1_us);
+  }
+  HistogramSnapshot first = histogram.snapshot();
+
+  for (int i = 0; i < 100; ++i) {
+    histogram.record(1_ms);
+  }
+  HistogramSnapshot interval = histogram.snapshot() - first;
+  BOOST_CHECK_EQUAL(interval.getCount(), 100);
+  BOOST_CHECK_GE(interval.getPercentile(1), 1_ms);
+
+  HistogramSnapshot total;
+  total += first;
+  total += interval;
+  BOOST_CHECK_EQUAL(total.getCount(), 200);
+  BOOST_CHECK_LT(total.getPercentile(50), 2_us);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestLatencyHistogram
+BOOST_AUTO_TEST_SUITE_END() // Cc
+
+} // namespace tests
+} // namespace cc
+} // namespace ndn
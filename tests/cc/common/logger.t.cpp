@@ -0,0 +1,175 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tools/cc/common/logger.hpp"
+
+#include "tests/test-common.hpp"
+
+#include <sstream>
+
+namespace ndn {
+namespace cc {
+namespace tests {
+
+BOOST_AUTO_TEST_SUITE(Cc)
+BOOST_AUTO_TEST_SUITE(TestLogger)
+
+BOOST_AUTO_TEST_CASE(RingOrderAndCapacity)
+{
+  RingBuffer<int> ring(5);
+  BOOST_CHECK_EQUAL(ring.capacity(), 8);
+
+  for (int i = 0; i < 8; ++i) {
+    BOOST_CHECK(ring.tryPush([i] (int& item) { item = i; }));
+  }
+  BOOST_CHECK(!ring.tryPush([] (int& item) { item = -1; }));
+
+  int item = 0;
+  for (int i = 0; i < 8; ++i) {
+    BOOST_REQUIRE(ring.tryPop(item));
+    BOOST_CHECK_EQUAL(item, i);
+  }
+  BOOST_CHECK(!ring.tryPop(item));
+
+  // positions wrap around
+  BOOST_CHECK(ring.tryPush([] (int& item) { item = 42; }));
+  BOOST_CHECK(ring.tryPop(item));
+  BOOST_CHECK_EQUAL(item, 42);
+}
+
+BOOST_AUTO_TEST_CASE(ParseLevel)
+{
+  BOOST_CHECK(parseLogLevel("none") == LogLevel::NONE);
+  BOOST_CHECK(parseLogLevel("trace") == LogLevel::TRACE);
+  BOOST_CHECK_THROW(parseLogLevel("verbose"), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(SyncText)
+{
+  std::ostringstream os;
+  Logger logger;
+  logger.configure(LogLevel::DEBUG, Logger::Backend::SYNC, make_unique<TextLogSink>(os));
+
+  BOOST_CHECK(logger.isEnabled(LogLevel::DEBUG));
+  BOOST_CHECK(!logger.isEnabled(LogLevel::TRACE));
+
+  logger.log(LogLevel::DEBUG, "onInterest", Name("/A/B"));
+  logger.log(LogLevel::DEBUG, "RTO", uint64_t(200));
+  logger.log(LogLevel::DEBUG, "note", "text");
+  BOOST_CHECK_EQUAL(os.str(), "onInterest: /A/B\nRTO: 200\nnote: text\n");
+}
+
+BOOST_AUTO_TEST_CASE(RingText)
+{
+  std::ostringstream os;
+  Logger logger;
+  logger.configure(LogLevel::TRACE, Logger::Backend::RING, make_unique<TextLogSink>(os), 1024, 1_ms);
+
+  for (uint64_t i = 0; i < 100; ++i) {
+    logger.log(LogLevel::TRACE, "seq", i);
+  }
+  logger.stop();
+
+  std::string expected;
+  for (uint64_t i = 0; i < 100; ++i) {
+    expected += "seq: " + to_string(i) + "\n";
+  }
+  BOOST_CHECK_EQUAL(os.str(), expected);
+  BOOST_CHECK_EQUAL(logger.getNDropped(), 0);
+}
+
+/**
+ * \brief Text sink whose writes block until released
+ */
+class BlockingLogSink : public TextLogSink
+{
+public:
+  using TextLogSink::TextLogSink;
+
+  void
+  write(const LogRecord& record) override
+  {
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_isWriting = true;
+      m_cv.notify_all();
+      m_cv.wait(lock, [this] { return m_isReleased; });
+    }
+    TextLogSink::write(record);
+  }
+
+  /**
+   * \brief Waits until the drainer is blocked in write()
+   */
+  void
+  waitForWrite()
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_cv.wait(lock, [this] { return m_isWriting; });
+  }
+
+  void
+  release()
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_isReleased = true;
+    m_cv.notify_all();
+  }
+
+private:
+  std::mutex m_mutex;
+  std::condition_variable m_cv;
+  bool m_isWriting = false;
+  bool m_isReleased = false;
+};
+
+BOOST_AUTO_TEST_CASE(RingFull)
+{
+  std::ostringstream os;
+  auto sink = make_unique<BlockingLogSink>(os);
+  BlockingLogSink& blockingSink = *sink;
+  Logger logger;
+  logger.configure(LogLevel::TRACE, Logger::Backend::RING, std::move(sink), 4, 1_ms);
+
+  // the drainer takes the first record and blocks writing it, so the ring cannot be emptied
+  logger.log(LogLevel::TRACE, "seq", uint64_t(0));
+  blockingSink.waitForWrite();
+
+  for (uint64_t i = 1; i <= 10; ++i) {
+    logger.log(LogLevel::TRACE, "seq", i);
+  }
+  BOOST_CHECK_EQUAL(logger.getNDropped(), 6);
+
+  blockingSink.release();
+  logger.stop();
+  BOOST_CHECK_EQUAL(os.str(), "seq: 0\nseq: 1\nseq: 2\nseq: 3\nseq: 4\n");
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestLogger
+BOOST_AUTO_TEST_SUITE_END() // Cc
+
+} // namespace tests
+} // namespace cc
+} // namespace ndn
@@ -0,0 +1,131 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tools/cc/common/sequence-table.hpp"
+
+#include "tests/test-common.hpp"
+
+#include <map>
+#include <random>
+
+namespace ndn {
+namespace cc {
+namespace tests {
+
+BOOST_AUTO_TEST_SUITE(Cc)
+BOOST_AUTO_TEST_SUITE(TestSequenceTable)
+
+BOOST_AUTO_TEST_CASE(Basic)
+{
+  SequenceTable<int> table(64);
+  BOOST_CHECK(table.empty());
+  BOOST_CHECK(table.find(5) == nullptr);
+
+  table.insert(5) = 50;
+  table.insert(70) = 700;
+  BOOST_CHECK_EQUAL(table.size(), 2);
+  BOOST_REQUIRE(table.find(5) != nullptr);
+  BOOST_CHECK_EQUAL(*table.find(5), 50);
+  BOOST_CHECK_EQUAL(*table.find(70), 700);
+  // 69 and 134 share the slots of 5 and 70 without being members
+  BOOST_CHECK(table.find(69) == nullptr);
+  BOOST_CHECK(table.find(134) == nullptr);
+
+  // inserting a member returns its state as is
+  BOOST_CHECK_EQUAL(table.insert(5), 50);
+  BOOST_CHECK_EQUAL(table.size(), 2);
+
+  BOOST_CHECK_EQUAL(table.erase(5), 1);
+  BOOST_CHECK_EQUAL(table.erase(5), 0);
+  BOOST_CHECK_EQUAL(table.erase(6), 0);
+  BOOST_CHECK(table.find(5) == nullptr);
+  BOOST_CHECK_EQUAL(table.size(), 1);
+
+  // a new entry starts from the default state
+  BOOST_CHECK_EQUAL(table.insert(5), 0);
+}
+
+BOOST_AUTO_TEST_CASE(SlideAndGrow)
+{
+  SequenceTable<uint64_t> table(128);
+
+  // a window sliding forward reuses the ring
+  for (uint64_t seq = 0; seq < 100000; ++seq) {
+    table.insert(seq) = seq;
+    if (seq >= 100) {
+      BOOST_REQUIRE_EQUAL(table.erase(seq - 100), 1);
+    }
+  }
+  BOOST_CHECK_EQUAL(table.size(), 100);
+  BOOST_CHECK_EQUAL(table.getCapacity(), 128);
+
+  // a key one ring length past the oldest entry makes the ring grow, keeping every entry
+  table.insert(99900 + 128) = 1;
+  BOOST_CHECK_EQUAL(table.getCapacity(), 256);
+  for (uint64_t seq = 99900; seq < 100000; ++seq) {
+    BOOST_REQUIRE(table.find(seq) != nullptr);
+    BOOST_CHECK_EQUAL(*table.find(seq), seq);
+  }
+  BOOST_CHECK_EQUAL(*table.find(99900 + 128), 1);
+}
+
+BOOST_AUTO_TEST_CASE(SameAsMap)
+{
+  std::mt19937_64 rng(42);
+  SequenceTable<uint64_t> table(64);
+  std::map<uint64_t, uint64_t> expected;
+
+  uint64_t base = 0;
+  for (int i = 0; i < 200000; ++i) {
+    uint64_t seq = base + rng() % 5000;
+    switch (rng() % 3) {
+    case 0:
+      table.insert(seq) = i;
+      expected[seq] = i;
+      break;
+    case 1:
+      BOOST_REQUIRE_EQUAL(table.erase(seq), expected.erase(seq));
+      break;
+    case 2: {
+      auto it = expected.find(seq);
+      uint64_t* value = table.find(seq);
+      BOOST_REQUIRE_EQUAL(value != nullptr, it != expected.end());
+      if (value != nullptr) {
+        BOOST_REQUIRE_EQUAL(*value, it->second);
+      }
+      break;
+    }
+    }
+    BOOST_REQUIRE_EQUAL(table.size(), expected.size());
+    base += rng() % 3;
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestSequenceTable
+BOOST_AUTO_TEST_SUITE_END() // Cc
+
+} // namespace tests
+} // namespace cc
+} // namespace ndn
@@ -0,0 +1,128 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tools/cc/common/sequence-window.hpp"
+
+#include "tests/test-common.hpp"
+
+#include <random>
+#include <set>
+
+namespace ndn {
+namespace cc {
+namespace tests {
+
+BOOST_AUTO_TEST_SUITE(Cc)
+BOOST_AUTO_TEST_SUITE(TestSequenceWindow)
+
+BOOST_AUTO_TEST_CASE(Basic)
+{
+  SequenceWindow window(64);
+  BOOST_CHECK(window.empty());
+
+  BOOST_CHECK(window.insert(70));
+  BOOST_CHECK(window.insert(5));
+  BOOST_CHECK(window.insert(1000));
+  BOOST_CHECK(!window.insert(70));
+  BOOST_CHECK_EQUAL(window.size(), 3);
+  BOOST_CHECK(window.contains(5));
+  BOOST_CHECK(!window.contains(6));
+  BOOST_CHECK(!window.contains(100000));
+
+  BOOST_CHECK_EQUAL(window.getMin(), 5);
+  BOOST_CHECK_EQUAL(window.erase(70), 1);
+  BOOST_CHECK_EQUAL(window.erase(70), 0);
+  BOOST_CHECK_EQUAL(window.popMin(), 5);
+  BOOST_CHECK_EQUAL(window.popMin(), 1000);
+  BOOST_CHECK(window.empty());
+
+  // an emptied window starts over anywhere
+  BOOST_CHECK(window.insert(1ULL << 40));
+  BOOST_CHECK_EQUAL(window.getMin(), 1ULL << 40);
+  window.clear();
+  BOOST_CHECK(window.empty());
+  BOOST_CHECK(!window.contains(1ULL << 40));
+}
+
+BOOST_AUTO_TEST_CASE(SlideAndGrow)
+{
+  SequenceWindow window(128);
+
+  // members below the window move it back, members far above make it grow
+  BOOST_CHECK(window.insert(10000));
+  BOOST_CHECK(window.insert(9000));
+  BOOST_CHECK(window.insert(50000));
+  BOOST_CHECK_EQUAL(window.popMin(), 9000);
+  BOOST_CHECK_EQUAL(window.popMin(), 10000);
+  BOOST_CHECK_EQUAL(window.popMin(), 50000);
+
+  // a window sliding forward reuses the ring
+  for (uint64_t seq = 0; seq < 100000; ++seq) {
+    window.insert(seq);
+    if (seq >= 100) {
+      BOOST_REQUIRE_EQUAL(window.popMin(), seq - 100);
+    }
+  }
+  BOOST_CHECK_EQUAL(window.size(), 100);
+}
+
+BOOST_AUTO_TEST_CASE(SameAsSet)
+{
+  std::mt19937_64 rng(42);
+  SequenceWindow window(64);
+  std::set<uint64_t> expected;
+
+  uint64_t base = 0;
+  for (int i = 0; i < 200000; ++i) {
+    uint64_t seq = base + rng() % 5000;
+    switch (rng() % 4) {
+    case 0:
+    case 1:
+      BOOST_REQUIRE_EQUAL(window.insert(seq), expected.insert(seq).second);
+      break;
+    case 2:
+      BOOST_REQUIRE_EQUAL(window.erase(seq), expected.erase(seq));
+      break;
+    case 3:
+      if (!expected.empty()) {
+        BOOST_REQUIRE_EQUAL(window.popMin(), *expected.begin());
+        expected.erase(expected.begin());
+      }
+      break;
+    }
+    BOOST_REQUIRE_EQUAL(window.size(), expected.size());
+    if (!expected.empty()) {
+      BOOST_REQUIRE_EQUAL(window.getMin(), *expected.begin());
+    }
+    base += rng() % 3;
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestSequenceWindow
+BOOST_AUTO_TEST_SUITE_END() // Cc
+
+} // namespace tests
+} // namespace cc
+} // namespace ndn
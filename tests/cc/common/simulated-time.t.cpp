@@ -0,0 +1,135 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tools/cc/common/simulated-time.hpp"
+#include "tools/cc/common/emulated-link.hpp"
+
+#include "tests/test-common.hpp"
+
+namespace ndn {
+namespace cc {
+namespace tests {
+
+using namespace ndn::tests;
+
+BOOST_AUTO_TEST_SUITE(Cc)
+BOOST_AUTO_TEST_SUITE(TestSimulatedTime)
+
+BOOST_AUTO_TEST_CASE(JumpToTimers)
+{
+  SimulatedTime simulatedTime;
+  boost::asio::io_service io;
+  Scheduler scheduler(io);
+  auto start = time::steady_clock::now();
+
+  std::vector<time::nanoseconds> times;
+  auto record = [&] { times.push_back(time::steady_clock::now() - start); };
+  scheduler.schedule(10_ms, record);
+  scheduler.schedule(1_h, record);
+  scheduler.schedule(2_s, [&] {
+    record();
+    scheduler.schedule(1500_us, record);
+  });
+  auto cancelled = scheduler.schedule(1_ms, record);
+  cancelled.cancel();
+
+  auto realStart = std::chrono::steady_clock::now();
+  simulatedTime.run(io);
+  BOOST_CHECK_LT(std::chrono::steady_clock::now() - realStart, std::chrono::seconds(10));
+
+  std::vector<time::nanoseconds> expected{10_ms, 2_s, 2_s + 1500_us, 1_h};
+  BOOST_CHECK_EQUAL_COLLECTIONS(times.begin(), times.end(), expected.begin(), expected.end());
+  BOOST_CHECK_EQUAL(simulatedTime.getElapsed(), 1_h);
+}
+
+BOOST_AUTO_TEST_CASE(StopFromHandler)
+{
+  SimulatedTime simulatedTime;
+  boost::asio::io_service io;
+  Scheduler scheduler(io);
+
+  bool hasRunLate = false;
+  scheduler.schedule(5_s, [&] { io.stop(); });
+  scheduler.schedule(10_s, [&] { hasRunLate = true; });
+  simulatedTime.run(io);
+
+  BOOST_CHECK(!hasRunLate);
+  BOOST_CHECK_EQUAL(simulatedTime.getElapsed(), 5_s);
+}
+
+/**
+ * \brief Returns the arrival times of Data sent back to back over a lossy link
+ */
+static std::vector<time::nanoseconds>
+runLink(size_t& packetSize)
+{
+  SimulatedTime simulatedTime;
+  boost::asio::io_service io;
+  auto start = time::steady_clock::now();
+
+  EmulatedLink::Options options;
+  options.bandwidth = 8e6;
+  options.delay = 10_ms;
+  options.lossRate = 0.1;
+  EmulatedLink link(io, options);
+
+  std::vector<time::nanoseconds> arrivals;
+  link.getTransport(0)->connect(io, [&] (const Block& wire) {
+    arrivals.push_back(time::steady_clock::now() - start);
+    packetSize = wire.size();
+  });
+  link.getTransport(0)->resume();
+  for (int i = 0; i < 100; ++i) {
+    auto data = makeData(Name("/cc/sim").appendNumber(i));
+    data->setContent(std::vector<uint8_t>(1000).data(), 1000);
+    link.getTransport(1)->send(signData(data)->wireEncode());
+  }
+  simulatedTime.run(io);
+  return arrivals;
+}
+
+BOOST_AUTO_TEST_CASE(EmulatedLinkRun)
+{
+  size_t packetSize = 0;
+  auto arrivals = runLink(packetSize);
+  BOOST_REQUIRE_GT(arrivals.size(), 80);
+  BOOST_REQUIRE_LT(arrivals.size(), 100);
+  // at one byte per microsecond, the Data arrive at whole multiples of their serialization time
+  auto transmissionTime = time::microseconds(packetSize);
+  for (const auto& arrival : arrivals) {
+    BOOST_CHECK_EQUAL((arrival - 10_ms).count() % time::nanoseconds(transmissionTime).count(), 0);
+  }
+
+  // and in the same order at the same times in another run
+  auto again = runLink(packetSize);
+  BOOST_CHECK_EQUAL_COLLECTIONS(arrivals.begin(), arrivals.end(), again.begin(), again.end());
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestSimulatedTime
+BOOST_AUTO_TEST_SUITE_END() // Cc
+
+} // namespace tests
+} // namespace cc
+} // namespace ndn
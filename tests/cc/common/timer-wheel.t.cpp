@@ -0,0 +1,160 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tools/cc/common/timer-wheel.hpp"
+
+#include "tests/test-common.hpp"
+
+#include <map>
+#include <random>
+#include <set>
+
+namespace ndn {
+namespace cc {
+namespace tests {
+
+BOOST_AUTO_TEST_SUITE(Cc)
+BOOST_AUTO_TEST_SUITE(TestTimerWheel)
+
+static const time::steady_clock::TimePoint START(time::seconds(1000));
+
+BOOST_AUTO_TEST_CASE(ExpireInOrder)
+{
+  TimerWheel<int> wheel(1_ms, START);
+  wheel.insert(START + 300_ms, 3);
+  wheel.insert(START + 5_ms, 1);
+  wheel.insert(START + 70_s, 4);
+  auto cancelled = wheel.insert(START + 100_ms, 0);
+  wheel.insert(START + 100_ms, 2);
+  BOOST_CHECK_EQUAL(wheel.size(), 5);
+  BOOST_CHECK(wheel.cancel(cancelled));
+  BOOST_CHECK(!wheel.cancel(cancelled));
+
+  std::vector<int> expired;
+  auto onExpire = [&] (int value) { expired.push_back(value); };
+
+  BOOST_CHECK_EQUAL(wheel.advance(START + 4_ms, onExpire), 0);
+  BOOST_CHECK_EQUAL(wheel.advance(START + 5_ms, onExpire), 1);
+  BOOST_CHECK_EQUAL(wheel.advance(START + 299_ms, onExpire), 1);
+  BOOST_CHECK_EQUAL(wheel.advance(START + 69_s, onExpire), 1);
+  BOOST_CHECK_EQUAL(wheel.advance(START + 70_s, onExpire), 1);
+  BOOST_CHECK(wheel.empty());
+  BOOST_CHECK_EQUAL_COLLECTIONS(expired.begin(), expired.end(),
+                                std::vector<int>({1, 2, 3, 4}).begin(), std::vector<int>({1, 2, 3, 4}).end());
+
+  // timers in the past expire on the next advance
+  wheel.insert(START, 5);
+  BOOST_CHECK_EQUAL(wheel.advance(START + 70_s, onExpire), 1);
+  BOOST_CHECK_EQUAL(expired.back(), 5);
+}
+
+BOOST_AUTO_TEST_CASE(NextExpiry)
+{
+  TimerWheel<int> wheel(1_ms, START);
+  wheel.insert(START + 10_ms, 1);
+  BOOST_CHECK(wheel.getNextExpiry() == START + 10_ms);
+
+  // a far timer is only bounded by the next cascade
+  TimerWheel<int> farWheel(1_ms, START);
+  farWheel.insert(START + 10_s, 1);
+  auto next = farWheel.getNextExpiry();
+  BOOST_CHECK(next > START);
+  BOOST_CHECK(next <= START + 10_s);
+
+  // following the hints reaches the timer exactly
+  size_t nExpired = 0;
+  while (nExpired == 0) {
+    next = farWheel.getNextExpiry();
+    nExpired = farWheel.advance(next, [] (int) {});
+  }
+  BOOST_CHECK(next == START + 10_s);
+}
+
+BOOST_AUTO_TEST_CASE(SameAsMultimap)
+{
+  std::mt19937_64 rng(7);
+  TimerWheel<uint32_t> wheel(1_ms, START);
+  std::multimap<int64_t, uint32_t> expected; // tick => id
+  std::map<uint32_t, std::pair<TimerWheel<uint32_t>::Handle, int64_t>> pending;
+
+  int64_t now = 0;
+  uint32_t nextId = 0;
+  for (int i = 0; i < 100000; ++i) {
+    switch (rng() % 8) {
+    case 0:
+    case 1:
+    case 2: {
+      // mostly short timers, a few beyond several levels
+      int64_t delay = rng() % 10 == 0 ? rng() % 100000000 : rng() % 2000;
+      uint32_t id = nextId++;
+      auto handle = wheel.insert(START + time::milliseconds(now + delay), id);
+      expected.emplace(now + delay, id);
+      pending[id] = {handle, now + delay};
+      break;
+    }
+    case 3:
+      if (!pending.empty()) {
+        auto it = pending.lower_bound(static_cast<uint32_t>(rng() % nextId));
+        if (it == pending.end()) {
+          it = pending.begin();
+        }
+        BOOST_REQUIRE(wheel.cancel(it->second.first));
+        auto range = expected.equal_range(it->second.second);
+        for (auto e = range.first; e != range.second; ++e) {
+          if (e->second == it->first) {
+            expected.erase(e);
+            break;
+          }
+        }
+        pending.erase(it);
+      }
+      break;
+    default: {
+      now += rng() % 50;
+      std::set<uint32_t> expired;
+      wheel.advance(START + time::milliseconds(now), [&] (uint32_t id) { expired.insert(id); });
+      std::set<uint32_t> due;
+      while (!expected.empty() && expected.begin()->first <= now) {
+        due.insert(expected.begin()->second);
+        pending.erase(expected.begin()->second);
+        expected.erase(expected.begin());
+      }
+      BOOST_REQUIRE(expired == due);
+      break;
+    }
+    }
+    BOOST_REQUIRE_EQUAL(wheel.size(), expected.size());
+    if (!expected.empty()) {
+      BOOST_REQUIRE(wheel.getNextExpiry() <= START + time::milliseconds(std::max(now, expected.begin()->first)));
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestTimerWheel
+BOOST_AUTO_TEST_SUITE_END() // Cc
+
+} // namespace tests
+} // namespace cc
+} // namespace ndn
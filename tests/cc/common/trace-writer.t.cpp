@@ -0,0 +1,219 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tools/cc/common/trace-writer.hpp"
+
+#include "tests/test-common.hpp"
+
+#include <boost/filesystem.hpp>
+#include <fstream>
+#include <sstream>
+
+namespace ndn {
+namespace cc {
+namespace tests {
+
+class TraceFixture
+{
+protected:
+  TraceFixture()
+    : path((boost::filesystem::path(TMP_TESTS_PATH) / "cc-trace.bin").string())
+  {
+    boost::filesystem::create_directories(TMP_TESTS_PATH);
+  }
+
+  ~TraceFixture()
+  {
+    boost::system::error_code ec;
+    boost::filesystem::remove(path, ec);
+  }
+
+  std::vector<TraceRecord>
+  readAll()
+  {
+    std::ifstream is(path, std::ios::binary);
+    TraceReader reader(is);
+    std::vector<TraceRecord> records;
+    TraceRecord record;
+    while (reader.read(record)) {
+      records.push_back(record);
+    }
+    return records;
+  }
+
+protected:
+  std::string path;
+};
+
+BOOST_AUTO_TEST_SUITE(Cc)
+BOOST_FIXTURE_TEST_SUITE(TestTraceWriter, TraceFixture)
+
+BOOST_AUTO_TEST_CASE(RoundTrip)
+{
+  TraceWriter writer;
+  BOOST_CHECK(!writer.isEnabled());
+  writer.open(path, 4);
+  BOOST_CHECK(writer.isEnabled());
+
+  auto now = time::steady_clock::now();
+  for (int64_t i = 0; i < 10; ++i) {
+    writer.append(TraceRecord::DELAY, now, i * 1000, i, 2000000);
+  }
+  TraceRecord window{};
+  window.type = TraceRecord::WINDOW;
+  window.timestamp = writer.getElapsed(now);
+  window.values[0] = 10;
+  window.values[1] = 3;
+  window.setDouble(2, 12.5);
+  writer.append(window);
+  BOOST_CHECK_EQUAL(writer.getNRecords(), 11);
+
+  // full buffers are already on disk
+  BOOST_CHECK_EQUAL(readAll().size(), 8);
+
+  writer.close();
+  auto records = readAll();
+  BOOST_REQUIRE_EQUAL(records.size(), 11);
+  for (int64_t i = 0; i < 10; ++i) {
+    BOOST_CHECK_EQUAL(records[i].type, TraceRecord::DELAY);
+    BOOST_CHECK_EQUAL(records[i].values[0], i * 1000);
+    BOOST_CHECK_EQUAL(records[i].values[1], i);
+    BOOST_CHECK_EQUAL(records[i].values[2], 2000000);
+  }
+  BOOST_CHECK_EQUAL(records[10].type, TraceRecord::WINDOW);
+  BOOST_CHECK_EQUAL(records[10].getDouble(2), 12.5);
+}
+
+BOOST_AUTO_TEST_CASE(PeriodicFlush)
+{
+  TraceWriter writer;
+  writer.open(path, 1024, 10_ms);
+
+  auto now = time::steady_clock::now();
+  writer.append(TraceRecord::RATE, now, 1, 100, 10);
+  writer.append(TraceRecord::RATE, now + 5_ms, 2, 100, 10);
+  BOOST_CHECK_EQUAL(readAll().size(), 0);
+
+  writer.append(TraceRecord::RATE, now + 20_ms, 3, 100, 10);
+  BOOST_CHECK_EQUAL(readAll().size(), 3);
+}
+
+BOOST_AUTO_TEST_CASE(BackgroundFlush)
+{
+  TraceWriter writer;
+  writer.open(path, 1024, 10_ms);
+  writer.flushInBackground();
+
+  // no append comes after these to write them
+  auto now = time::steady_clock::now();
+  writer.append(TraceRecord::RATE, now, 1, 100, 10);
+  writer.append(TraceRecord::RATE, now, 2, 100, 10);
+
+  auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+  while (readAll().size() < 2 && std::chrono::steady_clock::now() < deadline) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  BOOST_CHECK_EQUAL(readAll().size(), 2);
+
+  writer.close();
+  BOOST_CHECK_EQUAL(readAll().size(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(Format)
+{
+  TraceRecord delay{};
+  delay.type = TraceRecord::DELAY;
+  delay.values[0] = 1500;
+  delay.values[1] = 42;
+  delay.values[2] = 800;
+
+  TraceRecord rate{};
+  rate.type = TraceRecord::RATE;
+  rate.values[0] = 3;
+  rate.values[1] = 106700;
+  rate.values[2] = 100;
+
+  TraceRecord window{};
+  window.type = TraceRecord::WINDOW;
+  window.timestamp = 7;
+  window.values[0] = 42;
+  window.values[1] = 5;
+  window.setDouble(2, 6.25);
+
+  TraceRecord marks{};
+  marks.type = TraceRecord::MARKS;
+  marks.timestamp = 9;
+  marks.values[0] = 40;
+  marks.values[1] = 10;
+  marks.setDouble(2, 0.125);
+
+  std::ostringstream text;
+  printTraceHeader(text, TraceFormat::TEXT);
+  printTraceRecord(text, delay, TraceFormat::TEXT);
+  printTraceRecord(text, rate, TraceFormat::TEXT);
+  printTraceRecord(text, window, TraceFormat::TEXT);
+  printTraceRecord(text, marks, TraceFormat::TEXT);
+  BOOST_CHECK_EQUAL(text.str(),
+                    "cc:delay:<1500,42,800>\n"
+                    "cc:rate:<3,106700>100\n"
+                    "cc:window:<7,42,6.25,5>\n"
+                    "cc:marks:<9,40,10,0.125>\n");
+
+  std::ostringstream csv;
+  printTraceHeader(csv, TraceFormat::CSV);
+  printTraceRecord(csv, rate, TraceFormat::CSV);
+  printTraceRecord(csv, window, TraceFormat::CSV);
+  printTraceRecord(csv, marks, TraceFormat::CSV);
+  BOOST_CHECK_EQUAL(csv.str(),
+                    "type,timestamp,flow,value0,value1,value2\n"
+                    "rate,0,0,3,106700,100\n"
+                    "window,7,0,42,5,6.25\n"
+                    "marks,9,0,40,10,0.125\n");
+}
+
+BOOST_AUTO_TEST_CASE(BadFile)
+{
+  std::istringstream notTrace("cc:delay:<1,2,3>\n");
+  BOOST_CHECK_THROW(TraceReader{notTrace}, std::runtime_error);
+
+  TraceWriter writer;
+  writer.open(path);
+  writer.append(TraceRecord::DELAY, time::steady_clock::now(), 1, 2, 3);
+  writer.close();
+
+  std::ifstream is(path, std::ios::binary);
+  std::string content((std::istreambuf_iterator<char>(is)), std::istreambuf_iterator<char>());
+  std::istringstream truncated(content.substr(0, content.size() - 1));
+  TraceReader reader(truncated);
+  TraceRecord record;
+  BOOST_CHECK_THROW(reader.read(record), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestTraceWriter
+BOOST_AUTO_TEST_SUITE_END() // Cc
+
+} // namespace tests
+} // namespace cc
+} // namespace ndn
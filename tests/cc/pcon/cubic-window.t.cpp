@@ -0,0 +1,113 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tools/cc/pcon/cubic-window.hpp"
+
+#include "tests/test-common.hpp"
+
+namespace ndn {
+namespace cc {
+namespace client {
+namespace tests {
+
+using TimePoint = time::steady_clock::TimePoint;
+
+static TimePoint
+after(TimePoint start, double seconds)
+{
+  return start + time::duration_cast<time::nanoseconds>(time::duration<double>(seconds));
+}
+
+// W_cubic(t) = C*(t-K)^3 + W_max, K = cubic_root(W_max*(1-beta_cubic)/C) (RFC 8312, Eq. 1 and 2)
+static double
+rfcTarget(double wMax, double beta, double t)
+{
+  const double k = std::cbrt(wMax * (1 - beta) / CubicWindow::C);
+  return CubicWindow::C * std::pow(t - k, 3) + wMax;
+}
+
+BOOST_AUTO_TEST_SUITE(Cc)
+BOOST_AUTO_TEST_SUITE(TestCubicWindow)
+
+BOOST_AUTO_TEST_CASE(Target)
+{
+  TimePoint start = time::steady_clock::now();
+  CubicWindow cubic(0.7, false, start);
+
+  BOOST_CHECK_CLOSE(cubic.onCongestion(100, start), 70.0, 1e-9);
+  BOOST_CHECK_CLOSE(cubic.getWmax(), 100.0, 1e-9);
+
+  // the curve starts at the reduced window and is back to W_max at t = K
+  BOOST_CHECK_CLOSE(cubic.getTarget(start), 70.0, 1e-4);
+  BOOST_CHECK_CLOSE(cubic.getTarget(after(start, std::cbrt(75.0))), 100.0, 1e-4);
+  for (double t : {0.5, 1.0, 2.5, 6.0, 10.0}) {
+    BOOST_CHECK_CLOSE(cubic.getTarget(after(start, t)), rfcTarget(100, 0.7, t), 1e-4);
+  }
+
+  // a later congestion event starts a new epoch from its own window
+  TimePoint later = after(start, 3);
+  BOOST_CHECK_CLOSE(cubic.onCongestion(80, later), 56.0, 1e-9);
+  BOOST_CHECK_CLOSE(cubic.getWmax(), 80.0, 1e-9);
+  BOOST_CHECK_CLOSE(cubic.getTarget(after(later, 2)), rfcTarget(80, 0.7, 2), 1e-4);
+}
+
+BOOST_AUTO_TEST_CASE(FastConvergence)
+{
+  TimePoint start = time::steady_clock::now();
+  CubicWindow cubic(0.7, true, start);
+  cubic.onCongestion(100, start);
+  BOOST_CHECK_CLOSE(cubic.getWmax(), 100.0, 1e-9);
+
+  // below the last W_max, W_max = cwnd*(1+beta_cubic)/2 (RFC 8312, Section 4.6)
+  TimePoint later = after(start, 3);
+  BOOST_CHECK_CLOSE(cubic.onCongestion(80, later), 56.0, 1e-9);
+  BOOST_CHECK_CLOSE(cubic.getWmax(), 68.0, 1e-9);
+  for (double t : {0.0, 1.0, 4.0}) {
+    BOOST_CHECK_CLOSE(cubic.getTarget(after(later, t)), rfcTarget(68, 0.7, t), 1e-4);
+  }
+
+  // within 1% of the last W_max, the window is W_max as is
+  cubic.onCongestion(79.5, after(later, 5));
+  BOOST_CHECK_CLOSE(cubic.getWmax(), 79.5, 1e-9);
+}
+
+BOOST_AUTO_TEST_CASE(EpochAfterSlowStart)
+{
+  TimePoint start = time::steady_clock::now();
+  CubicWindow cubic(0.7, false, start);
+
+  // K = 0: the window grows from the end of slow start along the plateau
+  cubic.startEpoch(50, start);
+  BOOST_CHECK_CLOSE(cubic.getTarget(start), 50.0, 1e-9);
+  BOOST_CHECK_CLOSE(cubic.getTarget(after(start, 2)), 50.0 + CubicWindow::C * 8, 1e-4);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestCubicWindow
+BOOST_AUTO_TEST_SUITE_END() // Cc
+
+} // namespace tests
+} // namespace client
+} // namespace cc
+} // namespace ndn
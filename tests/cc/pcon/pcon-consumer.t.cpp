@@ -0,0 +1,167 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tools/cc/pcon/pcon-consumer.hpp"
+
+#include "tests/test-common.hpp"
+#include <ndn-cxx/util/dummy-client-face.hpp>
+
+#include <boost/filesystem.hpp>
+#include <fstream>
+
+namespace ndn {
+namespace cc {
+namespace client {
+namespace tests {
+
+using namespace ndn::tests;
+
+class PconConsumerFixture : public UnitTestTimeFixture
+{
+protected:
+  PconConsumerFixture()
+    : face(io, {true, true})
+    , tracePath((boost::filesystem::path(TMP_TESTS_PATH) / "cc-pcon-trace.bin").string())
+  {
+    options.prefix = "/cc/pcon";
+    options.startSeq = 10;
+    options.lifetime = 4_s;
+    options.seqMax = -1;
+    options.tos = 0;
+    options.dsz = 1000;
+    options.fixedRate = -1;
+    options.timingStop = -1;
+    options.delayGreedy = -1;
+    options.greedyRate = -1;
+    options.delayStart = 0;
+    options.printSamples = false;
+    boost::filesystem::create_directories(TMP_TESTS_PATH);
+  }
+
+  ~PconConsumerFixture()
+  {
+    getTraceWriter().close();
+    boost::system::error_code ec;
+    boost::filesystem::remove(tracePath, ec);
+    face.shutdown();
+    io.stop();
+  }
+
+  /**
+   * \brief Answers the next @p nData Interests in the order they were sent, one per millisecond
+   * \param isMarked whether the Data of a sequence number carries a congestion mark
+   */
+  template<typename F>
+  void
+  respond(size_t nData, const F& isMarked)
+  {
+    for (size_t i = 0; i < nData; ++i) {
+      BOOST_REQUIRE_LT(nAnswered, face.sentInterests.size());
+      Name name = face.sentInterests[nAnswered++].getName();
+      auto data = makeData(name);
+      if (isMarked(name.at(-1).toNumber())) {
+        data->setCongestionMark(1);
+      }
+      face.receive(*data);
+      advanceClocks(io, 1_ms);
+    }
+  }
+
+  std::vector<TraceRecord>
+  readTrace()
+  {
+    getTraceWriter().close();
+    std::ifstream is(tracePath, std::ios::binary);
+    TraceReader reader(is);
+    std::vector<TraceRecord> records;
+    TraceRecord record;
+    while (reader.read(record)) {
+      records.push_back(record);
+    }
+    return records;
+  }
+
+protected:
+  boost::asio::io_service io;
+  util::DummyClientFace face;
+  Options options;
+  std::string tracePath;
+  size_t nAnswered = 0;
+};
+
+BOOST_AUTO_TEST_SUITE(Cc)
+BOOST_FIXTURE_TEST_SUITE(TestPconConsumer, PconConsumerFixture)
+
+BOOST_AUTO_TEST_CASE(DctcpReduction)
+{
+  options.ccAlgorithm = DCTCP;
+  options.initialWindowSize = 1;
+  options.dctcpG = 0.5;
+  getTraceWriter().open(tracePath);
+
+  PconConsumer consumer(face, options);
+  consumer.start();
+  advanceClocks(io, 1_ms);
+  // one Data in ten is marked, so that every round trip has a different marked fraction
+  respond(300, [] (uint64_t seq) { return seq % 10 == 0; });
+  consumer.stop();
+
+  // the window the consumer starts with, and the RFC 8257 initial alpha
+  double window = 1;
+  double alpha = 1;
+  int nRounds = 0;
+  int nReductions = 0;
+  bool hasRoundEnded = true;
+  for (const auto& record : readTrace()) {
+    if (record.type == TraceRecord::MARKS) {
+      // alpha = (1 - g) * alpha + g * F, F the marked fraction of the round trip
+      double fraction = static_cast<double>(record.values[1]) / record.values[0];
+      BOOST_CHECK_CLOSE(record.getDouble(2), 0.5 * alpha + 0.5 * fraction, 1e-9);
+      alpha = record.getDouble(2);
+      hasRoundEnded = true;
+      ++nRounds;
+    }
+    else if (record.type == TraceRecord::WINDOW) {
+      if (record.getDouble(2) < window) {
+        // cwnd = cwnd * (1 - alpha / 2), at most once per round trip
+        BOOST_CHECK_CLOSE(record.getDouble(2), std::max(window * (1 - alpha / 2), 1.0), 1e-9);
+        BOOST_CHECK(hasRoundEnded);
+        hasRoundEnded = false;
+        ++nReductions;
+      }
+      window = record.getDouble(2);
+    }
+  }
+  BOOST_CHECK_GT(nReductions, 5);
+  BOOST_CHECK_GT(nRounds, nReductions);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestPconConsumer
+BOOST_AUTO_TEST_SUITE_END() // Cc
+
+} // namespace tests
+} // namespace client
+} // namespace cc
+} // namespace ndn
@@ -0,0 +1,138 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tools/cc/pcon/window-consumer.hpp"
+
+#include "tests/test-common.hpp"
+#include <ndn-cxx/util/dummy-client-face.hpp>
+
+namespace ndn {
+namespace cc {
+namespace client {
+namespace tests {
+
+using namespace ndn::tests;
+
+BOOST_AUTO_TEST_SUITE(Cc)
+BOOST_AUTO_TEST_SUITE(TestWindowConsumer)
+
+/**
+ * \brief Window consumer recording how its Interests are sent
+ */
+class RecordingConsumer : public WindowConsumer<RecordingConsumer>
+{
+public:
+  using WindowConsumer::WindowConsumer;
+
+  void
+  scheduleNextPacket()
+  {
+    if (!m_isSendingWindow) {
+      ++nCallsOutsideWindow;
+    }
+    WindowConsumer::scheduleNextPacket();
+  }
+
+  void
+  willSendInterest(uint64_t seq)
+  {
+    isSentByWindow.push_back(m_isSendingWindow);
+    WindowConsumer::willSendInterest(seq);
+  }
+
+public:
+  /// calls of scheduleNextPacket() that may schedule a send event
+  int nCallsOutsideWindow = 0;
+  std::vector<bool> isSentByWindow;
+};
+
+class WindowConsumerFixture : public UnitTestTimeFixture
+{
+protected:
+  WindowConsumerFixture()
+    : face(io, {true, true})
+  {
+    options.prefix = "/cc/window";
+    options.startSeq = 0;
+    options.lifetime = 4_s;
+    options.seqMax = -1;
+    options.tos = 0;
+    options.dsz = 1000;
+    options.fixedRate = -1;
+    options.timingStop = -1;
+    options.delayGreedy = -1;
+    options.greedyRate = -1;
+    options.delayStart = 0;
+    options.printSamples = false;
+  }
+
+  ~WindowConsumerFixture()
+  {
+    face.shutdown();
+    io.stop();
+  }
+
+protected:
+  boost::asio::io_service io;
+  util::DummyClientFace face;
+  Options options;
+};
+
+BOOST_FIXTURE_TEST_CASE(FillWindow, WindowConsumerFixture)
+{
+  options.initialWindowSize = 16;
+  RecordingConsumer consumer(face, options);
+  consumer.start();
+  advanceClocks(io, 1_ms);
+
+  // the event scheduled by start() expresses the whole window
+  BOOST_REQUIRE_EQUAL(face.sentInterests.size(), 16);
+  for (size_t i = 0; i < face.sentInterests.size(); ++i) {
+    BOOST_CHECK_EQUAL(face.sentInterests[i].getName(), Name(options.prefix).appendNumber(i));
+  }
+  BOOST_CHECK_EQUAL(consumer.nCallsOutsideWindow, 1);
+
+  // a Data frees one credit and grows the window by one, both spent by one more event
+  face.receive(*makeData(Name(options.prefix).appendNumber(0)));
+  advanceClocks(io, 1_ms);
+  BOOST_CHECK_EQUAL(face.sentInterests.size(), 18);
+  BOOST_CHECK_EQUAL(consumer.nCallsOutsideWindow, 2);
+
+  BOOST_CHECK_EQUAL(std::count(consumer.isSentByWindow.begin(), consumer.isSentByWindow.end(), true), 18);
+
+  // a full window leaves nothing scheduled
+  advanceClocks(io, 10_ms, 10);
+  BOOST_CHECK_EQUAL(face.sentInterests.size(), 18);
+
+  consumer.stop();
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestWindowConsumer
+BOOST_AUTO_TEST_SUITE_END() // Cc
+
+} // namespace tests
+} // namespace client
+} // namespace cc
+} // namespace ndn
@@ -0,0 +1,149 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tools/cc/server/admission-controller.hpp"
+
+#include "tests/test-common.hpp"
+
+namespace ndn {
+namespace cc {
+namespace server {
+namespace tests {
+
+BOOST_AUTO_TEST_SUITE(Cc)
+BOOST_AUTO_TEST_SUITE(TestAdmissionController)
+
+static const time::steady_clock::TimePoint START(time::seconds(1000));
+
+BOOST_AUTO_TEST_CASE(Bucket)
+{
+  TokenBucket bucket(100, 4);
+
+  // a full bucket admits the burst back to back
+  for (int i = 0; i < 4; ++i) {
+    BOOST_CHECK(bucket.tryConsume(START));
+  }
+  BOOST_CHECK(!bucket.tryConsume(START));
+
+  // one token every 10ms
+  BOOST_CHECK(!bucket.tryConsume(START + 5_ms));
+  BOOST_CHECK(bucket.tryConsume(START + 10_ms));
+  BOOST_CHECK(!bucket.tryConsume(START + 10_ms));
+
+  // refill is capped by the burst
+  auto later = START + 10_s;
+  for (int i = 0; i < 4; ++i) {
+    BOOST_CHECK(bucket.tryConsume(later));
+  }
+  BOOST_CHECK(!bucket.tryConsume(later));
+}
+
+BOOST_AUTO_TEST_CASE(Unlimited)
+{
+  TokenBucket bucket(0, 1);
+  for (int i = 0; i < 1000; ++i) {
+    BOOST_CHECK(bucket.tryConsume(START));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(SustainedRate)
+{
+  AdmissionController controller(1000, {}, 1);
+
+  // Interests arriving at 2000/s: about half are admitted
+  int nAdmitted = 0;
+  for (int i = 0; i < 2000; ++i) {
+    if (controller.admit(-1, START + time::microseconds(500 * i))) {
+      ++nAdmitted;
+    }
+  }
+  BOOST_CHECK_GE(nAdmitted, 995);
+  BOOST_CHECK_LE(nAdmitted, 1005);
+}
+
+BOOST_AUTO_TEST_CASE(PerClass)
+{
+  AdmissionController controller(0, {{3, 10}}, 2);
+
+  // classes without a rate are unlimited
+  for (int i = 0; i < 100; ++i) {
+    BOOST_CHECK(controller.admit(-1, START));
+    BOOST_CHECK(controller.admit(1, START));
+  }
+
+  BOOST_CHECK(controller.admit(3, START));
+  BOOST_CHECK(controller.admit(3, START));
+  BOOST_CHECK(!controller.admit(3, START));
+  BOOST_CHECK(controller.admit(3, START + 100_ms));
+}
+
+BOOST_AUTO_TEST_CASE(IndependentBuckets)
+{
+  AdmissionController controller(10, {}, 1);
+
+  BOOST_CHECK(controller.admit(1, START));
+  BOOST_CHECK(!controller.admit(1, START));
+
+  // other classes, and Interests without a class, have their own budget
+  BOOST_CHECK(controller.admit(2, START));
+  BOOST_CHECK(controller.admit(-1, START));
+  BOOST_CHECK(!controller.admit(-1, START));
+}
+
+BOOST_AUTO_TEST_CASE(HighClass)
+{
+  AdmissionController controller(10, {{3, 1000}}, 1);
+
+  // classes of N_CLASSES and above get the default rate, but not the budget of Interests without a class
+  BOOST_CHECK(controller.admit(300, START));
+  BOOST_CHECK(!controller.admit(300, START));
+  BOOST_CHECK(!controller.admit(AdmissionController::N_CLASSES, START));
+  BOOST_CHECK(controller.admit(-1, START));
+  BOOST_CHECK(controller.admit(300, START + 100_ms));
+
+  BOOST_CHECK_THROW(AdmissionController(10, {{300, 1000}}, 1), std::invalid_argument);
+  BOOST_CHECK_THROW(AdmissionController(10, {{-2, 1000}}, 1), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(ParseClassRate)
+{
+  auto parsed = AdmissionController::parseClassRate("255=12.5");
+  BOOST_CHECK_EQUAL(parsed.first, 255);
+  BOOST_CHECK_EQUAL(parsed.second, 12.5);
+
+  BOOST_CHECK_THROW(AdmissionController::parseClassRate("300=100"), std::invalid_argument);
+  BOOST_CHECK_THROW(AdmissionController::parseClassRate("256=100"), std::invalid_argument);
+  BOOST_CHECK_THROW(AdmissionController::parseClassRate("-1=100"), std::invalid_argument);
+  BOOST_CHECK_THROW(AdmissionController::parseClassRate("3=0"), std::invalid_argument);
+  BOOST_CHECK_THROW(AdmissionController::parseClassRate("3"), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestAdmissionController
+BOOST_AUTO_TEST_SUITE_END() // Cc
+
+} // namespace tests
+} // namespace server
+} // namespace cc
+} // namespace ndn
@@ -0,0 +1,176 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tools/cc/server/batching-transport.hpp"
+
+#include "tests/test-common.hpp"
+
+#include <boost/filesystem.hpp>
+
+namespace ndn {
+namespace cc {
+namespace server {
+namespace tests {
+
+BOOST_AUTO_TEST_SUITE(Cc)
+BOOST_AUTO_TEST_SUITE(TestBatchingTransport)
+
+using boost::asio::local::stream_protocol;
+
+class BatchingTransportFixture
+{
+protected:
+  BatchingTransportFixture()
+    : socketPath((boost::filesystem::path(TMP_TESTS_PATH) / "cc-batching-transport.sock").string())
+    , acceptor(io)
+    , forwarder(io)
+  {
+    boost::filesystem::create_directories(TMP_TESTS_PATH);
+    boost::filesystem::remove(socketPath);
+    acceptor.open();
+    acceptor.bind(stream_protocol::endpoint(socketPath));
+    acceptor.listen();
+  }
+
+  ~BatchingTransportFixture()
+  {
+    if (transport != nullptr) {
+      transport->close();
+    }
+    boost::system::error_code error;
+    acceptor.close(error);
+    boost::filesystem::remove(socketPath, error);
+  }
+
+  void
+  connect(const BatchingTransport::Options& options)
+  {
+    transport = make_shared<BatchingTransport>(socketPath, options);
+    transport->connect(io, [this] (const Block& wire) { received.push_back(wire); });
+    acceptor.accept(forwarder);
+  }
+
+  /**
+   * \brief Reads everything the transport wrote so far
+   */
+  std::vector<uint8_t>
+  readForwarder()
+  {
+    std::vector<uint8_t> bytes;
+    uint8_t buffer[MAX_NDN_PACKET_SIZE];
+    while (forwarder.available() > 0) {
+      size_t n = forwarder.read_some(boost::asio::buffer(buffer));
+      bytes.insert(bytes.end(), buffer, buffer + n);
+    }
+    return bytes;
+  }
+
+  static Block
+  makePacket(int seq)
+  {
+    return makeStringBlock(tlv::Content, "packet-" + to_string(seq));
+  }
+
+protected:
+  boost::asio::io_service io;
+  std::string socketPath;
+  stream_protocol::acceptor acceptor;
+  stream_protocol::socket forwarder;
+  shared_ptr<BatchingTransport> transport;
+  std::vector<Block> received;
+};
+
+BOOST_FIXTURE_TEST_CASE(EndOfTurn, BatchingTransportFixture)
+{
+  connect(BatchingTransport::Options());
+
+  std::vector<uint8_t> expected;
+  for (int seq = 0; seq < 3; ++seq) {
+    Block packet = makePacket(seq);
+    expected.insert(expected.end(), packet.begin(), packet.end());
+    transport->send(packet);
+  }
+  ProducerStats stats;
+  transport->getCounters().snapshot(stats);
+  BOOST_CHECK_EQUAL(stats.nBatches, 0);
+
+  io.poll();
+  std::vector<uint8_t> written = readForwarder();
+  BOOST_CHECK_EQUAL_COLLECTIONS(written.begin(), written.end(), expected.begin(), expected.end());
+
+  transport->getCounters().snapshot(stats);
+  BOOST_CHECK_EQUAL(stats.nBatches, 1);
+  BOOST_CHECK_EQUAL(stats.nBatchedPackets, 3);
+}
+
+BOOST_FIXTURE_TEST_CASE(MaxPackets, BatchingTransportFixture)
+{
+  BatchingTransport::Options options;
+  options.maxPackets = 2;
+  connect(options);
+
+  // the second packet starts a write, the next ones queue up behind it and leave together
+  for (int seq = 0; seq < 5; ++seq) {
+    transport->send(makePacket(seq));
+  }
+  io.poll();
+
+  ProducerStats stats;
+  transport->getCounters().snapshot(stats);
+  BOOST_CHECK_EQUAL(stats.nBatches, 2);
+  BOOST_CHECK_EQUAL(stats.nBatchedPackets, 5);
+  BOOST_CHECK_EQUAL(readForwarder().size(), 5 * makePacket(0).size());
+}
+
+BOOST_FIXTURE_TEST_CASE(Receive, BatchingTransportFixture)
+{
+  connect(BatchingTransport::Options());
+  transport->resume();
+
+  Block packet1 = makePacket(1);
+  Block packet2 = makePacket(2);
+  // deliver one packet and a half, then the rest
+  std::vector<uint8_t> bytes(packet1.begin(), packet1.end());
+  bytes.insert(bytes.end(), packet2.begin(), packet2.end());
+  size_t split = packet1.size() + packet2.size() / 2;
+
+  boost::asio::write(forwarder, boost::asio::buffer(bytes.data(), split));
+  io.poll();
+  BOOST_CHECK_EQUAL(received.size(), 1);
+
+  boost::asio::write(forwarder, boost::asio::buffer(bytes.data() + split, bytes.size() - split));
+  io.poll();
+  BOOST_REQUIRE_EQUAL(received.size(), 2);
+  BOOST_CHECK(received[0] == packet1);
+  BOOST_CHECK(received[1] == packet2);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestBatchingTransport
+BOOST_AUTO_TEST_SUITE_END() // Cc
+
+} // namespace tests
+} // namespace server
+} // namespace cc
+} // namespace ndn
@@ -0,0 +1,220 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tools/cc/server/data-signer.hpp"
+
+#include "tests/test-common.hpp"
+
+#include <thread>
+
+namespace ndn {
+namespace cc {
+namespace server {
+namespace tests {
+
+BOOST_AUTO_TEST_SUITE(Cc)
+BOOST_AUTO_TEST_SUITE(TestDataSigner)
+
+static Data
+makeUnsigned(const Name& name)
+{
+  Data data(name);
+  data.setContent(makeStringBlock(tlv::Content, "payload"));
+  return data;
+}
+
+BOOST_AUTO_TEST_CASE(ParseMode)
+{
+  BOOST_CHECK(parseSigningMode("none") == SigningMode::NONE);
+  BOOST_CHECK(parseSigningMode("sha256") == SigningMode::DIGEST_SHA256);
+  BOOST_CHECK(parseSigningMode("hmac") == SigningMode::HMAC);
+  BOOST_CHECK(parseSigningMode("ecdsa") == SigningMode::ECDSA);
+  BOOST_CHECK_THROW(parseSigningMode("rsa"), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(InlineCache)
+{
+  boost::asio::io_service io;
+  DataSigner signer(io, SigningMode::DIGEST_SHA256, "", 2, 0);
+
+  int nBuilt = 0;
+  std::vector<Data> signedData;
+  auto sign = [&] (const Name& name, size_t payloadSize) {
+    ResponseVariant variant;
+    variant.payloadSize = payloadSize;
+    signer.sign(name, variant,
+                [&] { ++nBuilt; return makeUnsigned(name); },
+                [&] (const Data& data) { signedData.push_back(data); });
+  };
+
+  sign("/cc/signer/1", 0);
+  BOOST_REQUIRE_EQUAL(signedData.size(), 1);
+  BOOST_CHECK_EQUAL(signedData[0].getSignature().getType(), tlv::DigestSha256);
+
+  sign("/cc/signer/1", 0);
+  BOOST_CHECK_EQUAL(nBuilt, 1);
+  BOOST_CHECK_EQUAL(signer.getNHits(), 1);
+  BOOST_REQUIRE_EQUAL(signedData.size(), 2);
+  BOOST_CHECK(signedData[0].wireEncode() == signedData[1].wireEncode());
+
+  // a different variant of the same name is signed separately
+  sign("/cc/signer/1", 1);
+  BOOST_CHECK_EQUAL(nBuilt, 2);
+
+  // the cache holds two entries: /1 variant 0 is the least recently used one
+  sign("/cc/signer/2", 0);
+  sign("/cc/signer/1", 0);
+  BOOST_CHECK_EQUAL(nBuilt, 4);
+  BOOST_CHECK_EQUAL(signer.getNMisses(), 4);
+}
+
+BOOST_AUTO_TEST_CASE(SignerThreads)
+{
+  boost::asio::io_service io;
+  DataSigner signer(io, SigningMode::HMAC, "", 16, 2);
+
+  std::vector<Data> signedData;
+  int nBuilt = 0;
+  for (int i = 0; i < 2; ++i) {
+    // the second request is for a response that is still being signed
+    signer.sign("/cc/signer/threads", ResponseVariant(),
+                [&] { ++nBuilt; return makeUnsigned("/cc/signer/threads"); },
+                [&] (const Data& data) { signedData.push_back(data); });
+  }
+  BOOST_CHECK_EQUAL(signedData.size(), 0);
+  BOOST_CHECK_EQUAL(nBuilt, 1);
+
+  for (int i = 0; i < 1000 && signedData.empty(); ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    io.poll();
+    io.reset();
+  }
+  // both requests get the packet signed once
+  BOOST_REQUIRE_EQUAL(signedData.size(), 2);
+  BOOST_CHECK_EQUAL(signedData[0].getSignature().getType(), tlv::SignatureHmacWithSha256);
+  BOOST_CHECK(signedData[0].wireEncode() == signedData[1].wireEncode());
+  BOOST_CHECK_EQUAL(signer.getNMisses(), 2);
+
+  // now cached
+  signer.sign("/cc/signer/threads", ResponseVariant(),
+              [] { return makeUnsigned("/cc/signer/threads"); },
+              [&] (const Data& data) { signedData.push_back(data); });
+  BOOST_CHECK_EQUAL(signedData.size(), 3);
+  BOOST_CHECK_EQUAL(signer.getNHits(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(QueueFull)
+{
+  boost::asio::io_service io;
+  DataSigner signer(io, SigningMode::DIGEST_SHA256, "", 0, 1, 2);
+
+  // the io_service is not polled, so no response leaves the pending set
+  std::vector<Data> signedData;
+  for (int i = 0; i < 5; ++i) {
+    Name name = Name("/cc/signer/full").appendNumber(i);
+    signer.sign(name, ResponseVariant(),
+                [name] { return makeUnsigned(name); },
+                [&] (const Data& data) { signedData.push_back(data); });
+  }
+  BOOST_CHECK_EQUAL(signer.getNDropped(), 3);
+
+  for (int i = 0; i < 1000 && signedData.size() < 2; ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    io.poll();
+    io.reset();
+  }
+  BOOST_CHECK_EQUAL(signedData.size(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(Variant)
+{
+  boost::asio::io_service io;
+  DataSigner signer(io, SigningMode::DIGEST_SHA256, "", 16, 0);
+
+  // (payloadSize << 41) ^ ((serviceClass + 1) << 32) ^ targetRate is 0 for both
+  ResponseVariant a;
+  a.payloadSize = 1;
+  a.serviceClass = 511;
+  ResponseVariant b;
+
+  int nBuilt = 0;
+  for (const auto& variant : {a, b, a}) {
+    signer.sign("/cc/signer/variant", variant,
+                [&] { ++nBuilt; return makeUnsigned("/cc/signer/variant"); },
+                [] (const Data&) {});
+  }
+  BOOST_CHECK_EQUAL(nBuilt, 2);
+  BOOST_CHECK_EQUAL(signer.getNHits(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(Ecdsa)
+{
+  boost::asio::io_service io;
+  DataSigner signer(io, SigningMode::ECDSA, "", 0, 0);
+
+  bool isSigned = false;
+  signer.sign("/cc/signer/ecdsa", ResponseVariant(),
+              [] { return makeUnsigned("/cc/signer/ecdsa"); },
+              [&] (const Data& data) {
+                isSigned = true;
+                BOOST_CHECK_EQUAL(data.getSignature().getType(), tlv::SignatureSha256WithEcdsa);
+              });
+  BOOST_CHECK(isSigned);
+}
+
+BOOST_AUTO_TEST_CASE(EcdsaThreadsShareKey)
+{
+  boost::asio::io_service io;
+  DataSigner signer(io, SigningMode::ECDSA, "", 0, 4);
+
+  std::vector<Data> signedData;
+  for (int i = 0; i < 16; ++i) {
+    Name name = Name("/cc/signer/ecdsa-threads").appendNumber(i);
+    signer.sign(name, ResponseVariant(),
+                [name] { return makeUnsigned(name); },
+                [&] (const Data& data) { signedData.push_back(data); });
+  }
+  for (int i = 0; i < 1000 && signedData.size() < 16; ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    io.poll();
+    io.reset();
+  }
+
+  // whichever thread signed a response, it names the same certificate
+  BOOST_REQUIRE_EQUAL(signedData.size(), 16);
+  const KeyLocator& keyLocator = signedData[0].getSignature().getKeyLocator();
+  for (const auto& data : signedData) {
+    BOOST_CHECK_EQUAL(data.getSignature().getType(), tlv::SignatureSha256WithEcdsa);
+    BOOST_CHECK_EQUAL(data.getSignature().getKeyLocator(), keyLocator);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestDataSigner
+BOOST_AUTO_TEST_SUITE_END() // Cc
+
+} // namespace tests
+} // namespace server
+} // namespace cc
+} // namespace ndn
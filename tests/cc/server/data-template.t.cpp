@@ -0,0 +1,149 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tools/cc/server/data-template.hpp"
+
+#include "tests/test-common.hpp"
+
+namespace ndn {
+namespace cc {
+namespace server {
+namespace tests {
+
+BOOST_AUTO_TEST_SUITE(Cc)
+BOOST_AUTO_TEST_SUITE(TestDataTemplate)
+
+BOOST_AUTO_TEST_CASE(MatchesEncoding)
+{
+  PayloadPool payloads(8700);
+  DataTemplate dataTemplate(payloads, 4_s, 0);
+
+  for (int serviceClass : {0, 5, 7}) {
+    Name name = Name("/cc/template").appendNumber(serviceClass);
+    Data spliced(dataTemplate.makeWire(name, 1024, serviceClass));
+    Data encoded = dataTemplate.encodeData(name, 1024, serviceClass);
+
+    BOOST_CHECK_EQUAL(spliced.getName(), name);
+    BOOST_CHECK_EQUAL(spliced.getContent().value_size(), 1024);
+    BOOST_CHECK_EQUAL(spliced.getFreshnessPeriod(), 4_s);
+    BOOST_CHECK(spliced.getServiceClass() == encoded.getServiceClass());
+    BOOST_CHECK(spliced.wireEncode() == encoded.wireEncode());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(NoServiceClass)
+{
+  PayloadPool payloads(8700);
+  DataTemplate dataTemplate(payloads, 1_s, 0);
+
+  Name name("/cc/template/no-service-class");
+  BOOST_CHECK(dataTemplate.makeWire(name, 0, nullopt) ==
+              dataTemplate.encodeData(name, 0, nullopt).wireEncode());
+}
+
+BOOST_AUTO_TEST_CASE(LargeName)
+{
+  // a Name long enough to need a multi-byte TLV length in front of it
+  PayloadPool payloads(8700);
+  DataTemplate dataTemplate(payloads, 1_s, 0);
+
+  Name name("/cc/template");
+  name.append(std::string(300, 'n'));
+  BOOST_CHECK(dataTemplate.makeWire(name, 16, 1) ==
+              dataTemplate.encodeData(name, 16, 1).wireEncode());
+}
+
+BOOST_AUTO_TEST_CASE(TargetRate)
+{
+  PayloadPool payloads(8700);
+  DataTemplate dataTemplate(payloads, 1_s, 0);
+
+  for (uint32_t targetRate : {0U, 1U, 1250000U, std::numeric_limits<uint32_t>::max()}) {
+    Data data(dataTemplate.makeWire("/cc/template/rate", 16, 5, targetRate));
+    BOOST_REQUIRE(data.getTargetRate());
+    BOOST_CHECK_EQUAL(*data.getTargetRate(), targetRate);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(PayloadSizes)
+{
+  PayloadPool payloads(2000);
+  DataTemplate dataTemplate(payloads, 1_s, 0);
+
+  Name name("/cc/template/sizes");
+  for (size_t payloadSize : {0, 100, 1500, 100}) {
+    Block wire = dataTemplate.makeWire(name, payloadSize, 3);
+    BOOST_CHECK_EQUAL(Data(wire).getContent().value_size(), payloadSize);
+    BOOST_CHECK(wire == dataTemplate.encodeData(name, payloadSize, 3).wireEncode());
+  }
+  BOOST_CHECK_EQUAL(payloads.size(), 3);
+
+  // sizes above the pool maximum are clamped
+  BOOST_CHECK_EQUAL(Data(dataTemplate.makeWire(name, 5000, 3)).getContent().value_size(), 2000);
+}
+
+BOOST_AUTO_TEST_CASE(TailCache)
+{
+  PayloadPool payloads(8700);
+  DataTemplate dataTemplate(payloads, 1_s, 0, 2);
+
+  Name name("/cc/template/tails");
+  dataTemplate.makeWire(name, 100, 1);
+  dataTemplate.makeWire(name, 200, 1);
+  dataTemplate.makeWire(name, 100, 1);
+  BOOST_CHECK_EQUAL(dataTemplate.getNTails(), 2);
+
+  // every requested size gets a tail, but only the most recently used ones stay
+  for (size_t payloadSize = 300; payloadSize < 400; ++payloadSize) {
+    BOOST_CHECK(dataTemplate.makeWire(name, payloadSize, 1) ==
+                dataTemplate.encodeData(name, payloadSize, 1).wireEncode());
+  }
+  BOOST_CHECK_EQUAL(dataTemplate.getNTails(), 2);
+
+  // an evicted tail is encoded again
+  BOOST_CHECK(dataTemplate.makeWire(name, 100, 1) == dataTemplate.encodeData(name, 100, 1).wireEncode());
+  BOOST_CHECK_EQUAL(dataTemplate.getNTails(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(BufferReuse)
+{
+  PayloadPool payloads(8700);
+  DataTemplate dataTemplate(payloads, 1_s, 0);
+
+  Block first = dataTemplate.makeWire("/cc/template/1", 8, 1);
+  Block second = dataTemplate.makeWire("/cc/template/2", 8, 1);
+
+  // the first wire is still alive, so the second one must not overwrite it
+  BOOST_CHECK_EQUAL(Data(first).getName(), "/cc/template/1");
+  BOOST_CHECK_EQUAL(Data(second).getName(), "/cc/template/2");
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestDataTemplate
+BOOST_AUTO_TEST_SUITE_END() // Cc
+
+} // namespace tests
+} // namespace server
+} // namespace cc
+} // namespace ndn
@@ -0,0 +1,138 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tools/cc/server/ndn-producer.hpp"
+
+#include "tests/test-common.hpp"
+#include "../../identity-management-fixture.hpp"
+
+#include <ndn-cxx/util/dummy-client-face.hpp>
+
+namespace ndn {
+namespace cc {
+namespace server {
+namespace tests {
+
+using namespace ndn::tests;
+
+BOOST_AUTO_TEST_SUITE(Cc)
+BOOST_AUTO_TEST_SUITE(TestNdnProducer)
+
+BOOST_AUTO_TEST_CASE(WorkerCapacity)
+{
+  Options options;
+  options.prefix = "/cc";
+  options.nThreads = 4;
+  options.egressCapacity = 1000000;
+
+  uint64_t total = 0;
+  for (uint32_t i = 0; i < options.nThreads; ++i) {
+    Options workerOptions = makeWorkerOptions(options, i);
+    BOOST_CHECK_EQUAL(workerOptions.egressCapacity, 250000);
+    total += workerOptions.egressCapacity;
+  }
+  BOOST_CHECK_EQUAL(total, options.egressCapacity);
+
+  options.nThreads = 1;
+  BOOST_CHECK_EQUAL(makeWorkerOptions(options, 0).egressCapacity, 1000000);
+}
+
+BOOST_AUTO_TEST_CASE(WorkerPrefixes)
+{
+  Options options;
+  options.prefix = "/cc";
+  options.nThreads = 3;
+
+  // each worker serves its own prefix by default
+  for (uint32_t i = 0; i < options.nThreads; ++i) {
+    BOOST_CHECK_EQUAL(makeWorkerOptions(options, i).prefix, Name("/cc").appendNumber(i));
+  }
+
+  options.shardPrefixes = false;
+  for (uint32_t i = 0; i < options.nThreads; ++i) {
+    BOOST_CHECK_EQUAL(makeWorkerOptions(options, i).prefix, Name("/cc"));
+  }
+
+  // a single worker keeps the prefix the consumers ask for
+  options.shardPrefixes = true;
+  options.nThreads = 1;
+  BOOST_CHECK_EQUAL(makeWorkerOptions(options, 0).prefix, Name("/cc"));
+}
+
+class WireTemplateFixture : public IdentityManagementTimeFixture
+{
+protected:
+  WireTemplateFixture()
+    : face(io, m_keyChain, {true, true})
+  {
+    options.prefix = "/cc";
+    options.useWireTemplate = true;
+    options.honorDsz = false;
+    options.maxPayloadSize = MAX_NDN_PACKET_SIZE;
+  }
+
+protected:
+  boost::asio::io_service io;
+  util::DummyClientFace face;
+  Options options;
+};
+
+BOOST_FIXTURE_TEST_CASE(WireTemplate, WireTemplateFixture)
+{
+  options.payloadSize = 1024;
+  Producer producer(face, m_keyChain, options);
+  producer.start();
+  advanceClocks(io, 1_ms, 10);
+
+  face.receive(*makeInterest("/cc/1"));
+  advanceClocks(io, 1_ms, 10);
+
+  BOOST_REQUIRE_EQUAL(face.sentData.size(), 1);
+  BOOST_CHECK_EQUAL(face.sentData.front().getName(), "/cc/1");
+  BOOST_CHECK_EQUAL(face.sentData.front().getContent().value_size(), 1024);
+}
+
+BOOST_FIXTURE_TEST_CASE(OversizedWire, WireTemplateFixture)
+{
+  // the template is sent past the Face, which must not let it exceed the limit Face::put enforces
+  options.payloadSize = MAX_NDN_PACKET_SIZE;
+  Producer producer(face, m_keyChain, options);
+  producer.start();
+  advanceClocks(io, 1_ms, 10);
+
+  BOOST_CHECK_THROW({
+    face.receive(*makeInterest("/cc/1"));
+    face.processEvents();
+  }, Face::OversizedPacketError);
+  BOOST_CHECK_EQUAL(face.sentData.size(), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestNdnProducer
+BOOST_AUTO_TEST_SUITE_END() // Cc
+
+} // namespace tests
+} // namespace server
+} // namespace cc
+} // namespace ndn
@@ -0,0 +1,111 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tools/cc/server/payload-distribution.hpp"
+
+#include "tests/test-common.hpp"
+
+#include <boost/filesystem.hpp>
+#include <algorithm>
+#include <fstream>
+
+namespace ndn {
+namespace cc {
+namespace server {
+namespace tests {
+
+BOOST_AUTO_TEST_SUITE(Cc)
+BOOST_AUTO_TEST_SUITE(TestPayloadDistribution)
+
+BOOST_AUTO_TEST_CASE(Fixed)
+{
+  PayloadDistribution fixed("1024");
+  BOOST_CHECK_EQUAL(fixed.next(), 1024);
+  BOOST_CHECK_EQUAL(fixed.next(), 1024);
+  BOOST_CHECK(fixed.getSupport() == std::vector<size_t>{1024});
+
+  BOOST_CHECK_EQUAL(PayloadDistribution("fixed:0").next(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(Uniform)
+{
+  PayloadDistribution uniform("uniform:100-1000", 1);
+  auto support = uniform.getSupport();
+  BOOST_CHECK_EQUAL(support.size(), PayloadDistribution::N_UNIFORM_SIZES);
+  BOOST_CHECK_EQUAL(support.front(), 100);
+  BOOST_CHECK_EQUAL(support.back(), 1000);
+
+  for (int i = 0; i < 1000; ++i) {
+    size_t size = uniform.next();
+    BOOST_CHECK(std::binary_search(support.begin(), support.end(), size));
+  }
+
+  BOOST_CHECK_EQUAL(PayloadDistribution("uniform:10-12").getSupport().size(), 3);
+}
+
+BOOST_AUTO_TEST_CASE(Bimodal)
+{
+  PayloadDistribution bimodal("bimodal:100,8000,0.9", 1);
+  int nSmall = 0;
+  for (int i = 0; i < 10000; ++i) {
+    nSmall += bimodal.next() == 100;
+  }
+  BOOST_CHECK_GT(nSmall, 8500);
+  BOOST_CHECK_LT(nSmall, 9500);
+}
+
+BOOST_AUTO_TEST_CASE(Trace)
+{
+  boost::filesystem::create_directories(TMP_TESTS_PATH);
+  std::string path = (boost::filesystem::path(TMP_TESTS_PATH) / "cc-payload-trace.txt").string();
+  std::ofstream(path) << "10 20\n30\n";
+
+  PayloadDistribution trace("trace:" + path);
+  std::vector<size_t> sizes;
+  for (int i = 0; i < 5; ++i) {
+    sizes.push_back(trace.next());
+  }
+  BOOST_CHECK(sizes == (std::vector<size_t>{10, 20, 30, 10, 20}));
+  boost::filesystem::remove(path);
+}
+
+BOOST_AUTO_TEST_CASE(Malformed)
+{
+  BOOST_CHECK_THROW(PayloadDistribution("-1"), std::invalid_argument);
+  BOOST_CHECK_THROW(PayloadDistribution("uniform:10"), std::invalid_argument);
+  BOOST_CHECK_THROW(PayloadDistribution("uniform:10-5"), std::invalid_argument);
+  BOOST_CHECK_THROW(PayloadDistribution("bimodal:1,2"), std::invalid_argument);
+  BOOST_CHECK_THROW(PayloadDistribution("bimodal:1,2,1.5"), std::invalid_argument);
+  BOOST_CHECK_THROW(PayloadDistribution("zipf:1"), std::invalid_argument);
+  BOOST_CHECK_THROW(PayloadDistribution("trace:/nonexistent/cc-trace"), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestPayloadDistribution
+BOOST_AUTO_TEST_SUITE_END() // Cc
+
+} // namespace tests
+} // namespace server
+} // namespace cc
+} // namespace ndn
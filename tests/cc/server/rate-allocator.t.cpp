@@ -0,0 +1,141 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tools/cc/server/rate-allocator.hpp"
+
+#include "tests/test-common.hpp"
+
+namespace ndn {
+namespace cc {
+namespace server {
+namespace tests {
+
+BOOST_AUTO_TEST_SUITE(Cc)
+BOOST_AUTO_TEST_SUITE(TestRateAllocator)
+
+static const time::steady_clock::TimePoint START(time::seconds(1000));
+
+BOOST_AUTO_TEST_CASE(SlidingWindow)
+{
+  SlidingWindowCounter counter;
+  for (uint64_t bucket = 0; bucket < SlidingWindowCounter::N_BUCKETS; ++bucket) {
+    counter.add(bucket, 10);
+  }
+  BOOST_CHECK_EQUAL(counter.getTotal(SlidingWindowCounter::N_BUCKETS - 1), 100);
+  BOOST_CHECK_EQUAL(counter.getTotal(SlidingWindowCounter::N_BUCKETS), 90);
+  BOOST_CHECK_EQUAL(counter.getTotal(SlidingWindowCounter::N_BUCKETS + 3), 60);
+  BOOST_CHECK_EQUAL(counter.getTotal(100), 0);
+}
+
+BOOST_AUTO_TEST_CASE(MaxMin)
+{
+  RateAllocator allocator(1000000, 1_s, RateAllocator::MAX_MIN, {});
+
+  // flow 1 asks for 100 KB/s, flow 2 for 2 MB/s
+  uint64_t rate1 = 0, rate2 = 0;
+  for (int ms = 0; ms < 3000; ++ms) {
+    auto now = START + time::milliseconds(ms);
+    rate1 = allocator.onInterest(1, 5, 100, now);
+    rate2 = allocator.onInterest(2, 5, 2000, now);
+  }
+
+  BOOST_CHECK_EQUAL(allocator.getNActiveFlows(), 2);
+  // flow 1 is satisfied, flow 2 gets the rest, and both are told the fair level
+  BOOST_CHECK_EQUAL(rate1, 900000);
+  BOOST_CHECK_EQUAL(rate2, 900000);
+  BOOST_CHECK_CLOSE(allocator.getClassRate(5, START + 3_s), 2100000, 1);
+}
+
+BOOST_AUTO_TEST_CASE(Weighted)
+{
+  RateAllocator allocator(1000000, 1_s, RateAllocator::WEIGHTED, {{1, 1.0}, {2, 3.0}});
+
+  uint64_t rate1 = 0, rate2 = 0;
+  for (int ms = 0; ms < 3000; ++ms) {
+    auto now = START + time::milliseconds(ms);
+    rate1 = allocator.onInterest(1, 1, 2000, now);
+    rate2 = allocator.onInterest(2, 2, 2000, now);
+  }
+
+  BOOST_CHECK_EQUAL(rate1, 250000);
+  BOOST_CHECK_EQUAL(rate2, 750000);
+}
+
+BOOST_AUTO_TEST_CASE(Underloaded)
+{
+  RateAllocator allocator(1000000, 1_s, RateAllocator::MAX_MIN, {});
+
+  uint64_t rate = 0;
+  for (int ms = 0; ms < 3000; ++ms) {
+    rate = allocator.onInterest(1, -1, 100, START + time::milliseconds(ms));
+  }
+  // the only flow may grow into the whole spare capacity
+  BOOST_CHECK_CLOSE(static_cast<double>(rate), 1000000, 1);
+}
+
+BOOST_AUTO_TEST_CASE(SpareCapacity)
+{
+  RateAllocator allocator(1000000, 1_s, RateAllocator::MAX_MIN, {});
+
+  // flow 1 asks for 100 KB/s, flow 2 for 500 KB/s
+  uint64_t rate1 = 0, rate2 = 0;
+  for (int ms = 0; ms < 3000; ++ms) {
+    auto now = START + time::milliseconds(ms);
+    rate1 = allocator.onInterest(1, -1, 100, now);
+    rate2 = allocator.onInterest(2, -1, 500, now);
+  }
+
+  // each flow grows by half of the 400 KB/s spare, without exceeding the capacity together
+  BOOST_CHECK_CLOSE(static_cast<double>(rate1), 300000, 1);
+  BOOST_CHECK_CLOSE(static_cast<double>(rate2), 700000, 1);
+  BOOST_CHECK_LE(rate1 + rate2, 1000000);
+}
+
+BOOST_AUTO_TEST_CASE(ProbeAfterIdleSlot)
+{
+  // flows 1 and 5 share home slot 1, so flow 5 lands on slot 2
+  RateAllocator allocator(1000000, 1_s, RateAllocator::MAX_MIN, {}, 4);
+
+  uint64_t rate5 = 0;
+  for (int ms = 0; ms < 2200; ++ms) {
+    auto now = START + time::milliseconds(ms);
+    if (ms < 1000) {
+      allocator.onInterest(1, -1, 100, now);
+    }
+    rate5 = allocator.onInterest(5, -1, 100, now);
+  }
+
+  // slot 1 went idle, but flow 5 keeps its slot instead of reclaiming slot 1 as a second copy
+  BOOST_CHECK_EQUAL(allocator.getNActiveFlows(), 1);
+  BOOST_CHECK_CLOSE(static_cast<double>(rate5), 1000000, 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestRateAllocator
+BOOST_AUTO_TEST_SUITE_END() // Cc
+
+} // namespace tests
+} // namespace server
+} // namespace cc
+} // namespace ndn
@@ -292,6 +292,40 @@ BOOST_AUTO_TEST_CASE(IgnoreCongestionMarks)
   BOOST_CHECK_EQUAL(pipeline->m_nCongMarks, 1);
 }
 
+BOOST_AUTO_TEST_CASE(HyStart)
+{
+  opt.enableHyStart = true;
+  nDataSegments = 100;
+  run(name);
+  advanceClocks(io, time::nanoseconds(1));
+  BOOST_CHECK_EQUAL(face.sentInterests.size(), 2);
+
+  // one Data every 3 ms, while the window doubles every round: the RTT grows with the
+  // queue until HyStart sees it
+  uint64_t i = 0;
+  for (; i < 60 && pipeline->m_hyStart.getLastExit() == HyStart::NONE; ++i) {
+    advanceClocks(io, 3_ms);
+    face.receive(*makeDataWithSegment(i));
+  }
+  BOOST_CHECK_EQUAL(pipeline->m_hyStart.getLastExit(), HyStart::DELAY_INCREASE);
+  BOOST_CHECK_CLOSE(pipeline->m_ssthresh, pipeline->m_hyStart.getExitWindow(), MARGIN);
+  BOOST_CHECK_GE(pipeline->m_ssthresh, 16);
+  BOOST_CHECK_LE(pipeline->m_ssthresh, 32);
+
+  // the cubic function starts from the exit window, instead of jumping to the time
+  // elapsed since the pipeline started
+  BOOST_CHECK_CLOSE(pipeline->m_wmax, pipeline->m_ssthresh, MARGIN);
+  for (; i < 60; ++i) {
+    double preCwnd = pipeline->m_cwnd;
+    advanceClocks(io, 3_ms);
+    face.receive(*makeDataWithSegment(i));
+    BOOST_CHECK_LT(pipeline->m_cwnd - preCwnd, 1);
+  }
+
+  BOOST_CHECK_EQUAL(pipeline->m_nLossDecr, 0);
+  BOOST_CHECK_EQUAL(pipeline->m_nMarkDecr, 0);
+}
+
 BOOST_AUTO_TEST_CASE(Nack)
 {
   nDataSegments = 5;
@@ -0,0 +1,170 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "core/hystart.hpp"
+
+#include "tests/test-common.hpp"
+
+namespace ndn {
+namespace tests {
+
+using TimePoint = time::steady_clock::TimePoint;
+
+BOOST_AUTO_TEST_SUITE(TestHyStart)
+
+BOOST_AUTO_TEST_CASE(DelayIncrease)
+{
+  HyStart::Options options;
+  options.detectAckTrain = false;
+  HyStart hyStart(options);
+  TimePoint now;
+  uint64_t seq = 0;
+
+  // first round: 32 Data over an idle path
+  for (; seq < 32; ++seq) {
+    now += 3_ms;
+    BOOST_CHECK(!hyStart.onData(now, seq, 31, 10_ms, 32));
+  }
+  BOOST_CHECK_EQUAL(hyStart.getMinRtt(), 10_ms);
+
+  // second round: the queue adds 3 ms, below the 4 ms threshold
+  for (; seq < 64; ++seq) {
+    now += 3_ms;
+    BOOST_CHECK(!hyStart.onData(now, seq, 63, 13_ms, 48));
+  }
+
+  // third round: the queue adds 5 ms, seen once the first 8 samples of the round are in
+  for (; seq < 72; ++seq) {
+    now += 3_ms;
+    BOOST_CHECK(!hyStart.onData(now, seq, 95, 15_ms, 64));
+  }
+  BOOST_CHECK(hyStart.onData(now + 3_ms, seq, 95, 15_ms, 72));
+  BOOST_CHECK_EQUAL(hyStart.getLastExit(), HyStart::DELAY_INCREASE);
+  BOOST_CHECK_EQUAL(hyStart.getExitWindow(), 72);
+}
+
+BOOST_AUTO_TEST_CASE(DelayThresholdScalesWithRtt)
+{
+  HyStart::Options options;
+  options.detectAckTrain = false;
+  HyStart hyStart(options);
+  TimePoint now;
+  uint64_t seq = 0;
+
+  // a minimum RTT of 100 ms puts the threshold at 12.5 ms
+  for (; seq < 32; ++seq) {
+    now += 3_ms;
+    BOOST_CHECK(!hyStart.onData(now, seq, 31, 100_ms, 32));
+  }
+  for (; seq < 64; ++seq) {
+    now += 3_ms;
+    BOOST_CHECK(!hyStart.onData(now, seq, 63, 112_ms, 32));
+  }
+  for (; seq < 72; ++seq) {
+    now += 3_ms;
+    hyStart.onData(now, seq, 95, 113_ms, 32);
+  }
+  BOOST_CHECK(hyStart.onData(now + 3_ms, seq, 95, 113_ms, 32));
+}
+
+BOOST_AUTO_TEST_CASE(AckTrain)
+{
+  HyStart::Options options;
+  options.detectDelay = false;
+  HyStart hyStart(options);
+  TimePoint now;
+
+  // a round of Data 1 ms apart is an ACK train, ended once longer than half the 10 ms RTT
+  for (uint64_t seq = 0; seq <= 5; ++seq) {
+    BOOST_CHECK(!hyStart.onData(now + time::milliseconds(seq), seq, 31, 10_ms, 32));
+  }
+  BOOST_CHECK(hyStart.onData(now + 6_ms, 6, 31, 10_ms, 32));
+  BOOST_CHECK_EQUAL(hyStart.getLastExit(), HyStart::ACK_TRAIN);
+}
+
+BOOST_AUTO_TEST_CASE(AckTrainBroken)
+{
+  HyStart::Options options;
+  options.detectDelay = false;
+  HyStart hyStart(options);
+  TimePoint now;
+
+  // Data 3 ms apart never extend the train beyond its first Data
+  for (uint64_t seq = 0; seq < 32; ++seq) {
+    now += 3_ms;
+    BOOST_CHECK(!hyStart.onData(now, seq, 31, 10_ms, 32));
+  }
+
+  // rounds shorter than half the RTT do not end slow start either
+  for (uint64_t seq = 32; seq < 64; ++seq) {
+    now += 1_ms;
+    BOOST_CHECK(!hyStart.onData(now, seq, seq + 3 - seq % 4, 10_ms, 32));
+  }
+  BOOST_CHECK_EQUAL(hyStart.getLastExit(), HyStart::NONE);
+}
+
+BOOST_AUTO_TEST_CASE(LowWindow)
+{
+  HyStart hyStart(HyStart::Options{});
+  TimePoint now;
+  uint64_t seq = 0;
+
+  // below 16 segments, neither the train nor the delay increase ends slow start
+  for (; seq < 64; ++seq) {
+    now += 1_ms;
+    BOOST_CHECK(!hyStart.onData(now, seq, 127, seq < 32 ? 10_ms : 50_ms, 15));
+  }
+
+  // from 16 segments, the delay increase is detected after the 8 samples
+  for (; seq < 72; ++seq) {
+    now += 3_ms;
+    BOOST_CHECK(!hyStart.onData(now, seq, 127, 50_ms, 16));
+  }
+  BOOST_CHECK(hyStart.onData(now + 3_ms, seq, 127, 50_ms, 16));
+  BOOST_CHECK_EQUAL(hyStart.getLastExit(), HyStart::DELAY_INCREASE);
+}
+
+BOOST_AUTO_TEST_CASE(Reset)
+{
+  HyStart::Options options;
+  options.detectDelay = false;
+  HyStart hyStart(options);
+  TimePoint now;
+
+  for (uint64_t seq = 0; seq <= 4; ++seq) {
+    BOOST_CHECK(!hyStart.onData(now + time::milliseconds(seq), seq, 31, 10_ms, 32));
+  }
+  // the next Data starts a new round, as after a window decrease
+  hyStart.reset();
+  for (uint64_t seq = 5; seq <= 10; ++seq) {
+    BOOST_CHECK(!hyStart.onData(now + time::milliseconds(seq), seq, 31, 10_ms, 32));
+  }
+  BOOST_CHECK(hyStart.onData(now + 11_ms, 11, 31, 10_ms, 32));
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestHyStart
+
+} // namespace tests
+} // namespace ndn
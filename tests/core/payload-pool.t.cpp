@@ -0,0 +1,94 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of ndn-tools (Named Data Networking Essential Tools).
+ * See AUTHORS.md for complete list of ndn-tools authors and contributors.
+ *
+ * ndn-tools is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-tools is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndn-tools, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "core/payload-pool.hpp"
+
+#include "tests/test-common.hpp"
+
+#include <algorithm>
+
+namespace ndn {
+namespace tests {
+
+BOOST_AUTO_TEST_SUITE(TestPayloadPool)
+
+BOOST_AUTO_TEST_CASE(Filled)
+{
+  PayloadPool pool(1000);
+
+  const Block& block = pool.getFilled(100);
+  BOOST_CHECK_EQUAL(block.type(), tlv::Content);
+  BOOST_CHECK_EQUAL(block.value_size(), 100);
+  BOOST_CHECK(std::all_of(block.value_begin(), block.value_end(), [] (uint8_t b) { return b == 'a'; }));
+
+  // the same size and fill share the same block and bytes
+  BOOST_CHECK_EQUAL(&pool.getFilled(100), &block);
+  BOOST_CHECK(pool.getFilled(100).wire() == block.wire());
+  BOOST_CHECK_NE(&pool.getFilled(100, 'b'), &block);
+  BOOST_CHECK_EQUAL(pool.size(), 2);
+
+  // sizes are clamped to the pool maximum
+  BOOST_CHECK_EQUAL(pool.getFilled(5000).value_size(), 1000);
+  BOOST_CHECK_EQUAL(&pool.getFilled(5000), &pool.getFilled(1000));
+}
+
+BOOST_AUTO_TEST_CASE(Intern)
+{
+  PayloadPool pool;
+
+  auto content = make_shared<Buffer>();
+  content->assign(64, 'x');
+  const Block& block = pool.intern(content);
+  BOOST_CHECK_EQUAL(block.type(), tlv::Content);
+  BOOST_CHECK_EQUAL_COLLECTIONS(block.value_begin(), block.value_end(), content->begin(), content->end());
+
+  // a copy of the same bytes resolves to the same block
+  BOOST_CHECK_EQUAL(&pool.intern(make_shared<Buffer>(*content)), &block);
+
+  content->back() = 'y';
+  BOOST_CHECK_NE(&pool.intern(content), &block);
+  BOOST_CHECK_EQUAL(pool.size(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(SharedByData)
+{
+  PayloadPool pool;
+  const Block& payload = pool.getFilled(1024);
+
+  Data data1("/payload/1");
+  data1.setContent(payload);
+  Data data2("/payload/2");
+  data2.setContent(payload);
+
+  // neither Data copied the bytes
+  BOOST_CHECK(data1.getContent().value() == payload.value());
+  BOOST_CHECK(data2.getContent().value() == payload.value());
+  BOOST_CHECK_EQUAL(pool.getFootprint(), payload.size());
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestPayloadPool
+
+} // namespace tests
+} // namespace ndn
@@ -1,5 +1,4 @@
 #include "bbr-consumer.hpp"
-#include <cmath>
 
 namespace ndn
 {
@@ -8,7 +7,7 @@ namespace ndn
         namespace client
         {
             BbrConsumer::BbrConsumer(Face &face, const Options &options)
-                : Consumer(face, options),
+                : Engine(face, options),
                   m_inFlight(0),
                   fixedRate(options.fixedRate),
                   delayStart(options.delayStart),
@@ -16,15 +15,40 @@ namespace ndn
                   delayGreedy(options.delayGreedy),
                   greedyRate(options.greedyRate),
                   dsz(options.dsz),
-                  m_minRtt(std::numeric_limits<double>::max()),
-                  m_maxBandwidth(0.0),
-                  m_PacingGain(2 / std::log(2)),
-                  m_CwndGain(2 / std::log(2)),
-                  m_mode(STARTUP),
-                  m_roundCount(0)
+                  m_dataSize(options.dsz),
+                  m_deliveredSize(0),
+                  m_sampler(time::steady_clock::now()),
+                  m_model(options.dsz, options.flowId, time::steady_clock::now()),
+                  m_nextSendTime(time::steady_clock::now())
             {
             }
 
+            Interest BbrConsumer::makeInterestPrototype(const ConsumerOptions &options)
+            {
+                Interest interest(options.prefix);
+                interest.setCanBePrefix(false);
+                interest.setMustBeFresh(true);
+                interest.setServiceClass(5);
+                interest.setInterestLifetime(options.lifetime);
+                return interest;
+            }
+
+            BbrPacketInfo BbrConsumer::makePacketInfo(time::steady_clock::TimePoint now, bool isRetx)
+            {
+                BbrPacketInfo info;
+                info.sendTime = now;
+                info.isRetx = isRetx;
+                info.delivery = m_sampler.onSend(now, getInFlightBytes(), static_cast<size_t>(m_dataSize));
+                return info;
+            }
+
+            void BbrConsumer::onDelivered(size_t size, time::steady_clock::TimePoint)
+            {
+                m_deliveredSize = size;
+                m_dataSize = 0.8 * m_dataSize + 0.2 * size;
+                m_model.setDataSize(m_dataSize);
+            }
+
             void BbrConsumer::startGreedy()
             {
                 this->fixedRate = this->greedyRate;
@@ -61,146 +85,101 @@ namespace ndn
                                                                { sendPacket(); });
                     return;
                 }
-                if (!m_nextInterestEvent)
+                if (m_nextInterestEvent || getInFlightBytes() >= m_model.getCwnd())
                 {
-                    auto bdp = m_minRtt * m_maxBandwidth;
-                    // std::cout << "BDP: " << bdp << ", inFlight: " << m_inFlight << ", minRtt: " << m_minRtt << ", maxBandwidth: " << m_maxBandwidth << std::endl;
-                    if (m_mode == DRAIN && m_inFlight < bdp)
-                    {
-                        doGainCycle();
-                        enterProbeBandwidthMode();
-
-                        // Enter ProbeRTT mode every 10 seconds
-                        m_scheduler.schedule(time::seconds(10), [this]
-                                             { enterProbeRttMode(); });
-                    }
+                    return;
+                }
 
-                    if (m_mode == PROBE_RTT)
-                    {
-                        if (m_inFlight >= 4)
-                        {
-                            return;
-                        }
-                        m_nextInterestEvent = m_scheduler.schedule(time::milliseconds(250), [this]
-                                                                   { sendPacket(); });
-                    }
-                    else
-                    {
-                        if (m_inFlight >= m_CwndGain * bdp)
-                        {
-                            return;
-                        }
-                        uint32_t waitTime = m_packetSize / (m_PacingGain * m_maxBandwidth) * 1000000000;
-                        // std::cout << "waitTime: " <<  m_packetSize / (m_PacingGain * m_maxBandwidth) << std::endl;
-                        m_nextInterestEvent = m_scheduler.schedule(time::nanoseconds(waitTime), [this]
-                                                                   { sendPacket(); });
-                    }
+                auto now = time::steady_clock::now();
+                time::nanoseconds waitTime(0);
+                if (m_nextSendTime > now)
+                {
+                    waitTime = m_nextSendTime - now;
                 }
+                m_nextInterestEvent = m_scheduler.schedule(waitTime, [this]
+                                                           { sendPacket(); });
             }
 
-            void BbrConsumer::willSendInterest(uint32_t seq)
+            void BbrConsumer::willSendInterest(uint64_t seq)
             {
+                if (!isInFlight(seq))
+                {
+                    m_inFlight++;
+                }
 
-                m_inFlight++;
-                Consumer::willSendInterest(seq);
+                // the next Interest leaves once this one's Data is sent at the pacing rate
+                auto now = time::steady_clock::now();
+                auto interval = time::nanoseconds(static_cast<time::nanoseconds::rep>(
+                    m_dataSize / m_model.getPacingRate() * 1e9));
+                m_nextSendTime = std::max(m_nextSendTime, now) + interval;
+
+                Engine::willSendInterest(seq);
             }
 
-            void BbrConsumer::onTimeout(uint32_t seq)
+            void BbrConsumer::onTimeout(uint64_t seq)
             {
+                // only the retransmission timer calls this, once per loss of a sequence number in flight
                 if (m_inFlight > static_cast<uint32_t>(0))
                 {
                     m_inFlight--;
                 }
+                m_model.onLoss(static_cast<size_t>(m_dataSize), getInFlightBytes(), time::steady_clock::now());
 
-                Consumer::onTimeout(seq);
+                Engine::onTimeout(seq);
             }
 
-            void BbrConsumer::onData(const Data &data, uint32_t seq, const BbrPacketInfo &bbrInfo)
+            void BbrConsumer::onSequenceExhausted()
             {
-                Consumer::onData(data, seq, bbrInfo);
-
-                if (!bbrInfo.isRetx)
-                {
-                    auto now = time::steady_clock::now();
-                    // 1. Update minimum RTT
-                    auto rtt = m_rtt.duration_to_second_double(now - bbrInfo.sendTime);
-                    if (m_minRtt > rtt)
-                    {
-                        m_minRtt = rtt;
-                    }
+                // nothing more to request: the next samples measure the consumer, not the path
+                m_sampler.onAppLimited(getInFlightBytes());
+            }
 
-                    // 2. Calculate the current delivery rate
-                    auto delivered_rate = (m_delivered - bbrInfo.deliveredAtSend) / m_rtt.duration_to_second_double((m_deliveredTime - bbrInfo.deliveredTime));
-                    // std::cout << "delivered_rate: " << delivered_rate << ", m_delivered: " << m_delivered << ", deliveredAtSend: " << bbrInfo.deliveredAtSend << ", rtt: " << m_rtt.duration_to_second_double(m_deliveredTime - bbrInfo.deliveredTime)  << std::endl;
-                    if (delivered_rate > m_maxBandwidth)
-                    {
-                        m_maxBandwidth = delivered_rate;
-                    }
-                    else if (m_mode == STARTUP)
-                    {
-                        m_mode = DRAIN;
-                        m_PacingGain = std::log(2) / 2;
-                    }
-                }
+            void BbrConsumer::onData(const Data &data, uint64_t seq, const BbrPacketInfo &bbrInfo)
+            {
+                // a Data satisfies every pending transmission of seq, and one already declared
+                // lost has left m_inFlight
+                bool wasInFlight = isInFlight(seq);
+                m_deliveredSize = 0;
+                Engine::onData(data, seq, bbrInfo);
 
-                if (m_inFlight > static_cast<uint32_t>(0))
+                if (wasInFlight && m_inFlight > static_cast<uint32_t>(0))
                 {
                     m_inFlight--;
                 }
 
-                scheduleNextPacket();
-            }
-
-            void BbrConsumer::doGainCycle()
-            {
-                m_roundCount++;
-                auto gainStage = m_roundCount % 8;
-                if (gainStage == 0)
-                {
-                    m_PacingGain = 1.25;
-                }
-                else if (gainStage == 1)
+                if (m_deliveredSize > 0)
                 {
-                    m_PacingGain = 0.75;
-                }
-                else
-                {
-                    m_PacingGain = 1;
+                    auto sample = m_sampler.onDelivered(bbrInfo.delivery, m_deliveredSize, m_dataTime);
+                    // the RTT of a retransmission is ambiguous
+                    time::nanoseconds rtt(0);
+                    if (!bbrInfo.isRetx)
+                    {
+                        rtt = m_dataTime - bbrInfo.sendTime;
+                    }
+                    m_model.onData(sample, m_deliveredSize, rtt, data.getCongestionMark() > 0,
+                                   getInFlightBytes(), m_dataTime);
                 }
-                uint32_t waitTime = m_minRtt * 1000000000;
-                m_doGainCycleEvent = m_scheduler.schedule(time::nanoseconds(waitTime), [this]
-                                                        { doGainCycle(); });
-            }
 
-            void BbrConsumer::enterProbeBandwidthMode()
-            {
-                m_mode = PROBE_BW;
+                traceWindow(seq);
+                scheduleNextPacket();
             }
 
-            void BbrConsumer::enterProbeRttMode()
+            void BbrConsumer::traceWindow(uint64_t seq)
             {
-                m_mode = PROBE_RTT;
-
-                auto finishRttProbeDuration = m_minRtt;
-                if (finishRttProbeDuration > 0.2)
+                TraceWriter &trace = getTraceWriter();
+                if (!trace.isEnabled())
                 {
-                    finishRttProbeDuration = 0.2;
+                    return;
                 }
-
-                uint32_t waitTime = finishRttProbeDuration * 1000000000;
-
-                // Leave PROBE_RTT mode after max(rtt, 200ms)
-                m_scheduler.schedule(time::nanoseconds(waitTime),
-                                     [this]
-                                     {
-                                         enterProbeBandwidthMode();
-                                     });
-
-                // Enter PROBE_RTT again after 10 seconds
-                m_probeRTTEvent = m_scheduler.schedule(time::seconds(10), [this]
-                                                     { enterProbeRttMode(); });
+                TraceRecord record{};
+                record.type = TraceRecord::WINDOW;
+                record.timestamp = trace.getElapsed(m_dataTime);
+                record.values[0] = seq;
+                record.values[1] = m_inFlight;
+                record.setDouble(2, m_model.getCwnd() / m_dataSize);
+                record.flow = m_options.flowId;
+                trace.append(record);
             }
-
         }
     }
 }
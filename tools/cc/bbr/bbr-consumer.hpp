@@ -1,6 +1,7 @@
 #ifndef BBR_CONSUMER_H
 #define BBR_CONSUMER_H
 #include "ndn-consumer.hpp"
+#include "bbr-model.hpp"
 
 namespace ndn
 {
@@ -8,39 +9,77 @@ namespace ndn
     {
         namespace client
         {
-            class BbrConsumer : public Consumer
+            /**
+             * @brief Rate-based controller driving a BbrModel with delivery rate samples
+             *
+             * Interests are paced at the pacing rate of the model, as long as fewer bytes than its
+             * congestion window are in flight. Bytes in flight are counted in Data of the average
+             * size received so far, starting from the dsz option.
+             */
+            class BbrConsumer : public ConsumerEngine<BbrConsumer, BbrPacketInfo>
             {
             public:
-                enum BbrMode
-                {
-                    STARTUP,
-                    DRAIN,
-                    PROBE_BW,
-                    PROBE_RTT
-                };
-
                 explicit BbrConsumer(Face &face, const Options &options);
 
-                virtual void onData(const Data &data, uint32_t seq, const BbrPacketInfo &bbrInfo);
+                static Interest
+                makeInterestPrototype(const ConsumerOptions &options);
 
-                virtual void onTimeout(uint32_t seq);
+                BbrPacketInfo
+                makePacketInfo(time::steady_clock::TimePoint now, bool isRetx);
 
-                virtual void willSendInterest(uint32_t seq);
+                void onData(const Data &data, uint64_t seq, const BbrPacketInfo &bbrInfo);
 
-            protected:
-                virtual void scheduleNextPacket();
+                void onDelivered(size_t size, time::steady_clock::TimePoint now);
+
+                void onTimeout(uint64_t seq);
 
+                void onSequenceExhausted();
+
+                void willSendInterest(uint64_t seq);
+
+                void scheduleNextPacket();
+
+                const BbrModel &
+                getModel() const
+                {
+                    return m_model;
+                }
+
+                /**
+                 * @brief Returns the number of sequence numbers in flight
+                 */
+                uint32_t
+                getNInFlight() const
+                {
+                    return m_inFlight;
+                }
+
+            protected:
                 void startGreedy();
 
-                void enterProbeBandwidthMode();
+            private:
+                uint64_t
+                getInFlightBytes() const
+                {
+                    return static_cast<uint64_t>(m_inFlight * m_dataSize);
+                }
 
-                void enterProbeRttMode();
+                /**
+                 * @brief Returns whether @p seq is counted in m_inFlight: sent, and neither
+                 *        delivered nor declared lost by its retransmission timer since
+                 */
+                bool
+                isInFlight(uint64_t seq)
+                {
+                    const RetxState *state = m_retxStates.find(seq);
+                    return state != nullptr && state->timer != RetxTimers::INVALID_HANDLE;
+                }
 
-                void doGainCycle();
+                void traceWindow(uint64_t seq);
 
             private:
                 // window
-                uint32_t m_inFlight;
+                uint32_t m_inFlight; ///< \brief sequence numbers in flight, whatever their number of transmissions
 
                 int32_t fixedRate;
                 uint64_t delayStart;
@@ -50,15 +89,14 @@ namespace ndn
                 uint64_t dsz;
 
                 // bbr
-                double m_minRtt;
-                double m_maxBandwidth;
-                double m_PacingGain;
-                double m_CwndGain;
-                BbrMode m_mode;
-                uint32_t m_roundCount;
+                double m_dataSize; ///< \brief average size of the Data received
+                size_t m_deliveredSize; ///< \brief size of the Data in onData, 0 unless delivered for the first time
+                DeliveryRateSampler m_sampler;
+                BbrModel m_model;
+                time::steady_clock::TimePoint m_nextSendTime; ///< \brief earliest send time allowed by pacing
             };
         }
     }
 }
 
-#endif // BBR_CONSUMER_H
\ No newline at end of file
+#endif // BBR_CONSUMER_H
@@ -0,0 +1,528 @@
+#include "bbr-model.hpp"
+
+#include <limits>
+
+namespace ndn
+{
+    namespace cc
+    {
+        namespace client
+        {
+            constexpr double BbrModel::STARTUP_GAIN;
+            constexpr double BbrModel::DRAIN_GAIN;
+            constexpr double BbrModel::CWND_GAIN;
+            constexpr double BbrModel::PROBE_UP_GAIN;
+            constexpr double BbrModel::PROBE_DOWN_GAIN;
+            constexpr double BbrModel::LOSS_THRESH;
+            constexpr double BbrModel::ECN_THRESH;
+            constexpr double BbrModel::BETA;
+            constexpr double BbrModel::HEADROOM;
+            constexpr double BbrModel::PACING_MARGIN;
+            constexpr uint32_t BbrModel::INITIAL_CWND;
+            constexpr uint32_t BbrModel::MIN_CWND;
+
+            static const double INFINITE = std::numeric_limits<double>::infinity();
+            static const time::seconds MIN_RTT_WINDOW(10);
+            static const time::seconds PROBE_RTT_INTERVAL(5);
+            static const time::milliseconds PROBE_RTT_DURATION(200);
+            static const time::seconds PROBE_WAIT_BASE(2);
+            static const uint64_t MAX_PROBE_ROUNDS = 63;
+            static const uint32_t FULL_BW_ROUNDS = 3;
+            static const double FULL_BW_GROWTH = 1.25;
+
+            BbrModel::BbrModel(double dataSize, uint32_t seed, time::steady_clock::TimePoint now)
+                : m_dataSize(dataSize),
+                  m_random(seed),
+                  m_mode(STARTUP),
+                  m_delivered(0),
+                  m_roundCount(0),
+                  m_nextRoundDelivered(0),
+                  m_isRoundStart(false),
+                  m_bwHi{0, 0},
+                  m_bwLo(INFINITE),
+                  m_bwLatest(0),
+                  m_hasMinRtt(false),
+                  m_minRtt(0),
+                  m_minRttStamp(now),
+                  m_probeRttMin(0),
+                  m_probeRttMinStamp(now),
+                  m_isProbeRttMinExpired(false),
+                  m_probeRttDoneStamp(now),
+                  m_isProbeRttRoundDone(false),
+                  m_hasProbeRttDoneStamp(false),
+                  m_isFullPipe(false),
+                  m_fullBw(0),
+                  m_fullBwCount(0),
+                  m_roundDelivered(0),
+                  m_roundLost(0),
+                  m_roundMarked(0),
+                  m_isLossInRound(false),
+                  m_inflightLatest(0),
+                  m_inflightHi(INFINITE),
+                  m_inflightLo(INFINITE),
+                  m_cycleStamp(now),
+                  m_cycleRounds(0),
+                  m_probeWait(PROBE_WAIT_BASE),
+                  m_probeUpRounds(0),
+                  m_probeUpStamp(now),
+                  m_pacingGain(STARTUP_GAIN),
+                  m_cwndGain(STARTUP_GAIN),
+                  m_pacingRate(0),
+                  m_cwnd(INITIAL_CWND * dataSize)
+            {
+                updatePacingRate();
+            }
+
+            double BbrModel::getBandwidth() const
+            {
+                return std::min(getMaxBandwidth(), m_bwLo);
+            }
+
+            void BbrModel::onData(const RateSample &sample, size_t size, time::nanoseconds rtt, bool isMarked,
+                                  uint64_t inFlight, time::steady_clock::TimePoint now)
+            {
+                m_delivered = sample.priorDelivered + sample.delivered;
+                updateRound(sample);
+                if (m_isRoundStart)
+                {
+                    // the lower bounds react once per round trip with loss or marks
+                    adaptLowerBounds();
+                    m_roundDelivered = 0;
+                    m_roundLost = 0;
+                    m_roundMarked = 0;
+                    m_isLossInRound = false;
+                    m_bwLatest = 0;
+                    m_inflightLatest = 0;
+                    ++m_cycleRounds;
+                }
+                m_roundDelivered += size;
+                if (isMarked)
+                {
+                    m_roundMarked += size;
+                }
+
+                updateMinRtt(rtt, now);
+                updateBandwidth(sample);
+                checkFullPipe(sample);
+                if (isInflightTooHigh(sample.txInFlight))
+                {
+                    onInflightTooHigh(sample.txInFlight, now);
+                }
+
+                switch (m_mode)
+                {
+                case STARTUP:
+                    if (m_isFullPipe)
+                    {
+                        enterDrain();
+                    }
+                    break;
+                case DRAIN:
+                    if (inFlight <= getBdp(1))
+                    {
+                        enterProbeBwDown(now);
+                    }
+                    break;
+                case PROBE_BW_DOWN:
+                case PROBE_BW_CRUISE:
+                case PROBE_BW_REFILL:
+                case PROBE_BW_UP:
+                    updateProbeBw(inFlight, now);
+                    break;
+                case PROBE_RTT:
+                    break;
+                }
+
+                if (m_isProbeRttMinExpired && m_mode != PROBE_RTT)
+                {
+                    enterProbeRtt();
+                }
+                updateProbeRtt(inFlight, now);
+
+                updateCwnd(size);
+                updatePacingRate();
+            }
+
+            void BbrModel::onLoss(size_t size, uint64_t inFlight, time::steady_clock::TimePoint now)
+            {
+                m_roundLost += size;
+                m_isLossInRound = true;
+                if (isInflightTooHigh(inFlight + size))
+                {
+                    onInflightTooHigh(inFlight + size, now);
+                }
+                updateCwnd(0);
+                updatePacingRate();
+            }
+
+            void BbrModel::updateRound(const RateSample &sample)
+            {
+                m_isRoundStart = false;
+                if (sample.priorDelivered >= m_nextRoundDelivered)
+                {
+                    // the Data of the first Interest sent in the round, so the round trip is over
+                    m_nextRoundDelivered = m_delivered;
+                    ++m_roundCount;
+                    m_isRoundStart = true;
+                }
+            }
+
+            void BbrModel::updateMinRtt(time::nanoseconds rtt, time::steady_clock::TimePoint now)
+            {
+                m_isProbeRttMinExpired = m_hasMinRtt && now > m_probeRttMinStamp + PROBE_RTT_INTERVAL;
+                if (rtt <= time::nanoseconds::zero())
+                {
+                    return;
+                }
+
+                if (!m_hasMinRtt || rtt <= m_probeRttMin || m_isProbeRttMinExpired)
+                {
+                    m_probeRttMin = rtt;
+                    m_probeRttMinStamp = now;
+                }
+                if (!m_hasMinRtt || m_probeRttMin <= m_minRtt || now > m_minRttStamp + MIN_RTT_WINDOW)
+                {
+                    m_minRtt = m_probeRttMin;
+                    m_minRttStamp = m_probeRttMinStamp;
+                    m_hasMinRtt = true;
+                }
+            }
+
+            void BbrModel::updateBandwidth(const RateSample &sample)
+            {
+                m_inflightLatest = std::max(m_inflightLatest, static_cast<double>(sample.delivered));
+                if (sample.deliveryRate <= 0 || (m_hasMinRtt && sample.interval < m_minRtt))
+                {
+                    // an interval shorter than a round trip overestimates the rate
+                    return;
+                }
+
+                m_bwLatest = std::max(m_bwLatest, sample.deliveryRate);
+                if (!sample.isAppLimited || sample.deliveryRate >= getMaxBandwidth())
+                {
+                    m_bwHi[1] = std::max(m_bwHi[1], sample.deliveryRate);
+                }
+            }
+
+            void BbrModel::checkFullPipe(const RateSample &sample)
+            {
+                if (m_isFullPipe || !m_isRoundStart || sample.isAppLimited)
+                {
+                    return;
+                }
+                if (getMaxBandwidth() >= m_fullBw * FULL_BW_GROWTH)
+                {
+                    m_fullBw = getMaxBandwidth();
+                    m_fullBwCount = 0;
+                    return;
+                }
+                if (++m_fullBwCount >= FULL_BW_ROUNDS)
+                {
+                    m_isFullPipe = true;
+                }
+            }
+
+            bool BbrModel::isInflightTooHigh(double txInFlight) const
+            {
+                // early in a round, the bytes in flight are a better measure of the load than the
+                // few delivered so far
+                double volume = std::max<double>(m_roundDelivered + m_roundLost, txInFlight);
+                return (m_roundLost > 0 && m_roundLost > LOSS_THRESH * volume) ||
+                       (m_roundMarked > 0 && m_roundMarked > ECN_THRESH * volume);
+            }
+
+            void BbrModel::onInflightTooHigh(double txInFlight, time::steady_clock::TimePoint now)
+            {
+                m_isLossInRound = true;
+                if (m_mode == STARTUP)
+                {
+                    if (!m_isFullPipe)
+                    {
+                        m_isFullPipe = true;
+                        m_inflightHi = std::max(getBdp(1), m_inflightLatest);
+                    }
+                }
+                else if (m_mode == PROBE_BW_REFILL || m_mode == PROBE_BW_UP)
+                {
+                    m_inflightHi = std::max(txInFlight, getBdp(1) * BETA);
+                    enterProbeBwDown(now);
+                }
+            }
+
+            void BbrModel::adaptLowerBounds()
+            {
+                if (!m_isLossInRound || isProbingBandwidth())
+                {
+                    return;
+                }
+                if (m_bwLo == INFINITE)
+                {
+                    m_bwLo = getMaxBandwidth();
+                }
+                if (m_inflightLo == INFINITE)
+                {
+                    m_inflightLo = m_cwnd;
+                }
+                m_bwLo = std::max(m_bwLatest, m_bwLo * BETA);
+                m_inflightLo = std::max(m_inflightLatest, m_inflightLo * BETA);
+            }
+
+            void BbrModel::resetLowerBounds()
+            {
+                m_bwLo = INFINITE;
+                m_inflightLo = INFINITE;
+            }
+
+            void BbrModel::updateProbeBw(uint64_t inFlight, time::steady_clock::TimePoint now)
+            {
+                switch (m_mode)
+                {
+                case PROBE_BW_DOWN:
+                    if (isTimeToProbe(now))
+                    {
+                        enterProbeBwRefill();
+                    }
+                    else if (inFlight <= std::min(getBdp(1), (1 - HEADROOM) * m_inflightHi))
+                    {
+                        // the queue is drained, and there is headroom for other flows
+                        enterProbeBwCruise();
+                    }
+                    break;
+                case PROBE_BW_CRUISE:
+                    if (isTimeToProbe(now))
+                    {
+                        enterProbeBwRefill();
+                    }
+                    break;
+                case PROBE_BW_REFILL:
+                    // a round trip at the refilled window, before the queue may grow
+                    if (m_isRoundStart)
+                    {
+                        enterProbeBwUp(now);
+                    }
+                    break;
+                case PROBE_BW_UP:
+                    if (m_isRoundStart)
+                    {
+                        ++m_probeUpRounds;
+                        if (m_inflightHi != INFINITE && m_cwnd + m_dataSize > m_inflightHi)
+                        {
+                            // limited by inflight_hi: raise it 1, 2, 4... Data per round trip
+                            m_inflightHi += m_dataSize * (1 << std::min<uint32_t>(m_probeUpRounds - 1, 20));
+                        }
+                    }
+                    // probed for a round trip, and the extra Data queue up instead of raising the rate
+                    if (now - m_probeUpStamp >= m_minRtt && inFlight >= getBdp(PROBE_UP_GAIN))
+                    {
+                        enterProbeBwDown(now);
+                    }
+                    break;
+                default:
+                    break;
+                }
+            }
+
+            bool BbrModel::isTimeToProbe(time::steady_clock::TimePoint now) const
+            {
+                // as often as Reno would fill the BDP, to be fair to loss-based flows
+                uint64_t renoRounds = std::min<uint64_t>(MAX_PROBE_ROUNDS, static_cast<uint64_t>(getBdp(1) / m_dataSize));
+                return now - m_cycleStamp >= m_probeWait || m_cycleRounds >= renoRounds;
+            }
+
+            void BbrModel::updateProbeRtt(uint64_t inFlight, time::steady_clock::TimePoint now)
+            {
+                if (m_mode != PROBE_RTT)
+                {
+                    return;
+                }
+                if (!m_hasProbeRttDoneStamp)
+                {
+                    if (inFlight <= getProbeRttCwnd())
+                    {
+                        m_probeRttDoneStamp = now + PROBE_RTT_DURATION;
+                        m_hasProbeRttDoneStamp = true;
+                        m_isProbeRttRoundDone = false;
+                        startRound();
+                    }
+                    return;
+                }
+                if (m_isRoundStart)
+                {
+                    m_isProbeRttRoundDone = true;
+                }
+                if (m_isProbeRttRoundDone && now >= m_probeRttDoneStamp)
+                {
+                    exitProbeRtt(now);
+                }
+            }
+
+            void BbrModel::enterStartup()
+            {
+                m_mode = STARTUP;
+                m_pacingGain = STARTUP_GAIN;
+                m_cwndGain = STARTUP_GAIN;
+            }
+
+            void BbrModel::enterDrain()
+            {
+                m_mode = DRAIN;
+                m_pacingGain = DRAIN_GAIN;
+                m_cwndGain = STARTUP_GAIN;
+            }
+
+            void BbrModel::enterProbeBwDown(time::steady_clock::TimePoint now)
+            {
+                m_mode = PROBE_BW_DOWN;
+                m_pacingGain = PROBE_DOWN_GAIN;
+                m_cwndGain = CWND_GAIN;
+
+                // a new cycle: the bandwidth filter keeps the maximum of this cycle and the last
+                m_bwHi[0] = m_bwHi[1];
+                m_bwHi[1] = 0;
+                m_cycleStamp = now;
+                m_cycleRounds = 0;
+                std::uniform_int_distribution<time::nanoseconds::rep> jitter(0, time::nanoseconds(time::seconds(1)).count());
+                m_probeWait = time::nanoseconds(PROBE_WAIT_BASE) + time::nanoseconds(jitter(m_random));
+                startRound();
+            }
+
+            void BbrModel::enterProbeBwCruise()
+            {
+                m_mode = PROBE_BW_CRUISE;
+                m_pacingGain = 1;
+                m_cwndGain = CWND_GAIN;
+            }
+
+            void BbrModel::enterProbeBwRefill()
+            {
+                m_mode = PROBE_BW_REFILL;
+                m_pacingGain = 1;
+                m_cwndGain = CWND_GAIN;
+                resetLowerBounds();
+                startRound();
+            }
+
+            void BbrModel::enterProbeBwUp(time::steady_clock::TimePoint now)
+            {
+                m_mode = PROBE_BW_UP;
+                m_pacingGain = PROBE_UP_GAIN;
+                m_cwndGain = CWND_GAIN;
+                m_probeUpRounds = 0;
+                m_probeUpStamp = now;
+                startRound();
+            }
+
+            void BbrModel::enterProbeRtt()
+            {
+                m_mode = PROBE_RTT;
+                m_pacingGain = 1;
+                m_cwndGain = 1;
+                m_hasProbeRttDoneStamp = false;
+                m_isProbeRttRoundDone = false;
+            }
+
+            void BbrModel::exitProbeRtt(time::steady_clock::TimePoint now)
+            {
+                m_probeRttMinStamp = now;
+                resetLowerBounds();
+                if (m_isFullPipe)
+                {
+                    enterProbeBwDown(now);
+                    enterProbeBwCruise();
+                }
+                else
+                {
+                    enterStartup();
+                }
+            }
+
+            double BbrModel::getBdp(double gain) const
+            {
+                double bw = getBandwidth();
+                if (!m_hasMinRtt || bw <= 0)
+                {
+                    return INITIAL_CWND * m_dataSize;
+                }
+                return gain * bw * m_minRtt.count() * 1e-9;
+            }
+
+            double BbrModel::getInflightBound() const
+            {
+                double bound = m_inflightHi;
+                if (m_mode == PROBE_BW_CRUISE)
+                {
+                    // headroom for other flows
+                    bound *= 1 - HEADROOM;
+                }
+                return std::min(bound, m_inflightLo);
+            }
+
+            double BbrModel::getProbeRttCwnd() const
+            {
+                return std::max(getBdp(0.5), MIN_CWND * m_dataSize);
+            }
+
+            void BbrModel::updateCwnd(size_t size)
+            {
+                double target = getBdp(m_cwndGain);
+                if (m_isFullPipe)
+                {
+                    m_cwnd = std::min(m_cwnd + size, target);
+                }
+                else if (m_cwnd < target || m_delivered < INITIAL_CWND * m_dataSize)
+                {
+                    m_cwnd += size;
+                }
+
+                m_cwnd = std::min(m_cwnd, getInflightBound());
+                if (m_mode == PROBE_RTT)
+                {
+                    m_cwnd = std::min(m_cwnd, getProbeRttCwnd());
+                }
+                m_cwnd = std::max(m_cwnd, MIN_CWND * m_dataSize);
+            }
+
+            void BbrModel::updatePacingRate()
+            {
+                double bw = getBandwidth();
+                if (bw <= 0)
+                {
+                    // no sample yet: the initial window over the RTT, or over 1 ms without one
+                    double rtt = m_hasMinRtt ? m_minRtt.count() * 1e-9 : 1e-3;
+                    m_pacingRate = STARTUP_GAIN * INITIAL_CWND * m_dataSize / rtt;
+                    return;
+                }
+
+                double rate = m_pacingGain * bw * (1 - PACING_MARGIN);
+                if (m_isFullPipe || rate > m_pacingRate || m_roundCount <= 1)
+                {
+                    // past the guess of the first round trip, STARTUP never slows down on a low sample
+                    m_pacingRate = rate;
+                }
+            }
+
+            std::ostream &
+            operator<<(std::ostream &os, BbrModel::Mode mode)
+            {
+                switch (mode)
+                {
+                case BbrModel::STARTUP:
+                    return os << "STARTUP";
+                case BbrModel::DRAIN:
+                    return os << "DRAIN";
+                case BbrModel::PROBE_BW_DOWN:
+                    return os << "PROBE_BW_DOWN";
+                case BbrModel::PROBE_BW_CRUISE:
+                    return os << "PROBE_BW_CRUISE";
+                case BbrModel::PROBE_BW_REFILL:
+                    return os << "PROBE_BW_REFILL";
+                case BbrModel::PROBE_BW_UP:
+                    return os << "PROBE_BW_UP";
+                case BbrModel::PROBE_RTT:
+                    return os << "PROBE_RTT";
+                }
+                return os << static_cast<int>(mode);
+            }
+        }
+    }
+}
@@ -0,0 +1,331 @@
+#ifndef CC_BBR_BBR_MODEL_H
+#define CC_BBR_BBR_MODEL_H
+#include "core/common.hpp"
+#include "tools/cc/common/delivery-rate-sampler.hpp"
+
+#include <algorithm>
+#include <random>
+
+namespace ndn
+{
+    namespace cc
+    {
+        namespace client
+        {
+            /**
+             * @brief Network path model and state machine of BBRv2, driven by delivery rate samples
+             *
+             * The model estimates the bottleneck bandwidth as the maximum delivery rate of the last
+             * two bandwidth probing cycles, and the propagation delay as the minimum RTT of the last
+             * 10 s; their product is the BDP. The consumer paces at pacing gain * bandwidth and
+             * keeps at most the congestion window in flight.
+             *
+             * Loss and congestion marks bound the window: a round trip with more than 2% of its Data
+             * lost or more than half of it marked sets the upper bound inflight_hi while probing,
+             * and otherwise lowers the short-term bounds bw_lo and inflight_lo by BETA, which are
+             * lifted again at the next probe.
+             *
+             * States:
+             *  - STARTUP: doubles the rate every round trip until the bandwidth stops growing by
+             *    25% for 3 rounds, or loss or marks exceed their thresholds
+             *  - DRAIN: drains the queue built in STARTUP, down to one BDP in flight
+             *  - PROBE_BW_DOWN, PROBE_BW_CRUISE, PROBE_BW_REFILL, PROBE_BW_UP: the bandwidth
+             *    probing cycle, which leaves headroom below inflight_hi while cruising and probes
+             *    above it every 2 to 3 s, or sooner on a small BDP
+             *  - PROBE_RTT: when the minimum RTT was not refreshed for 5 s, halves the window
+             *    for 200 ms and a round trip to let the queue drain
+             *
+             * All quantities are in bytes and bytes per second; @p dataSize converts them to Data.
+             */
+            class BbrModel
+            {
+            public:
+                enum Mode
+                {
+                    STARTUP,
+                    DRAIN,
+                    PROBE_BW_DOWN,
+                    PROBE_BW_CRUISE,
+                    PROBE_BW_REFILL,
+                    PROBE_BW_UP,
+                    PROBE_RTT
+                };
+
+                /**
+                 * @param dataSize expected Data size, until setDataSize()
+                 * @param seed seed of the random wait between bandwidth probes
+                 */
+                BbrModel(double dataSize, uint32_t seed, time::steady_clock::TimePoint now);
+
+                /**
+                 * @brief Updates the model with the Data of @p sample
+                 * @param size bytes of that Data
+                 * @param rtt RTT of the Data, or zero when ambiguous (retransmission)
+                 * @param isMarked whether the Data carries a congestion mark
+                 * @param inFlight bytes still in flight after the Data
+                 */
+                void
+                onData(const RateSample &sample, size_t size, time::nanoseconds rtt, bool isMarked,
+                       uint64_t inFlight, time::steady_clock::TimePoint now);
+
+                /**
+                 * @brief Accounts for a lost Interest
+                 * @param size bytes expected for its Data
+                 * @param inFlight bytes still in flight after the loss
+                 */
+                void
+                onLoss(size_t size, uint64_t inFlight, time::steady_clock::TimePoint now);
+
+                void
+                setDataSize(double dataSize)
+                {
+                    m_dataSize = dataSize;
+                }
+
+                Mode
+                getMode() const
+                {
+                    return m_mode;
+                }
+
+                /**
+                 * @brief Returns the pacing rate, in bytes per second
+                 */
+                double
+                getPacingRate() const
+                {
+                    return m_pacingRate;
+                }
+
+                /**
+                 * @brief Returns the congestion window, in bytes
+                 */
+                double
+                getCwnd() const
+                {
+                    return m_cwnd;
+                }
+
+                /**
+                 * @brief Returns the bandwidth estimate, bounded by bw_lo, in bytes per second
+                 */
+                double
+                getBandwidth() const;
+
+                /**
+                 * @brief Returns the minimum RTT, or zero before the first sample
+                 */
+                time::nanoseconds
+                getMinRtt() const
+                {
+                    return m_hasMinRtt ? m_minRtt : time::nanoseconds::zero();
+                }
+
+                /**
+                 * @brief Returns inflight_hi, in bytes (infinite until loss or marks while probing)
+                 */
+                double
+                getInflightHi() const
+                {
+                    return m_inflightHi;
+                }
+
+                /**
+                 * @brief Returns whether STARTUP found the bandwidth
+                 */
+                bool
+                isFullPipe() const
+                {
+                    return m_isFullPipe;
+                }
+
+                uint64_t
+                getRoundCount() const
+                {
+                    return m_roundCount;
+                }
+
+            public:
+                static constexpr double STARTUP_GAIN = 2.885; ///< \brief 2/ln(2), doubles the rate per round
+                static constexpr double DRAIN_GAIN = 1 / 2.885;
+                static constexpr double CWND_GAIN = 2;
+                static constexpr double PROBE_UP_GAIN = 1.25;
+                static constexpr double PROBE_DOWN_GAIN = 0.75;
+                static constexpr double LOSS_THRESH = 0.02;
+                static constexpr double ECN_THRESH = 0.5;
+                static constexpr double BETA = 0.7;
+                static constexpr double HEADROOM = 0.15;
+                static constexpr double PACING_MARGIN = 0.01;
+                static constexpr uint32_t INITIAL_CWND = 10; ///< \brief in Data
+                static constexpr uint32_t MIN_CWND = 4;      ///< \brief in Data
+
+            private:
+                void
+                updateRound(const RateSample &sample);
+
+                void
+                updateMinRtt(time::nanoseconds rtt, time::steady_clock::TimePoint now);
+
+                void
+                updateBandwidth(const RateSample &sample);
+
+                void
+                checkFullPipe(const RateSample &sample);
+
+                /**
+                 * @brief Returns whether loss or marks exceed their thresholds in the current round
+                 * @param txInFlight bytes in flight when the Interest of the last loss or Data was sent
+                 */
+                bool
+                isInflightTooHigh(double txInFlight) const;
+
+                /**
+                 * @param txInFlight bytes in flight when the Interest of the loss or mark was sent
+                 */
+                void
+                onInflightTooHigh(double txInFlight, time::steady_clock::TimePoint now);
+
+                void
+                adaptLowerBounds();
+
+                void
+                resetLowerBounds();
+
+                void
+                updateProbeBw(uint64_t inFlight, time::steady_clock::TimePoint now);
+
+                void
+                updateProbeRtt(uint64_t inFlight, time::steady_clock::TimePoint now);
+
+                /**
+                 * @brief Starts a round trip at the Data sent from now on
+                 */
+                void
+                startRound()
+                {
+                    m_nextRoundDelivered = m_delivered;
+                }
+
+                void
+                enterStartup();
+
+                void
+                enterDrain();
+
+                void
+                enterProbeBwDown(time::steady_clock::TimePoint now);
+
+                void
+                enterProbeBwCruise();
+
+                void
+                enterProbeBwRefill();
+
+                void
+                enterProbeBwUp(time::steady_clock::TimePoint now);
+
+                void
+                enterProbeRtt();
+
+                void
+                exitProbeRtt(time::steady_clock::TimePoint now);
+
+                bool
+                isProbingBandwidth() const
+                {
+                    return m_mode == STARTUP || m_mode == PROBE_BW_REFILL || m_mode == PROBE_BW_UP;
+                }
+
+                bool
+                isTimeToProbe(time::steady_clock::TimePoint now) const;
+
+                /**
+                 * @brief Returns @p gain times the BDP, or the initial window without a model yet
+                 */
+                double
+                getBdp(double gain) const;
+
+                /**
+                 * @brief Returns the window allowed by inflight_hi and inflight_lo in the current state
+                 */
+                double
+                getInflightBound() const;
+
+                double
+                getProbeRttCwnd() const;
+
+                double
+                getMaxBandwidth() const
+                {
+                    return std::max(m_bwHi[0], m_bwHi[1]);
+                }
+
+                void
+                updateCwnd(size_t size);
+
+                void
+                updatePacingRate();
+
+            private:
+                double m_dataSize;
+                std::minstd_rand m_random;
+                Mode m_mode;
+
+                // round trips, delimited by the delivered bytes
+                uint64_t m_delivered;
+                uint64_t m_roundCount;
+                uint64_t m_nextRoundDelivered;
+                bool m_isRoundStart;
+
+                // bandwidth, the maximum of the current and previous probing cycles
+                double m_bwHi[2];
+                double m_bwLo;
+                double m_bwLatest; ///< \brief maximum delivery rate of the current round
+
+                // minimum RTT, refreshed by PROBE_RTT
+                bool m_hasMinRtt;
+                time::nanoseconds m_minRtt;
+                time::steady_clock::TimePoint m_minRttStamp;
+                time::nanoseconds m_probeRttMin;
+                time::steady_clock::TimePoint m_probeRttMinStamp;
+                bool m_isProbeRttMinExpired;
+                time::steady_clock::TimePoint m_probeRttDoneStamp;
+                bool m_isProbeRttRoundDone;
+                bool m_hasProbeRttDoneStamp;
+
+                // STARTUP exit
+                bool m_isFullPipe;
+                double m_fullBw;
+                uint32_t m_fullBwCount;
+
+                // loss and congestion marks of the current round
+                uint64_t m_roundDelivered;
+                uint64_t m_roundLost;
+                uint64_t m_roundMarked;
+                bool m_isLossInRound;
+                double m_inflightLatest; ///< \brief maximum bytes delivered by a sample of the current round
+
+                // inflight bounds
+                double m_inflightHi;
+                double m_inflightLo;
+
+                // bandwidth probing cycle
+                time::steady_clock::TimePoint m_cycleStamp;
+                uint64_t m_cycleRounds;
+                time::nanoseconds m_probeWait;
+                uint32_t m_probeUpRounds;
+                time::steady_clock::TimePoint m_probeUpStamp;
+
+                double m_pacingGain;
+                double m_cwndGain;
+                double m_pacingRate;
+                double m_cwnd;
+            };
+
+            std::ostream &
+            operator<<(std::ostream &os, BbrModel::Mode mode);
+        }
+    }
+}
+
+#endif // CC_BBR_BBR_MODEL_H
@@ -1,6 +1,7 @@
 #include "core/common.hpp"
 #include "core/version.hpp"
 #include "bbr-consumer.hpp"
+#include "tools/cc/server/emulation.hpp"
 #include <iostream>
 
 namespace ndn
@@ -12,7 +13,9 @@ namespace ndn
             class Runner : noncopyable
             {
             public:
-                explicit Runner(const Options &options) : m_consumer(m_face, options)
+                Runner(Face &face, const Options &options)
+                    : m_face(face),
+                      m_consumer(face, options)
                 {
                     m_consumer.afterFinish.connect([this]
                                                    { this->cancel(); });
@@ -20,11 +23,21 @@ namespace ndn
 
                 int
                 run()
+                {
+                    return run([this]
+                               { m_face.processEvents(); });
+                }
+
+                /**
+                 * @brief Starts the consumer and lets @p processEvents run the event loop
+                 */
+                int
+                run(const std::function<void()> &processEvents)
                 {
                     try
                     {
                         m_consumer.start();
-                        m_face.processEvents();
+                        processEvents();
                     }
                     catch (const std::exception &e)
                     {
@@ -35,6 +48,12 @@ namespace ndn
                     return 0;
                 }
 
+                BbrConsumer &
+                getConsumer()
+                {
+                    return m_consumer;
+                }
+
             private:
                 void
                 cancel()
@@ -43,10 +62,44 @@ namespace ndn
                 }
 
             private:
-                Face m_face;
+                Face &m_face;
                 BbrConsumer m_consumer;
             };
 
+            /**
+             * @brief Runs the consumer against an in-process producer over an emulated link
+             *
+             * In simulated time, the run takes as long as the handlers take to execute.
+             */
+            static int
+            runEmulation(const std::string &spec, const Options &options, bool isSimulated)
+            {
+                EmulatedLink::Options linkOptions;
+                try
+                {
+                    linkOptions = EmulatedLink::parseOptions(spec);
+                }
+                catch (const std::invalid_argument &e)
+                {
+                    std::cerr << "ERROR: " << e.what() << std::endl;
+                    return 2;
+                }
+
+                server::Emulation emulation(linkOptions, options.prefix, options.dsz, isSimulated);
+                // the trace clock restarts on the clocks of the emulation
+                getTraceWriter().restartClock();
+                Runner runner(emulation.getConsumerFace(), options);
+                runner.getConsumer().afterFinish.connect([&emulation]
+                                                         { emulation.stop(); });
+                emulation.start();
+                std::cout << "PING " << options.prefix << " (" << (isSimulated ? "simulated" : "emulated")
+                          << " link " << spec << ")" << std::endl;
+                int status = runner.run([&emulation]
+                                        { emulation.run(); });
+                emulation.printStats(std::cout);
+                return status;
+            }
+
             static void
             usage(const boost::program_options::options_description &options)
             {
@@ -63,6 +116,9 @@ namespace ndn
             main(int argc, char *argv[])
             {
                 Options options;
+                std::string traceFile;
+                std::string emulateSpec;
+                bool isSimulated = false;
                 // options.shouldAllowStaleData = false;
                 // options.nPings = -1;
                 // options.interval = time::milliseconds(getDefaultPingInterval());
@@ -78,11 +134,11 @@ namespace ndn
                 po::options_description visibleOptDesc("Options");
                 visibleOptDesc.add_options()("help,h", "print this message and exit")("version,V", "display version and exit");
                 visibleOptDesc.add_options()(
-                    "startSeq", po::value<uint32_t>(&options.startSeq)->default_value(0), "start sequence number");
+                    "startSeq", po::value<uint64_t>(&options.startSeq)->default_value(0), "start sequence number");
                 visibleOptDesc.add_options()(
                     "seqMax", po::value<int64_t>(&options.seqMax)->default_value(-1), "maximum sequence number");
                 visibleOptDesc.add_options()(
-                    "dsz", po::value<uint32_t>(&options.dsz)->default_value(8624), "data size");
+                    "dsz", po::value<uint32_t>(&options.dsz)->default_value(8624), "expected data size, until the size of the Data received is known");
                 visibleOptDesc.add_options()(
                     "delayStart", po::value<uint32_t>(&options.delayStart)->default_value(0), "delay start time, in milliseconds");
                 visibleOptDesc.add_options()(
@@ -93,6 +149,16 @@ namespace ndn
                     "delayGreedy", po::value<int32_t>(&options.delayGreedy)->default_value(-1), "delay greedy, in milliseconds");
                 visibleOptDesc.add_options()(
                     "greedyRate", po::value<int32_t>(&options.greedyRate)->default_value(-1), "greedy rate, in milliseconds");
+                visibleOptDesc.add_options()(
+                    "trace", po::value<std::string>(&traceFile), "write delay, rate and window samples into a binary trace file instead of stdout (read it back with cc-trace)");
+                visibleOptDesc.add_options()(
+                    "emulate", po::value<std::string>(&emulateSpec),
+                    "run against an in-process producer over an emulated link, KEY=VALUE[,KEY=VALUE]... with KEY among "
+                    "bw (Mbit/s), delay (ms), queue (packets), loss (probability), aqm (none, codel or step), "
+                    "target (ms), interval (ms), mark (packets) and seed");
+                visibleOptDesc.add_options()(
+                    "simulate", po::bool_switch(&isSimulated),
+                    "with --emulate, run in deterministic simulated time, as fast as possible (end the run with --timingStop or --seqMax)");
                 visibleOptDesc.add_options()(
                     "lifetime", po::value<time::milliseconds::rep>()->default_value(4000), "Interest lifetime, in milliseconds");
 
@@ -140,7 +206,32 @@ namespace ndn
                     usage(visibleOptDesc);
                 }
 
-                return Runner(options).run();
+                if (isSimulated && emulateSpec.empty())
+                {
+                    std::cerr << "ERROR: --simulate requires --emulate" << std::endl;
+                    return 2;
+                }
+
+                if (!traceFile.empty())
+                {
+                    try
+                    {
+                        getTraceWriter().open(traceFile);
+                        getTraceWriter().flushInBackground();
+                    }
+                    catch (const std::runtime_error &e)
+                    {
+                        std::cerr << "ERROR: " << e.what() << std::endl;
+                        return 2;
+                    }
+                }
+
+                if (!emulateSpec.empty())
+                {
+                    return runEmulation(emulateSpec, options, isSimulated);
+                }
+                Face face;
+                return Runner(face, options).run();
             }
         }
     }
@@ -1,7 +1,13 @@
 #include "core/common.hpp"
 #include "core/version.hpp"
+#include "multi-flow.hpp"
 #include "qsccp-consumer.hpp"
+#include "tools/cc/server/emulation.hpp"
+
+#include <algorithm>
+#include <atomic>
 #include <iostream>
+#include <thread>
 
 namespace ndn
 {
@@ -12,7 +18,9 @@ namespace ndn
             class Runner : noncopyable
             {
             public:
-                explicit Runner(const Options &options) : m_consumer(m_face, options)
+                Runner(Face &face, const Options &options)
+                    : m_face(face),
+                      m_consumer(face, options)
                 {
                     m_consumer.afterFinish.connect([this]
                                                    { this->cancel(); });
@@ -20,11 +28,21 @@ namespace ndn
 
                 int
                 run()
+                {
+                    return run([this]
+                               { m_face.processEvents(); });
+                }
+
+                /**
+                 * @brief Starts the consumer and lets @p processEvents run the event loop
+                 */
+                int
+                run(const std::function<void()> &processEvents)
                 {
                     try
                     {
                         m_consumer.start();
-                        m_face.processEvents();
+                        processEvents();
                     }
                     catch (const std::exception &e)
                     {
@@ -35,6 +53,12 @@ namespace ndn
                     return 0;
                 }
 
+                QsccpConsumer &
+                getConsumer()
+                {
+                    return m_consumer;
+                }
+
             private:
                 void
                 cancel()
@@ -43,10 +67,222 @@ namespace ndn
                 }
 
             private:
-                Face m_face;
+                Face &m_face;
                 QsccpConsumer m_consumer;
             };
 
+            /**
+             * @brief Consumers sharing a Face, driven by their own thread
+             */
+            class Worker : noncopyable
+            {
+            public:
+                const QsccpConsumer &
+                addFlow(const Options &options)
+                {
+                    m_consumers.push_back(make_unique<QsccpConsumer>(m_face, options));
+                    return *m_consumers.back();
+                }
+
+                void
+                start()
+                {
+                    m_isRunning = true;
+                    m_thread = std::thread([this]
+                                           { run(); });
+                }
+
+                void
+                join()
+                {
+                    if (m_thread.joinable())
+                    {
+                        m_thread.join();
+                    }
+                }
+
+                bool
+                isRunning() const
+                {
+                    return m_isRunning;
+                }
+
+                bool
+                hasFailed() const
+                {
+                    return m_hasFailed;
+                }
+
+            private:
+                void
+                run()
+                {
+                    try
+                    {
+                        for (const auto &consumer : m_consumers)
+                        {
+                            consumer->start();
+                        }
+                        m_face.processEvents();
+                    }
+                    catch (const std::exception &e)
+                    {
+                        std::cerr << "ERROR: " << e.what() << std::endl;
+                        m_hasFailed = true;
+                    }
+                    m_isRunning = false;
+                }
+
+            private:
+                Face m_face;
+                std::vector<unique_ptr<QsccpConsumer>> m_consumers;
+
+                std::thread m_thread;
+                std::atomic<bool> m_isRunning{false};
+                std::atomic<bool> m_hasFailed{false};
+            };
+
+            /**
+             * @brief Runs several consumers over a pool of Faces and reports per-flow statistics
+             *
+             * Flows are spread round-robin over the workers. Instead of the per-packet samples, every
+             * stats interval prints one line per flow and one aggregate line with Jain's fairness
+             * index over the throughputs of the flows that received Data during the interval.
+             */
+            class MultiFlowRunner : noncopyable
+            {
+            public:
+                MultiFlowRunner(const std::vector<Options> &flows, size_t nThreads, time::milliseconds statsInterval)
+                    : m_flows(flows),
+                      m_statsInterval(statsInterval)
+                {
+                    for (size_t i = 0; i < std::min(nThreads, m_flows.size()); ++i)
+                    {
+                        m_workers.push_back(make_unique<Worker>());
+                    }
+                    for (size_t i = 0; i < m_flows.size(); ++i)
+                    {
+                        m_consumers.push_back(&m_workers[i % m_workers.size()]->addFlow(m_flows[i]));
+                    }
+                }
+
+                int
+                run()
+                {
+                    for (const auto &worker : m_workers)
+                    {
+                        worker->start();
+                    }
+
+                    if (m_statsInterval > 0_ms)
+                    {
+                        reportStats();
+                    }
+
+                    bool hasFailed = false;
+                    for (const auto &worker : m_workers)
+                    {
+                        worker->join();
+                        hasFailed = hasFailed || worker->hasFailed();
+                    }
+                    return hasFailed ? 2 : 0;
+                }
+
+            private:
+                /**
+                 * @brief Prints per-flow and aggregate statistics until every worker has stopped
+                 */
+                void
+                reportStats()
+                {
+                    std::vector<FlowStats> last(m_consumers.size());
+                    std::vector<HistogramSnapshot> lastDelay(m_consumers.size());
+                    double seconds = m_statsInterval.count() / 1e3;
+                    auto toUs = [](time::nanoseconds d)
+                    { return d.count() / 1e3; };
+
+                    uint64_t nReports = 0;
+                    while (std::any_of(m_workers.begin(), m_workers.end(),
+                                       [](const auto &worker)
+                                       { return worker->isRunning(); }))
+                    {
+                        std::this_thread::sleep_for(std::chrono::milliseconds(m_statsInterval.count()));
+                        ++nReports;
+
+                        FlowStats total;
+                        HistogramSnapshot totalDelay;
+                        std::vector<double> throughputs;
+                        for (size_t i = 0; i < m_consumers.size(); ++i)
+                        {
+                            auto stats = m_consumers[i]->getCounters().snapshot();
+                            auto diff = stats - last[i];
+                            last[i] = stats;
+                            auto delay = m_consumers[i]->getCounters().getDelayHistogram().snapshot();
+                            auto delayDiff = delay - lastDelay[i];
+                            lastDelay[i] = std::move(delay);
+
+                            total += diff;
+                            totalDelay += delayDiff;
+                            if (diff.nData > 0)
+                            {
+                                throughputs.push_back(diff.nBytes / seconds);
+                            }
+
+                            // throughput in bytes per second and delay percentiles in microseconds
+                            std::cout << "cc:flow:<" << nReports << "," << i << "," << diff.nData << ","
+                                      << diff.nBytes / seconds << ","
+                                      << toUs(delayDiff.getPercentile(50)) << ","
+                                      << toUs(delayDiff.getPercentile(99)) << ">\n";
+                        }
+                        std::cout << "cc:flows:<" << nReports << "," << total.nData << ","
+                                  << total.nBytes / seconds << ","
+                                  << toUs(totalDelay.getPercentile(50)) << ","
+                                  << toUs(totalDelay.getPercentile(99)) << ","
+                                  << computeJainIndex(throughputs) << ">" << std::endl;
+                    }
+                }
+
+            private:
+                const std::vector<Options> &m_flows;
+                time::milliseconds m_statsInterval;
+                std::vector<unique_ptr<Worker>> m_workers;
+                std::vector<const QsccpConsumer *> m_consumers; ///< \brief indexed by flow
+            };
+
+            /**
+             * @brief Runs the consumer against an in-process producer over an emulated link
+             *
+             * In simulated time, the run takes as long as the handlers take to execute.
+             */
+            static int
+            runEmulation(const std::string &spec, const Options &options, bool isSimulated)
+            {
+                EmulatedLink::Options linkOptions;
+                try
+                {
+                    linkOptions = EmulatedLink::parseOptions(spec);
+                }
+                catch (const std::invalid_argument &e)
+                {
+                    std::cerr << "ERROR: " << e.what() << std::endl;
+                    return 2;
+                }
+
+                server::Emulation emulation(linkOptions, options.prefix, options.dsz, isSimulated);
+                // the trace clock restarts on the clocks of the emulation
+                getTraceWriter().restartClock();
+                Runner runner(emulation.getConsumerFace(), options);
+                runner.getConsumer().afterFinish.connect([&emulation]
+                                                         { emulation.stop(); });
+                emulation.start();
+                std::cout << "PING " << options.prefix << " (" << (isSimulated ? "simulated" : "emulated")
+                          << " link " << spec << ")" << std::endl;
+                int status = runner.run([&emulation]
+                                        { emulation.run(); });
+                emulation.printStats(std::cout);
+                return status;
+            }
+
             static void
             usage(const boost::program_options::options_description &options)
             {
@@ -63,6 +299,13 @@ namespace ndn
             main(int argc, char *argv[])
             {
                 Options options;
+                std::string traceFile;
+                std::string emulateSpec;
+                bool isSimulated = false;
+                time::milliseconds statsInterval = 1_s;
+                size_t nFlows = 1;
+                size_t nThreads = 1;
+                std::vector<std::string> flowSpecs;
                 // options.shouldAllowStaleData = false;
                 // options.nPings = -1;
                 // options.interval = time::milliseconds(getDefaultPingInterval());
@@ -97,6 +340,34 @@ namespace ndn
                     "delayGreedy", po::value<int32_t>(&options.delayGreedy)->default_value(-1), "delay greedy, in milliseconds");
                 visibleOptDesc.add_options()(
                     "greedyRate", po::value<int32_t>(&options.greedyRate)->default_value(-1), "greedy rate, in milliseconds");
+                visibleOptDesc.add_options()(
+                    "paceBurst", po::value<size_t>(&options.paceBurst)->default_value(1), "Interests released per pacer wakeup");
+                visibleOptDesc.add_options()(
+                    "busyPoll", po::bool_switch(&options.paceBusyPoll), "busy-poll before each burst for microsecond pacing accuracy");
+                visibleOptDesc.add_options()(
+                    "rateFilter", po::value<std::string>(&options.rateFilter)->default_value("ewma"),
+                    "filter smoothing the TargetRate samples: ewma[:WEIGHT], time-ewma:MS, max:MS, min:MS or kalman:MS[,NOISE]");
+                visibleOptDesc.add_options()(
+                    "trace", po::value<std::string>(&traceFile), "write delay, rate and window samples into a binary trace file instead of stdout (read it back with cc-trace)");
+                visibleOptDesc.add_options()(
+                    "emulate", po::value<std::string>(&emulateSpec),
+                    "run against an in-process producer over an emulated link, KEY=VALUE[,KEY=VALUE]... with KEY among "
+                    "bw (Mbit/s), delay (ms), queue (packets), loss (probability), aqm (none, codel or step), "
+                    "target (ms), interval (ms), mark (packets) and seed");
+                visibleOptDesc.add_options()(
+                    "simulate", po::bool_switch(&isSimulated),
+                    "with --emulate, run in deterministic simulated time, as fast as possible (end the run with --timingStop or --seqMax)");
+                visibleOptDesc.add_options()(
+                    "flows", po::value<size_t>(&nFlows)->default_value(1), "number of consumers, each requesting <prefix>/<index>");
+                visibleOptDesc.add_options()(
+                    "flow", po::value<std::vector<std::string>>(&flowSpecs)->composing(),
+                    "parameters of one consumer, INDEX:KEY=VALUE[,KEY=VALUE]... with KEY among prefix, tos, dsz, "
+                    "initialSendRate, fixedRate, delayStart, timingStop, delayGreedy, greedyRate, seqMax, rateFilter (repeatable)");
+                visibleOptDesc.add_options()(
+                    "threads", po::value<size_t>(&nThreads)->default_value(1), "number of worker threads, each with its own Face, sharing the consumers");
+                visibleOptDesc.add_options()(
+                    "stats-interval", po::value<time::milliseconds::rep>()->default_value(1000),
+                    "with several consumers, report per-flow statistics every interval, in milliseconds (0 == off)");
                 visibleOptDesc.add_options()(
                     "lifetime", po::value<time::milliseconds::rep>()->default_value(4000), "Interest lifetime, in milliseconds");
 
@@ -137,6 +408,7 @@ namespace ndn
                     }
 
                     options.lifetime = time::milliseconds(optVm["lifetime"].as<time::milliseconds::rep>());
+                    statsInterval = time::milliseconds(optVm["stats-interval"].as<time::milliseconds::rep>());
                 }
                 catch (const po::error &e)
                 {
@@ -144,8 +416,89 @@ namespace ndn
                     usage(visibleOptDesc);
                 }
 
-                std::cout << "PING " << options.prefix << std::endl;
-                return Runner(options).run();
+                if (isSimulated && emulateSpec.empty())
+                {
+                    std::cerr << "ERROR: --simulate requires --emulate" << std::endl;
+                    return 2;
+                }
+
+                if (isSimulated && options.paceBusyPoll)
+                {
+                    std::cerr << "ERROR: busy polling never lets simulated time advance" << std::endl;
+                    return 2;
+                }
+
+                if (!traceFile.empty())
+                {
+                    try
+                    {
+                        getTraceWriter().open(traceFile);
+                        getTraceWriter().flushInBackground();
+                    }
+                    catch (const std::runtime_error &e)
+                    {
+                        std::cerr << "ERROR: " << e.what() << std::endl;
+                        return 2;
+                    }
+                }
+
+                try
+                {
+                    RateFilter::create(options.rateFilter);
+                }
+                catch (const std::invalid_argument &e)
+                {
+                    std::cerr << "ERROR: " << e.what() << std::endl;
+                    return 2;
+                }
+
+                if (nFlows == 0 || nThreads == 0)
+                {
+                    std::cerr << "ERROR: at least one flow and one worker thread are required" << std::endl;
+                    return 2;
+                }
+
+                if (nFlows == 1 && nThreads == 1 && flowSpecs.empty())
+                {
+                    if (!emulateSpec.empty())
+                    {
+                        return runEmulation(emulateSpec, options, isSimulated);
+                    }
+                    std::cout << "PING " << options.prefix << std::endl;
+                    Face face;
+                    return Runner(face, options).run();
+                }
+                if (!emulateSpec.empty())
+                {
+                    std::cerr << "ERROR: --emulate runs a single consumer on a single thread" << std::endl;
+                    return 2;
+                }
+
+                std::vector<Options> flows(nFlows, options);
+                for (size_t i = 0; i < nFlows; ++i)
+                {
+                    flows[i].prefix = Name(options.prefix).appendNumber(i);
+                    flows[i].flowId = static_cast<uint32_t>(i);
+                    flows[i].printSamples = false;
+                }
+                try
+                {
+                    for (const auto &spec : flowSpecs)
+                    {
+                        applyFlowSpec(spec, flows);
+                    }
+                }
+                catch (const std::invalid_argument &e)
+                {
+                    std::cerr << "ERROR: " << e.what() << std::endl;
+                    return 2;
+                }
+
+                for (const auto &flow : flows)
+                {
+                    std::cout << "PING " << flow.prefix << " (flow " << flow.flowId << ", tos " << flow.tos << ")" << std::endl;
+                }
+                return MultiFlowRunner(flows, nThreads, statsInterval).run();
             }
         }
     }
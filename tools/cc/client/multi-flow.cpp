@@ -0,0 +1,139 @@
+#include "multi-flow.hpp"
+#include "rate-filter.hpp"
+
+#include <boost/algorithm/string/split.hpp>
+#include <boost/algorithm/string/classification.hpp>
+
+namespace ndn
+{
+    namespace cc
+    {
+        namespace client
+        {
+            double
+            computeJainIndex(const std::vector<double> &throughputs)
+            {
+                double sum = 0;
+                double sumOfSquares = 0;
+                for (double x : throughputs)
+                {
+                    sum += x;
+                    sumOfSquares += x * x;
+                }
+                if (sumOfSquares == 0)
+                {
+                    return 1.0;
+                }
+                return sum * sum / (throughputs.size() * sumOfSquares);
+            }
+
+            template <typename T>
+            static T
+            parseValue(const std::string &key, const std::string &value)
+            {
+                try
+                {
+                    return boost::lexical_cast<T>(value);
+                }
+                catch (const boost::bad_lexical_cast &)
+                {
+                    NDN_THROW(std::invalid_argument("Invalid value for flow option " + key + ": " + value));
+                }
+            }
+
+            void
+            applyFlowSpec(const std::string &spec, std::vector<Options> &flows)
+            {
+                auto colon = spec.find(':');
+                if (colon == std::string::npos)
+                {
+                    NDN_THROW(std::invalid_argument("Flow specification must read INDEX:KEY=VALUE,...: " + spec));
+                }
+                auto index = parseValue<size_t>("index", spec.substr(0, colon));
+                if (index >= flows.size())
+                {
+                    NDN_THROW(std::invalid_argument("No flow " + spec.substr(0, colon) + " (there are " +
+                                                    std::to_string(flows.size()) + " flows)"));
+                }
+                Options &options = flows[index];
+
+                std::vector<std::string> tokens;
+                boost::algorithm::split(tokens, spec.substr(colon + 1), boost::algorithm::is_any_of(","));
+                // a comma not followed by KEY= belongs to the previous value, as in kalman:200,0.05
+                std::vector<std::string> assignments;
+                for (const auto &token : tokens)
+                {
+                    if (!assignments.empty() && token.find('=') == std::string::npos)
+                    {
+                        assignments.back() += "," + token;
+                    }
+                    else
+                    {
+                        assignments.push_back(token);
+                    }
+                }
+
+                for (const auto &assignment : assignments)
+                {
+                    auto equal = assignment.find('=');
+                    if (equal == std::string::npos)
+                    {
+                        NDN_THROW(std::invalid_argument("Flow option must read KEY=VALUE: " + assignment));
+                    }
+                    auto key = assignment.substr(0, equal);
+                    auto value = assignment.substr(equal + 1);
+
+                    if (key == "prefix")
+                    {
+                        options.prefix = Name(value);
+                    }
+                    else if (key == "tos")
+                    {
+                        options.tos = parseValue<uint32_t>(key, value);
+                    }
+                    else if (key == "dsz")
+                    {
+                        options.dsz = parseValue<uint32_t>(key, value);
+                    }
+                    else if (key == "initialSendRate")
+                    {
+                        options.initialSendRate = parseValue<uint32_t>(key, value);
+                    }
+                    else if (key == "fixedRate")
+                    {
+                        options.fixedRate = parseValue<int32_t>(key, value);
+                    }
+                    else if (key == "delayStart")
+                    {
+                        options.delayStart = parseValue<uint32_t>(key, value);
+                    }
+                    else if (key == "timingStop")
+                    {
+                        options.timingStop = parseValue<int32_t>(key, value);
+                    }
+                    else if (key == "delayGreedy")
+                    {
+                        options.delayGreedy = parseValue<int32_t>(key, value);
+                    }
+                    else if (key == "greedyRate")
+                    {
+                        options.greedyRate = parseValue<int32_t>(key, value);
+                    }
+                    else if (key == "seqMax")
+                    {
+                        options.seqMax = parseValue<int64_t>(key, value);
+                    }
+                    else if (key == "rateFilter")
+                    {
+                        RateFilter::create(value);
+                        options.rateFilter = value;
+                    }
+                    else
+                    {
+                        NDN_THROW(std::invalid_argument("Unknown flow option " + key));
+                    }
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,35 @@
+#ifndef CC_CLIENT_MULTI_FLOW_H
+#define CC_CLIENT_MULTI_FLOW_H
+#include "ndn-consumer.hpp"
+
+namespace ndn
+{
+    namespace cc
+    {
+        namespace client
+        {
+            /**
+             * @brief Jain's fairness index of @p throughputs
+             *
+             * (sum x)^2 / (n * sum x^2): 1 when all values are equal, 1/n when a single one takes
+             * everything. An empty or all-zero input counts as fair.
+             */
+            double
+            computeJainIndex(const std::vector<double> &throughputs);
+
+            /**
+             * @brief Applies a flow specification to the options of one of @p flows
+             *
+             * The specification reads INDEX:KEY=VALUE[,KEY=VALUE]..., e.g. 2:tos=3,fixedRate=1000000,
+             * with KEY one of prefix, tos, dsz, initialSendRate, fixedRate, delayStart, timingStop,
+             * delayGreedy, greedyRate, seqMax, rateFilter.
+             *
+             * @throw std::invalid_argument malformed specification, unknown key or flow index
+             */
+            void
+            applyFlowSpec(const std::string &spec, std::vector<Options> &flows);
+        }
+    }
+}
+
+#endif // CC_CLIENT_MULTI_FLOW_H
@@ -0,0 +1,150 @@
+#include "pacer.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace ndn
+{
+    namespace cc
+    {
+        namespace client
+        {
+            const time::microseconds Pacer::SPIN_MARGIN(50);
+
+            Pacer::Pacer(boost::asio::io_service &io, const Options &options)
+                : m_io(io),
+                  m_options(options),
+                  m_scheduler(io),
+                  m_rate(0),
+                  m_credits(0),
+                  m_isRunning(false),
+                  m_isWakeupPending(false),
+                  m_generation(0),
+                  m_nSent(0),
+                  m_nWakeups(0)
+            {
+                m_options.burstSize = std::max<size_t>(m_options.burstSize, 1);
+            }
+
+            void Pacer::start(const SendCallback &send)
+            {
+                m_send = send;
+                m_isRunning = true;
+                m_credits = 1;
+                m_lastRefill = time::steady_clock::now();
+                release();
+                schedule();
+            }
+
+            void Pacer::stop()
+            {
+                m_isRunning = false;
+                ++m_generation;
+                m_isWakeupPending = false;
+                m_wakeupEvent.cancel();
+            }
+
+            void Pacer::setRate(double rate)
+            {
+                if (!m_isRunning)
+                {
+                    m_rate = rate;
+                    return;
+                }
+
+                // credits accrued so far count at the old rate
+                refill(time::steady_clock::now());
+                double oldRate = m_rate;
+                m_rate = rate;
+
+                // a wakeup computed for the old rate is at worst early (which only costs a spurious
+                // wakeup) or late by less than half its wait; re-arming the timer on every small rate
+                // update would cost as much as pacing every packet with its own timer
+                if (m_isWakeupPending && rate <= 2 * oldRate)
+                {
+                    return;
+                }
+                ++m_generation;
+                m_isWakeupPending = false;
+                m_wakeupEvent.cancel();
+                schedule();
+            }
+
+            void Pacer::refill(time::steady_clock::TimePoint now)
+            {
+                double elapsed = time::duration_cast<time::nanoseconds>(now - m_lastRefill).count() / 1e9;
+                m_lastRefill = now;
+                if (m_rate > 0 && elapsed > 0)
+                {
+                    m_credits = std::min(m_credits + elapsed * m_rate, 2.0 * m_options.burstSize);
+                }
+            }
+
+            void Pacer::release()
+            {
+                while (m_isRunning && m_credits >= 1)
+                {
+                    if (!m_send())
+                    {
+                        stop();
+                        return;
+                    }
+                    m_credits -= 1;
+                    ++m_nSent;
+                }
+            }
+
+            void Pacer::schedule()
+            {
+                if (!m_isRunning || m_isWakeupPending || m_rate <= 0)
+                {
+                    return;
+                }
+
+                // wake up once a whole burst has accrued
+                double missing = std::max(m_options.burstSize - m_credits, 0.0);
+                auto wait = time::nanoseconds(static_cast<int64_t>(std::ceil(missing / m_rate * 1e9)));
+
+                m_isWakeupPending = true;
+                uint64_t generation = m_generation;
+                if (m_options.busyPoll && wait <= SPIN_MARGIN)
+                {
+                    m_io.post([this, generation]
+                              {
+                                  if (generation == m_generation)
+                                  {
+                                      onWakeup();
+                                  } });
+                    return;
+                }
+
+                if (m_options.busyPoll)
+                {
+                    wait -= SPIN_MARGIN;
+                }
+                // the Scheduler follows the ndn-cxx clocks, simulated time included
+                m_wakeupEvent = m_scheduler.schedule(wait, [this, generation]
+                                                     {
+                                                         if (generation == m_generation)
+                                                         {
+                                                             onWakeup();
+                                                         } });
+            }
+
+            void Pacer::onWakeup()
+            {
+                m_isWakeupPending = false;
+                ++m_nWakeups;
+                refill(time::steady_clock::now());
+
+                // with busy polling, spin until the burst is complete; otherwise the timer
+                // granularity decides and whatever has accrued goes out
+                if (!m_options.busyPoll || m_credits >= m_options.burstSize)
+                {
+                    release();
+                }
+                schedule();
+            }
+        }
+    }
+}
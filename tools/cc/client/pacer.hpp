@@ -0,0 +1,124 @@
+#ifndef CC_CLIENT_PACER_H
+#define CC_CLIENT_PACER_H
+#include "core/common.hpp"
+
+#include <boost/asio/io_service.hpp>
+
+namespace ndn
+{
+    namespace cc
+    {
+        namespace client
+        {
+            /**
+             * @brief Releases packets at a configured rate, in micro-bursts
+             *
+             * Credits accrue at the packet rate. The pacer wakes up once enough credits for a burst have
+             * accrued and releases one packet per whole credit, so the timer overhead is paid once per
+             * burst instead of once per packet, and a late wakeup does not lower the achieved rate:
+             * credits are capped at twice the burst size only, and the next burst makes up for it.
+             *
+             * With busy polling the pacer stops sleeping shortly before the burst is due and re-posts
+             * itself on the io_service until it is, which gives microsecond accuracy at the cost of a
+             * busy core while still running the other handlers (received Data in particular).
+             */
+            class Pacer : noncopyable
+            {
+            public:
+                struct Options
+                {
+                    size_t burstSize = 1;  //!< packets released per wakeup
+                    bool busyPoll = false; //!< spin on the io_service instead of sleeping before a burst
+                };
+
+                /**
+                 * @brief Sends one packet
+                 * @return false if nothing was sent, which stops the pacer
+                 */
+                using SendCallback = std::function<bool()>;
+
+                Pacer(boost::asio::io_service &io, const Options &options);
+
+                /**
+                 * @brief Starts releasing packets to @p send
+                 *
+                 * The first packet is released right away, even at a zero rate.
+                 */
+                void
+                start(const SendCallback &send);
+
+                void
+                stop();
+
+                /**
+                 * @brief Sets the packet rate, in packets per second (0 == paused)
+                 */
+                void
+                setRate(double rate);
+
+                double
+                getRate() const
+                {
+                    return m_rate;
+                }
+
+                bool
+                isRunning() const
+                {
+                    return m_isRunning;
+                }
+
+                uint64_t
+                getNSent() const
+                {
+                    return m_nSent;
+                }
+
+                /**
+                 * @brief Returns the number of timer and busy-poll wakeups
+                 */
+                uint64_t
+                getNWakeups() const
+                {
+                    return m_nWakeups;
+                }
+
+            private:
+                void
+                refill(time::steady_clock::TimePoint now);
+
+                void
+                release();
+
+                void
+                schedule();
+
+                void
+                onWakeup();
+
+            public:
+                /// \brief how long before a burst is due busy polling takes over from the timer
+                static const time::microseconds SPIN_MARGIN;
+
+            private:
+                boost::asio::io_service &m_io;
+                Options m_options;
+                Scheduler m_scheduler;
+                scheduler::EventId m_wakeupEvent;
+                SendCallback m_send;
+
+                double m_rate;
+                double m_credits;
+                time::steady_clock::TimePoint m_lastRefill;
+                bool m_isRunning;
+                bool m_isWakeupPending;
+                uint64_t m_generation; ///< \brief invalidates the wakeups scheduled before a stop or a rate change
+
+                uint64_t m_nSent;
+                uint64_t m_nWakeups;
+            };
+        }
+    }
+}
+
+#endif // CC_CLIENT_PACER_H
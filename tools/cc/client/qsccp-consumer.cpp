@@ -7,9 +7,10 @@ namespace ndn
     {
         namespace client
         {
+            constexpr bool QsccpConsumer::USE_RTO_TIMERS;
+
             QsccpConsumer::QsccpConsumer(Face &face, const Options &options)
-                : Consumer(face, options),
-                  m_firstTime(true),
+                : Engine(face, options),
                   tos(options.tos),
                   delayStart(options.delayStart),
                   dsz(options.dsz),
@@ -18,9 +19,19 @@ namespace ndn
                   timingStop(options.timingStop),
                   delayGreedy(options.delayGreedy),
                   greedyRate(options.greedyRate),
-                  m_recvDataNum(0)
+                  m_recvDataNum(0),
+                  m_pacer(face.getIoService(), {options.paceBurst, options.paceBusyPoll}),
+                  m_rateFilter(RateFilter::create(options.rateFilter))
+            {
+                if (this->sendRate > 0)
+                {
+                    m_rateFilter->reset(this->sendRate, time::steady_clock::now());
+                }
+            }
 
+            void QsccpConsumer::applyRate()
             {
+                m_pacer.setRate(this->dsz > 0 ? static_cast<double>(this->sendRate) / this->dsz : 0.0);
             }
 
             uint64_t QsccpConsumer::updateRate(uint64_t newRate)
@@ -29,14 +40,8 @@ namespace ndn
                 {
                     return this->fixedRate;
                 }
-                if (this->sendRate == 0)
-                {
-                    this->sendRate = newRate;
-                }
-                else
-                {
-                    this->sendRate = 0.8 * this->sendRate + 0.2 * newRate;
-                }
+                this->sendRate = m_rateFilter->update(newRate, time::steady_clock::now());
+                applyRate();
                 return this->sendRate;
             }
 
@@ -44,16 +49,23 @@ namespace ndn
             {
                 this->fixedRate = this->greedyRate;
                 this->sendRate = this->greedyRate;
+                applyRate();
             }
 
-            void QsccpConsumer::onData(const Data &data, uint64_t seq, const time::steady_clock::TimePoint &sendTime)
+            void QsccpConsumer::onData(const Data &data, uint64_t seq, const SendInfo &info)
             {
                 // print tags
                 auto targetRate = data.getTargetRate();
                 // std::cout << "onData: " << seq << ", targetRate: " << *targetRate << std::endl;
                 if (targetRate)
                 {
-                    this->updateRate(*targetRate);
+                    auto rate = this->updateRate(*targetRate);
+                    TraceWriter &trace = getTraceWriter();
+                    if (trace.isEnabled())
+                    {
+                        trace.append(TraceRecord::TARGET_RATE, time::steady_clock::now(), seq, *targetRate, rate,
+                                     m_options.flowId);
+                    }
                 }
                 else
                 {
@@ -62,7 +74,7 @@ namespace ndn
 
                 scheduleNextPacket();
 
-                Consumer::onData(data, seq, sendTime);
+                Engine::onData(data, seq, info);
 
                 ++this->m_recvDataNum;
                 if (this->m_seqMax == this->m_recvDataNum)
@@ -80,7 +92,6 @@ namespace ndn
                 }
                 if (this->m_firstTime)
                 {
-                    m_startTime = time::steady_clock::now();
                     this->m_firstTime = false;
 
                     if (this->fixedRate > 0)
@@ -98,63 +109,25 @@ namespace ndn
                         m_scheduler.schedule(time::milliseconds(this->delayGreedy), [this]
                                              { startGreedy(); });
                     }
+                    applyRate();
                     m_nextInterestEvent = m_scheduler.schedule(time::milliseconds(this->delayStart), [this]
-                                                               { sendPacket(); });
-                }
-                else if (!m_nextInterestEvent)
-                {
-                    if (this->sendRate <= 0)
-                    {
-                        return;
-                    }
-                    auto waitTime = (this->dsz * 1000000000) / this->sendRate + 1;
-                    m_nextInterestEvent = m_scheduler.schedule(time::nanoseconds(waitTime), [this]
-                                                               { sendPacket(); });
+                                                               { m_pacer.start([this]
+                                                                               {
+                                                                                   if (m_stopFlag)
+                                                                                   {
+                                                                                       return false;
+                                                                                   }
+                                                                                   sendPacket();
+                                                                                   return !m_stopFlag;
+                                                                               }); });
                 }
+                // afterwards the pacer releases the Interests at the send rate
             }
 
-            void QsccpConsumer::sendPacket()
+            void QsccpConsumer::onSequenceExhausted()
             {
-                scheduleNextPacket();
-                // send packet here
-                uint32_t seq = std::numeric_limits<uint32_t>::max(); // invalid
-                while (m_retxSeqs.size())
-                {
-                    seq = *m_retxSeqs.begin();
-                    m_retxSeqs.erase(m_retxSeqs.begin());
-                    break;
-                }
-
-                if (seq == std::numeric_limits<uint32_t>::max())
-                {
-                    if (m_seqMax != std::numeric_limits<uint32_t>::max())
-                    {
-                        if (m_nextSeq >= m_seqMax)
-                        {
-                            stop();
-                            // finish();
-                            return; // we are totally done
-                        }
-                    }
-                    seq = m_nextSeq++;
-                }
-
-                Interest interest(makeInterestName(seq));
-                interest.setCanBePrefix(false);
-                interest.setMustBeFresh(true);
-                interest.setServiceClass(this->tos);
-                interest.setDsz(this->dsz);
-                interest.setInterestLifetime(m_options.lifetime);
-
-                auto now = time::steady_clock::now();
-                m_face.expressInterest(interest,
-                                       bind(&Consumer::onData, this, _2, seq, now),
-                                       bind(&Consumer::onNack, this, _2, seq, now),
-                                       bind(&Consumer::onTimeout, this, seq));
-
-                ++m_nSent;
-                ++m_nOutstanding;
+                stop();
             }
         }
     }
-}
\ No newline at end of file
+}
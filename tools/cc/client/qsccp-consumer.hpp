@@ -1,4 +1,8 @@
+#ifndef CC_CLIENT_QSCCP_CONSUMER_H
+#define CC_CLIENT_QSCCP_CONSUMER_H
 #include "ndn-consumer.hpp"
+#include "pacer.hpp"
+#include "rate-filter.hpp"
 
 namespace ndn
 {
@@ -6,25 +10,36 @@ namespace ndn
     {
         namespace client
         {
-            class QsccpConsumer : public Consumer
+            /**
+             * @brief Consumer paced at the TargetRate carried by the Data
+             *
+             * Interests are only retransmitted once their lifetime expires.
+             */
+            class QsccpConsumer : public ConsumerEngine<QsccpConsumer>
             {
             public:
+                static constexpr bool USE_RTO_TIMERS = false;
+
                 explicit QsccpConsumer(Face &face, const Options &options);
 
-                void sendPacket() override;
+                void onData(const Data &data, uint64_t seq, const SendInfo &info);
 
-                void onData(const Data& data, uint64_t seq, const time::steady_clock::TimePoint &sendTime) override;
+                void scheduleNextPacket();
 
-            protected:
-                void scheduleNextPacket() override;
+                void onSequenceExhausted();
 
+            protected:
                 void startGreedy();
 
             private:
                 uint64_t updateRate(uint64_t newRate);
 
+                /**
+                 * \brief Passes the send rate, in bytes per second, to the pacer as a packet rate
+                 */
+                void applyRate();
+
             private:
-                bool m_firstTime = true;
                 // private attribute here
                 uint64_t tos;
                 uint64_t delayStart;
@@ -35,7 +50,11 @@ namespace ndn
                 int32_t delayGreedy;
                 int32_t greedyRate;
                 uint64_t m_recvDataNum;
+                Pacer m_pacer;
+                unique_ptr<RateFilter> m_rateFilter;
             };
         }
     }
-}
\ No newline at end of file
+}
+
+#endif // CC_CLIENT_QSCCP_CONSUMER_H
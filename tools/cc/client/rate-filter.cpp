@@ -0,0 +1,223 @@
+#include "rate-filter.hpp"
+
+#include <cmath>
+
+namespace ndn
+{
+    namespace cc
+    {
+        namespace client
+        {
+            static double
+            toSeconds(time::nanoseconds d)
+            {
+                return d.count() / 1e9;
+            }
+
+            template <typename T>
+            static T
+            parseParameter(const std::string &spec, const std::string &value)
+            {
+                try
+                {
+                    return boost::lexical_cast<T>(value);
+                }
+                catch (const boost::bad_lexical_cast &)
+                {
+                    NDN_THROW(std::invalid_argument("Invalid rate filter parameter in " + spec));
+                }
+            }
+
+            static time::nanoseconds
+            parseDuration(const std::string &spec, const std::string &value)
+            {
+                auto ms = parseParameter<double>(spec, value);
+                if (!(ms > 0))
+                {
+                    NDN_THROW(std::invalid_argument("Rate filter duration must be positive in " + spec));
+                }
+                return time::nanoseconds(static_cast<time::nanoseconds::rep>(ms * 1e6));
+            }
+
+            unique_ptr<RateFilter>
+            RateFilter::create(const std::string &spec)
+            {
+                auto colon = spec.find(':');
+                std::string kind = spec.substr(0, colon);
+                std::string params = colon == std::string::npos ? "" : spec.substr(colon + 1);
+
+                if (kind == "ewma")
+                {
+                    double weight = params.empty() ? 0.2 : parseParameter<double>(spec, params);
+                    if (!(weight > 0 && weight <= 1))
+                    {
+                        NDN_THROW(std::invalid_argument("EWMA weight must be in (0, 1] in " + spec));
+                    }
+                    return make_unique<SampleEwmaFilter>(weight);
+                }
+                if (params.empty())
+                {
+                    NDN_THROW(std::invalid_argument("Rate filter " + kind + " needs a duration in milliseconds"));
+                }
+                if (kind == "time-ewma")
+                {
+                    return make_unique<TimeEwmaFilter>(parseDuration(spec, params));
+                }
+                if (kind == "max" || kind == "min")
+                {
+                    return make_unique<WindowedFilter>(parseDuration(spec, params), kind == "max");
+                }
+                if (kind == "kalman")
+                {
+                    auto comma = params.find(',');
+                    double noise = comma == std::string::npos ? 0.1 : parseParameter<double>(spec, params.substr(comma + 1));
+                    if (!(noise > 0))
+                    {
+                        NDN_THROW(std::invalid_argument("Kalman noise must be positive in " + spec));
+                    }
+                    return make_unique<KalmanFilter>(parseDuration(spec, params.substr(0, comma)), noise);
+                }
+                NDN_THROW(std::invalid_argument("Unknown rate filter " + spec));
+            }
+
+            SampleEwmaFilter::SampleEwmaFilter(double weight)
+                : m_weight(weight)
+            {
+            }
+
+            double SampleEwmaFilter::update(double sample, time::steady_clock::TimePoint)
+            {
+                if (m_rate == 0)
+                {
+                    m_rate = sample;
+                }
+                else
+                {
+                    m_rate = (1 - m_weight) * m_rate + m_weight * sample;
+                }
+                return m_rate;
+            }
+
+            void SampleEwmaFilter::reset(double rate, time::steady_clock::TimePoint)
+            {
+                m_rate = rate;
+            }
+
+            TimeEwmaFilter::TimeEwmaFilter(time::nanoseconds timeConstant)
+                : m_timeConstant(toSeconds(timeConstant))
+            {
+            }
+
+            double TimeEwmaFilter::update(double sample, time::steady_clock::TimePoint now)
+            {
+                if (!m_hasSample)
+                {
+                    reset(sample, now);
+                    return m_rate;
+                }
+                double dt = std::max(toSeconds(now - m_last), 0.0);
+                double weight = 1 - std::exp(-dt / m_timeConstant);
+                m_rate += weight * (sample - m_rate);
+                m_last = now;
+                return m_rate;
+            }
+
+            void TimeEwmaFilter::reset(double rate, time::steady_clock::TimePoint now)
+            {
+                m_rate = rate;
+                m_last = now;
+                m_hasSample = true;
+            }
+
+            WindowedFilter::WindowedFilter(time::nanoseconds window, bool isMax)
+                : m_window(window),
+                  m_isMax(isMax)
+            {
+            }
+
+            double WindowedFilter::update(double sample, time::steady_clock::TimePoint now)
+            {
+                Sample s{now, sample};
+                if (!m_hasSample || isBetter(sample, m_samples[0].value) || now - m_samples[2].time > m_window)
+                {
+                    // new best, or nothing left in the window
+                    reset(sample, now);
+                    return sample;
+                }
+
+                if (isBetter(sample, m_samples[1].value))
+                {
+                    m_samples[2] = m_samples[1] = s;
+                }
+                else if (isBetter(sample, m_samples[2].value))
+                {
+                    m_samples[2] = s;
+                }
+
+                // let the best samples expire, or promote fresher candidates for the next sub-windows
+                auto age = now - m_samples[0].time;
+                if (age > m_window)
+                {
+                    m_samples[0] = m_samples[1];
+                    m_samples[1] = m_samples[2];
+                    m_samples[2] = s;
+                    if (now - m_samples[0].time > m_window)
+                    {
+                        m_samples[0] = m_samples[1];
+                        m_samples[1] = m_samples[2];
+                        m_samples[2] = s;
+                    }
+                }
+                else if (m_samples[1].time == m_samples[0].time && age > m_window / 4)
+                {
+                    m_samples[2] = m_samples[1] = s;
+                }
+                else if (m_samples[2].time == m_samples[1].time && age > m_window / 2)
+                {
+                    m_samples[2] = s;
+                }
+                return m_samples[0].value;
+            }
+
+            void WindowedFilter::reset(double rate, time::steady_clock::TimePoint now)
+            {
+                m_samples[0] = m_samples[1] = m_samples[2] = Sample{now, rate};
+                m_hasSample = true;
+            }
+
+            KalmanFilter::KalmanFilter(time::nanoseconds timeConstant, double noise)
+                : m_timeConstant(toSeconds(timeConstant)),
+                  m_noise(noise)
+            {
+            }
+
+            double KalmanFilter::update(double sample, time::steady_clock::TimePoint now)
+            {
+                if (!m_hasSample)
+                {
+                    reset(sample, now);
+                    return m_rate;
+                }
+
+                // predict: the rate drifts by a random walk of one rate per time constant
+                double dt = std::max(toSeconds(now - m_last), 0.0);
+                m_variance += dt / m_timeConstant;
+                m_last = now;
+
+                // correct, with variances relative to the squared rate
+                double gain = m_variance / (m_variance + m_noise * m_noise);
+                m_rate += gain * (sample - m_rate);
+                m_variance *= 1 - gain;
+                return m_rate;
+            }
+
+            void KalmanFilter::reset(double rate, time::steady_clock::TimePoint now)
+            {
+                m_rate = rate;
+                m_variance = m_noise * m_noise;
+                m_last = now;
+                m_hasSample = true;
+            }
+        }
+    }
+}
@@ -0,0 +1,187 @@
+#ifndef CC_CLIENT_RATE_FILTER_H
+#define CC_CLIENT_RATE_FILTER_H
+#include "core/common.hpp"
+
+namespace ndn
+{
+    namespace cc
+    {
+        namespace client
+        {
+            /**
+             * @brief Smooths the TargetRate samples carried by Data into a send rate
+             *
+             * Specifications:
+             *  - "ewma" or "ewma:W": per-sample EWMA giving weight W (default 0.2) to each sample
+             *  - "time-ewma:MS": EWMA with a time constant of MS milliseconds
+             *  - "max:MS" / "min:MS": maximum / minimum of the samples of the last MS milliseconds
+             *  - "kalman:MS[,NOISE]": Kalman filter over a random walk that drifts by the whole rate
+             *    in MS milliseconds, with samples off by NOISE (default 0.1) of the rate
+             *
+             * Apart from "ewma", the filters weigh samples by the time between them rather than by
+             * their number, so they converge within a bounded time whatever the packet rate.
+             */
+            class RateFilter
+            {
+            public:
+                virtual ~RateFilter() = default;
+
+                /**
+                 * @throw std::invalid_argument malformed specification
+                 */
+                static unique_ptr<RateFilter>
+                create(const std::string &spec);
+
+                /**
+                 * @brief Adds a sample taken at @p now and returns the filtered rate
+                 */
+                virtual double
+                update(double sample, time::steady_clock::TimePoint now) = 0;
+
+                /**
+                 * @brief Restarts the filter from @p rate
+                 */
+                virtual void
+                reset(double rate, time::steady_clock::TimePoint now) = 0;
+
+                /**
+                 * @brief Returns the filtered rate (0 before the first sample)
+                 */
+                virtual double
+                get() const = 0;
+            };
+
+            /**
+             * @brief EWMA with a fixed weight per sample
+             */
+            class SampleEwmaFilter : public RateFilter
+            {
+            public:
+                explicit SampleEwmaFilter(double weight = 0.2);
+
+                double
+                update(double sample, time::steady_clock::TimePoint now) override;
+
+                void
+                reset(double rate, time::steady_clock::TimePoint now) override;
+
+                double
+                get() const override
+                {
+                    return m_rate;
+                }
+
+            private:
+                double m_weight;
+                double m_rate = 0;
+            };
+
+            /**
+             * @brief EWMA whose weight grows with the time since the previous sample
+             *
+             * A sample taken dt after the previous one gets weight 1 - exp(-dt / tau).
+             */
+            class TimeEwmaFilter : public RateFilter
+            {
+            public:
+                explicit TimeEwmaFilter(time::nanoseconds timeConstant);
+
+                double
+                update(double sample, time::steady_clock::TimePoint now) override;
+
+                void
+                reset(double rate, time::steady_clock::TimePoint now) override;
+
+                double
+                get() const override
+                {
+                    return m_rate;
+                }
+
+            private:
+                double m_timeConstant; ///< \brief in seconds
+                double m_rate = 0;
+                bool m_hasSample = false;
+                time::steady_clock::TimePoint m_last;
+            };
+
+            /**
+             * @brief Windowed maximum or minimum over a time window
+             *
+             * Keeps the best, second best and third best samples of sub-windows (Kathleen Nichols'
+             * algorithm, as used by BBR), which takes constant memory whatever the sample rate.
+             */
+            class WindowedFilter : public RateFilter
+            {
+            public:
+                WindowedFilter(time::nanoseconds window, bool isMax);
+
+                double
+                update(double sample, time::steady_clock::TimePoint now) override;
+
+                void
+                reset(double rate, time::steady_clock::TimePoint now) override;
+
+                double
+                get() const override
+                {
+                    return m_samples[0].value;
+                }
+
+            private:
+                bool
+                isBetter(double a, double b) const
+                {
+                    return m_isMax ? a >= b : a <= b;
+                }
+
+            private:
+                struct Sample
+                {
+                    time::steady_clock::TimePoint time;
+                    double value = 0;
+                };
+
+                time::nanoseconds m_window;
+                bool m_isMax;
+                bool m_hasSample = false;
+                Sample m_samples[3];
+            };
+
+            /**
+             * @brief Scalar Kalman filter over a random-walk rate
+             *
+             * The process noise grows with the time since the previous sample, so the gain rises
+             * after a quiet period and the estimate drifts by about its own magnitude per time
+             * constant; the measurement noise is a fixed fraction of the rate.
+             */
+            class KalmanFilter : public RateFilter
+            {
+            public:
+                KalmanFilter(time::nanoseconds timeConstant, double noise);
+
+                double
+                update(double sample, time::steady_clock::TimePoint now) override;
+
+                void
+                reset(double rate, time::steady_clock::TimePoint now) override;
+
+                double
+                get() const override
+                {
+                    return m_rate;
+                }
+
+            private:
+                double m_timeConstant; ///< \brief in seconds
+                double m_noise;
+                double m_rate = 0;
+                double m_variance = 0; ///< \brief of the estimate, relative to the squared rate
+                bool m_hasSample = false;
+                time::steady_clock::TimePoint m_last;
+            };
+        }
+    }
+}
+
+#endif // CC_CLIENT_RATE_FILTER_H
@@ -0,0 +1,445 @@
+#ifndef CC_COMMON_CONSUMER_ENGINE_H
+#define CC_COMMON_CONSUMER_ENGINE_H
+#include "core/common.hpp"
+#include "flow-counters.hpp"
+#include "interest-template.hpp"
+#include "rtt-mean-deviation.hpp"
+#include "sequence-table.hpp"
+#include "sequence-window.hpp"
+#include "timer-wheel.hpp"
+#include "trace-writer.hpp"
+
+#include <iostream>
+
+namespace ndn
+{
+    namespace cc
+    {
+        typedef time::duration<double, time::milliseconds::period> Rtt;
+
+        /**
+         * @brief Options common to all consumers
+         */
+        class ConsumerOptions
+        {
+        public:
+            Name prefix;
+            uint64_t startSeq;           // Initial sequence number
+            time::milliseconds lifetime; // Lifetime of Interest
+            int64_t seqMax;              // Max sequence number
+            uint32_t tos;                // Type of Service
+            uint32_t dsz;                // Data size
+            int32_t reqNum;              // Request Data Num(-1 indicator infinity)
+            uint32_t initialSendRate;    // Initial Send Rate
+            int32_t fixedRate;           // Fixed Send Rate
+            int32_t timingStop;          // Timing Stop(-1 indicator infinity)
+            int32_t delayGreedy;         // Start greedy after the specified time (ms)
+            int32_t greedyRate;          // Greedy Send Rate(-1 indicator no greedy)
+            uint32_t delayStart;         // Delay Start(ms)
+            uint32_t flowId = 0;         // Index of the consumer within the process
+            bool printSamples = true;    // Print delay and rate samples on stdout
+        };
+
+        /**
+         * @brief State a consumer keeps for an Interest until its Data, Nack or timeout
+         */
+        struct SendInfo
+        {
+            time::steady_clock::TimePoint sendTime;
+            bool isRetx;
+        };
+
+        /**
+         * @brief Consumer engine shared by the congestion-controlled clients
+         *
+         * The engine owns what does not depend on congestion control: sequence numbers and the
+         * retransmission queue, Interest encoding from an InterestTemplate, RTO-based
+         * retransmission timers, receive counters, and delay and rate tracing.
+         *
+         * The congestion controller is @p Derived, which plugs in at compile time (CRTP). The engine
+         * calls the following members on Derived, which default to the engine's own unless Derived
+         * declares them; a Derived version of onData, onNack, onTimeout or willSendInterest must
+         * call the engine's. All calls on the per-packet path are thus resolved statically.
+         *  - scheduleNextPacket(), required: arranges for sendPacket() to be called
+         *  - makeInterestPrototype(options), static: Interest every transmission is encoded from
+         *  - makePacketInfo(now, isRetx): builds the @p PacketInfo handed back with the Data
+         *  - onData(data, seq, info), onNack(nack, seq, info), onTimeout(seq)
+         *  - willSendInterest(seq): the Interest @p seq has just been expressed
+         *  - onDelivered(size, now): Data of a sequence number arrived for the first time
+         *  - onSequenceExhausted(): sendPacket() found no sequence number left to request
+         *  - USE_RTO_TIMERS: retransmit after the estimated RTO (true) or only after the Interest
+         *    lifetime expires (false); with RTO timers, onTimeout() is called once per expired
+         *    timer, and the expiry of the Interest lifetime at the Face is ignored
+         *
+         * @tparam PacketInfo SendInfo, or a struct derived from it
+         */
+        template <typename Derived, typename PacketInfo = SendInfo>
+        class ConsumerEngine : noncopyable
+        {
+        public:
+            using Engine = ConsumerEngine;
+
+            static constexpr bool USE_RTO_TIMERS = true;
+
+            ConsumerEngine(Face &face, const ConsumerOptions &options)
+                : m_options(options),
+                  m_nSent(0),
+                  m_nextSeq(options.startSeq),
+                  m_seqMax(options.seqMax < 0 ? std::numeric_limits<uint64_t>::max()
+                                              : static_cast<uint64_t>(options.seqMax)),
+                  m_face(face),
+                  m_scheduler(m_face.getIoService()),
+                  m_stopFlag(false),
+                  m_recvBytes(0),
+                  m_traceTimes(0),
+                  m_firstTime(true),
+                  m_interestTemplate(Derived::makeInterestPrototype(options)),
+                  // the wheel starts one tick back, as timers at its current tick are due at once
+                  m_retxTimers(1_ms, time::steady_clock::now() - 1_ms)
+            {
+                m_scheduler.schedule(time::milliseconds(500), [this]
+                                     { traceRate(); });
+                if (Derived::USE_RTO_TIMERS)
+                {
+                    m_retxEvent = m_scheduler.schedule(time::milliseconds(50), [this]
+                                                       { checkRetxTimeout(); });
+                }
+            }
+
+            signal::Signal<ConsumerEngine, uint64_t, Rtt> afterData;
+
+            signal::Signal<ConsumerEngine, uint64_t, Rtt, lp::NackHeader> afterNack;
+
+            signal::Signal<ConsumerEngine, uint64_t> afterTimeout;
+
+            signal::Signal<ConsumerEngine> afterFinish;
+
+            void
+            start()
+            {
+                m_stopFlag = false;
+                m_startTime = time::steady_clock::now();
+                derived().scheduleNextPacket();
+            }
+
+            /**
+             * @brief Stops sending Interests, signalling afterFinish on the first call
+             */
+            void
+            stop()
+            {
+                m_nextInterestEvent.cancel();
+                m_retxEvent.cancel();
+                if (m_stopFlag)
+                {
+                    return;
+                }
+                m_stopFlag = true;
+                afterFinish();
+            }
+
+            /**
+             * @brief Returns the receive counters
+             *
+             * @note The counters may be read from any thread
+             */
+            const FlowCounters &
+            getCounters() const
+            {
+                return m_counters;
+            }
+
+            /**
+             * @brief Expresses the next Interest, retransmissions first
+             */
+            void
+            sendPacket()
+            {
+                uint64_t seq = 0;
+                bool isRetx = !m_retxSeqs.empty();
+                if (isRetx)
+                {
+                    seq = m_retxSeqs.popMin();
+                }
+                else
+                {
+                    if (m_nextSeq >= m_seqMax)
+                    {
+                        derived().onSequenceExhausted();
+                        return; // we are totally done
+                    }
+                    seq = m_nextSeq++;
+                }
+
+                Interest interest = m_interestTemplate.makeInterest(seq);
+
+                PacketInfo info = derived().makePacketInfo(time::steady_clock::now(), isRetx);
+                m_face.expressInterest(interest,
+                                       [this, seq, info](const Interest &, const Data &data)
+                                       { derived().onData(data, seq, info); },
+                                       [this, seq, info](const Interest &, const lp::Nack &nack)
+                                       { derived().onNack(nack, seq, info); },
+                                       [this, seq](const Interest &)
+                                       {
+                                           // the retransmission timer of the sequence number reports
+                                           // the loss, once, if it has not already
+                                           if (!Derived::USE_RTO_TIMERS)
+                                           {
+                                               derived().onTimeout(seq);
+                                           }
+                                       });
+
+                derived().willSendInterest(seq);
+
+                derived().scheduleNextPacket();
+            }
+
+            void
+            onData(const Data &data, uint64_t seq, const PacketInfo &info)
+            {
+                auto now = time::steady_clock::now();
+                m_dataTime = now;
+                auto delay = now - info.sendTime;
+                TraceWriter &trace = getTraceWriter();
+                if (trace.isEnabled())
+                {
+                    trace.append(TraceRecord::DELAY, now, (now - m_startTime).count(), seq, delay.count(),
+                                 m_options.flowId);
+                }
+                else if (m_options.printSamples)
+                {
+                    std::cout << "cc:delay:<" << (now - m_startTime).count() << "," << seq << "," << delay.count() << ">" << std::endl;
+                }
+
+                afterData(seq, delay);
+
+                bool isFirst = true;
+                if (Derived::USE_RTO_TIMERS)
+                {
+                    // a late Data of a retransmitted Interest is not counted twice
+                    RetxState *state = m_retxStates.find(seq);
+                    isFirst = state != nullptr;
+                    if (state != nullptr)
+                    {
+                        if (state->timer != RetxTimers::INVALID_HANDLE)
+                        {
+                            m_retxTimers.cancel(state->timer);
+                        }
+                        m_retxStates.erase(seq);
+                    }
+                    m_rtt.AckSeq(seq);
+                }
+                m_retxSeqs.erase(seq);
+
+                if (isFirst)
+                {
+                    auto size = data.wireEncode().size();
+                    m_recvBytes += size;
+                    m_counters.onData(size, delay);
+                    derived().onDelivered(size, now);
+                }
+            }
+
+            void
+            onNack(const lp::Nack &nack, uint64_t seq, const PacketInfo &info)
+            {
+                if (m_options.printSamples)
+                {
+                    std::cout << "onNack: " << nack.getReason() << std::endl;
+                }
+                afterNack(seq, time::steady_clock::now() - info.sendTime, nack.getHeader());
+                derived().scheduleNextPacket();
+            }
+
+            void
+            onTimeout(uint64_t seq)
+            {
+                if (m_options.printSamples)
+                {
+                    std::cout << "onTimeout: " << seq << std::endl;
+                }
+                afterTimeout(seq);
+
+                if (Derived::USE_RTO_TIMERS)
+                {
+                    m_rtt.IncreaseMultiplier(); // Double the next RTO
+                    m_rtt.SentSeq(seq, 1);      // make sure to disable RTT calculation for this sample
+                }
+                m_retxSeqs.insert(seq);
+
+                derived().scheduleNextPacket();
+            }
+
+            void
+            willSendInterest(uint64_t seq)
+            {
+                ++m_nSent;
+                if (Derived::USE_RTO_TIMERS)
+                {
+                    RetxState &state = m_retxStates.insert(seq);
+                    if (state.timer == RetxTimers::INVALID_HANDLE)
+                    {
+                        // a retransmission before the timeout keeps the timer of the first transmission
+                        state.timer = m_retxTimers.insert(time::steady_clock::now(), seq);
+                    }
+                    ++state.nTransmissions;
+                    m_rtt.SentSeq(seq, 1);
+                }
+            }
+
+            static Interest
+            makeInterestPrototype(const ConsumerOptions &options)
+            {
+                Interest interest(options.prefix);
+                interest.setCanBePrefix(false);
+                interest.setMustBeFresh(true);
+                interest.setServiceClass(options.tos);
+                interest.setDsz(options.dsz);
+                interest.setInterestLifetime(options.lifetime);
+                return interest;
+            }
+
+            PacketInfo
+            makePacketInfo(time::steady_clock::TimePoint now, bool isRetx) const
+            {
+                PacketInfo info{};
+                info.sendTime = now;
+                info.isRetx = isRetx;
+                return info;
+            }
+
+            void
+            onDelivered(size_t, time::steady_clock::TimePoint)
+            {
+            }
+
+            void
+            onSequenceExhausted()
+            {
+            }
+
+        protected:
+            Derived &
+            derived()
+            {
+                return static_cast<Derived &>(*this);
+            }
+
+        private:
+            void
+            traceRate()
+            {
+                if (!m_stopFlag)
+                {
+                    m_scheduler.schedule(time::milliseconds(500), [this]
+                                         { traceRate(); });
+                }
+
+                m_traceTimes++;
+                TraceWriter &trace = getTraceWriter();
+                if (trace.isEnabled())
+                {
+                    trace.append(TraceRecord::RATE, time::steady_clock::now(), m_traceTimes, m_recvBytes, m_nSent,
+                                 m_options.flowId);
+                }
+                else if (m_options.printSamples)
+                {
+                    std::cout << "cc:rate:<" << m_traceTimes << "," << m_recvBytes << ">" << m_nSent << std::endl;
+                }
+                m_recvBytes = 0;
+                m_nSent = 0;
+            }
+
+            /**
+             * @brief Retransmits the Interests whose retransmission timer expired
+             */
+            void
+            checkRetxTimeout()
+            {
+                auto now = time::steady_clock::now();
+
+                auto rto = m_rtt.RetransmitTimeout();
+
+                if (m_options.printSamples)
+                {
+                    std::cout << "RTO: " << m_rtt.duration_to_second_double(rto) << std::endl;
+                }
+
+                // an Interest sent at least one RTO ago has timed out
+                m_retxTimers.advance(now - rto, [this](uint64_t seqNo)
+                                     {
+                                         RetxState *state = m_retxStates.find(seqNo);
+                                         if (state != nullptr)
+                                         {
+                                             state->timer = RetxTimers::INVALID_HANDLE;
+                                             derived().onTimeout(seqNo);
+                                         } });
+
+                // wake up when the next Interest times out under the current RTO, and at least
+                // every MAX_RETX_CHECK_INTERVAL so that a shrinking RTO is noticed
+                time::steady_clock::duration delay = time::milliseconds(MAX_RETX_CHECK_INTERVAL_MS);
+                if (!m_retxTimers.empty())
+                {
+                    delay = std::min(delay, m_retxTimers.getNextExpiry() + rto - now);
+                    delay = std::max<time::steady_clock::duration>(delay, 1_ms);
+                }
+                m_retxEvent = m_scheduler.schedule(delay, [this]
+                                                   { checkRetxTimeout(); });
+            }
+
+        private:
+            static constexpr int MAX_RETX_CHECK_INTERVAL_MS = 50;
+
+        protected:
+            const ConsumerOptions &m_options;
+            uint64_t m_nSent;
+            uint64_t m_nextSeq;
+            uint64_t m_seqMax; ///< \brief first sequence number not requested
+            Face &m_face;
+            Scheduler m_scheduler;
+            bool m_stopFlag;
+
+            uint64_t m_recvBytes;
+            uint64_t m_traceTimes;
+            time::steady_clock::TimePoint m_startTime;
+            time::steady_clock::TimePoint m_dataTime; ///< \brief arrival time of the Data being processed by onData
+            scheduler::EventId m_nextInterestEvent;
+            bool m_firstTime;
+            InterestTemplate m_interestTemplate;
+            FlowCounters m_counters;
+
+            SequenceWindow m_retxSeqs; ///< \brief sequence numbers to be retransmitted, popped smallest first
+
+            RttMeanDeviation m_rtt;
+            scheduler::EventId m_retxEvent;
+
+            using RetxTimers = TimerWheel<uint64_t>;
+
+            /**
+             * @brief Retransmission state of an Interest in flight
+             */
+            struct RetxState
+            {
+                RetxTimers::Handle timer = RetxTimers::INVALID_HANDLE; ///< \brief pending retransmission timer
+                uint32_t nTransmissions = 0;
+            };
+
+            /**
+             * \brief Retransmission timers of the Interests in flight, keyed by send time
+             *
+             * The RTO is applied when the wheel is advanced, so a change of the RTO applies to
+             * every Interest in flight, not only to those sent afterwards.
+             */
+            RetxTimers m_retxTimers;
+            SequenceTable<RetxState> m_retxStates; ///< \brief Interests in flight, until their Data
+        };
+
+        template <typename Derived, typename PacketInfo>
+        constexpr bool ConsumerEngine<Derived, PacketInfo>::USE_RTO_TIMERS;
+
+        template <typename Derived, typename PacketInfo>
+        constexpr int ConsumerEngine<Derived, PacketInfo>::MAX_RETX_CHECK_INTERVAL_MS;
+    }
+}
+
+#endif // CC_COMMON_CONSUMER_ENGINE_H
@@ -0,0 +1,75 @@
+#include "delivery-rate-sampler.hpp"
+
+#include <algorithm>
+
+namespace ndn
+{
+    namespace cc
+    {
+        DeliveryRateSampler::DeliveryRateSampler(time::steady_clock::TimePoint now)
+            : m_delivered(0),
+              m_deliveredTime(now),
+              m_firstSentTime(now),
+              m_appLimitedUntil(0),
+              m_lastPriorDelivered(0)
+        {
+        }
+
+        DeliverySnapshot DeliveryRateSampler::onSend(time::steady_clock::TimePoint now, uint64_t inFlight, size_t size)
+        {
+            if (inFlight == 0)
+            {
+                // the first Interest after an idle period restarts both intervals
+                m_firstSentTime = now;
+                m_deliveredTime = now;
+            }
+
+            DeliverySnapshot snapshot;
+            snapshot.delivered = m_delivered;
+            snapshot.deliveredTime = m_deliveredTime;
+            snapshot.firstSentTime = m_firstSentTime;
+            snapshot.sentTime = now;
+            snapshot.inFlight = inFlight + size;
+            snapshot.isAppLimited = m_appLimitedUntil > 0;
+            return snapshot;
+        }
+
+        RateSample DeliveryRateSampler::onDelivered(const DeliverySnapshot &snapshot, size_t size,
+                                                    time::steady_clock::TimePoint now)
+        {
+            m_delivered += size;
+            m_deliveredTime = now;
+            if (m_appLimitedUntil > 0 && m_delivered > m_appLimitedUntil)
+            {
+                m_appLimitedUntil = 0;
+            }
+
+            RateSample sample;
+            sample.priorDelivered = snapshot.delivered;
+            sample.delivered = m_delivered - snapshot.delivered;
+            sample.txInFlight = snapshot.inFlight;
+            sample.isAppLimited = snapshot.isAppLimited;
+
+            auto sendElapsed = snapshot.sentTime - snapshot.firstSentTime;
+            auto ackElapsed = now - snapshot.deliveredTime;
+            sample.interval = time::duration_cast<time::nanoseconds>(std::max(sendElapsed, ackElapsed));
+            if (sample.interval > time::nanoseconds::zero())
+            {
+                sample.deliveryRate = sample.delivered * 1e9 / sample.interval.count();
+            }
+
+            if (snapshot.delivered >= m_lastPriorDelivered)
+            {
+                // the send interval of the next sample starts at the most recent Interest delivered
+                m_lastPriorDelivered = snapshot.delivered;
+                m_firstSentTime = snapshot.sentTime;
+            }
+            return sample;
+        }
+
+        void DeliveryRateSampler::onAppLimited(uint64_t inFlight)
+        {
+            m_appLimitedUntil = std::max<uint64_t>(m_delivered + inFlight, 1);
+        }
+    }
+}
@@ -0,0 +1,94 @@
+#ifndef CC_COMMON_DELIVERY_RATE_SAMPLER_H
+#define CC_COMMON_DELIVERY_RATE_SAMPLER_H
+#include "core/common.hpp"
+
+namespace ndn
+{
+    namespace cc
+    {
+        /**
+         * @brief Delivery state of the consumer when an Interest was sent, kept until its Data
+         */
+        struct DeliverySnapshot
+        {
+            uint64_t delivered = 0;                      ///< \brief bytes delivered so far
+            time::steady_clock::TimePoint deliveredTime; ///< \brief arrival of the last delivered Data
+            time::steady_clock::TimePoint firstSentTime; ///< \brief send time of the Interest of that Data
+            time::steady_clock::TimePoint sentTime;      ///< \brief send time of this Interest
+            uint64_t inFlight = 0;                       ///< \brief bytes in flight, this Interest included
+            bool isAppLimited = false;
+        };
+
+        /**
+         * @brief Delivery rate measured over the round trip of one Interest
+         */
+        struct RateSample
+        {
+            double deliveryRate = 0;     ///< \brief bytes per second, 0 without a valid interval
+            uint64_t delivered = 0;      ///< \brief bytes delivered over the interval
+            uint64_t priorDelivered = 0; ///< \brief bytes delivered when the Interest was sent
+            time::nanoseconds interval = time::nanoseconds::zero();
+            uint64_t txInFlight = 0; ///< \brief bytes in flight when the Interest was sent
+            bool isAppLimited = false;
+        };
+
+        /**
+         * @brief Delivery rate estimation of draft-cheng-iccrg-delivery-rate-estimation
+         *
+         * Each Interest carries a snapshot of the delivery counters taken by onSend(). When its
+         * Data arrives, the rate is the data delivered since the snapshot over the longer of the
+         * send and arrival intervals, which filters out both bursty sending and ACK compression.
+         *
+         * A sample taken while the consumer had nothing more to request is flagged app-limited;
+         * such a sample is below the path capacity and must only raise a bandwidth estimate.
+         */
+        class DeliveryRateSampler
+        {
+        public:
+            explicit DeliveryRateSampler(time::steady_clock::TimePoint now);
+
+            /**
+             * @brief Takes the snapshot of an Interest sent at @p now
+             * @param inFlight bytes in flight before this Interest
+             * @param size bytes expected for its Data
+             */
+            DeliverySnapshot
+            onSend(time::steady_clock::TimePoint now, uint64_t inFlight, size_t size);
+
+            /**
+             * @brief Accounts for @p size bytes of Data arriving at @p now, and returns the sample of
+             *        the Interest sent with @p snapshot
+             */
+            RateSample
+            onDelivered(const DeliverySnapshot &snapshot, size_t size, time::steady_clock::TimePoint now);
+
+            /**
+             * @brief Flags the samples as app-limited until the @p inFlight bytes now in flight are
+             *        delivered
+             */
+            void
+            onAppLimited(uint64_t inFlight);
+
+            uint64_t
+            getDelivered() const
+            {
+                return m_delivered;
+            }
+
+            bool
+            isAppLimited() const
+            {
+                return m_appLimitedUntil > 0;
+            }
+
+        private:
+            uint64_t m_delivered;
+            time::steady_clock::TimePoint m_deliveredTime;
+            time::steady_clock::TimePoint m_firstSentTime;
+            uint64_t m_appLimitedUntil; ///< \brief delivered bytes ending the app-limited phase, 0 outside of it
+            uint64_t m_lastPriorDelivered; ///< \brief of the most recently sent Interest delivered so far
+        };
+    }
+}
+
+#endif // CC_COMMON_DELIVERY_RATE_SAMPLER_H
@@ -0,0 +1,433 @@
+#include "emulated-link.hpp"
+
+#include <ndn-cxx/lp/packet.hpp>
+#include <ndn-cxx/mgmt/nfd/control-parameters.hpp>
+#include <ndn-cxx/mgmt/nfd/control-response.hpp>
+#include <ndn-cxx/security/signing-helpers.hpp>
+
+#include <boost/algorithm/string/classification.hpp>
+#include <boost/algorithm/string/split.hpp>
+#include <algorithm>
+#include <cmath>
+
+namespace ndn
+{
+    namespace cc
+    {
+        template <typename T>
+        static T
+        parseValue(const std::string &key, const std::string &value)
+        {
+            try
+            {
+                return boost::lexical_cast<T>(value);
+            }
+            catch (const boost::bad_lexical_cast &)
+            {
+                NDN_THROW(std::invalid_argument("Invalid value for link option " + key + ": " + value));
+            }
+        }
+
+        static time::nanoseconds
+        parseMilliseconds(const std::string &key, const std::string &value)
+        {
+            auto ms = parseValue<double>(key, value);
+            if (ms < 0)
+            {
+                NDN_THROW(std::invalid_argument("Link option " + key + " must not be negative: " + value));
+            }
+            return time::nanoseconds(static_cast<int64_t>(ms * 1000000));
+        }
+
+        EmulatedLink::Options
+        EmulatedLink::parseOptions(const std::string &spec)
+        {
+            Options options;
+            std::vector<std::string> assignments;
+            boost::algorithm::split(assignments, spec, boost::algorithm::is_any_of(","));
+            for (const auto &assignment : assignments)
+            {
+                if (assignment.empty())
+                {
+                    continue;
+                }
+                auto equal = assignment.find('=');
+                if (equal == std::string::npos)
+                {
+                    NDN_THROW(std::invalid_argument("Link option must read KEY=VALUE: " + assignment));
+                }
+                auto key = assignment.substr(0, equal);
+                auto value = assignment.substr(equal + 1);
+
+                if (key == "bw")
+                {
+                    options.bandwidth = parseValue<double>(key, value) * 1000000;
+                    if (options.bandwidth < 0)
+                    {
+                        NDN_THROW(std::invalid_argument("Link bandwidth must not be negative: " + value));
+                    }
+                }
+                else if (key == "delay")
+                {
+                    options.delay = parseMilliseconds(key, value);
+                }
+                else if (key == "queue")
+                {
+                    options.queueSize = parseValue<size_t>(key, value);
+                    if (options.queueSize == 0)
+                    {
+                        NDN_THROW(std::invalid_argument("Link queue must hold at least one packet"));
+                    }
+                }
+                else if (key == "loss")
+                {
+                    options.lossRate = parseValue<double>(key, value);
+                    if (options.lossRate < 0 || options.lossRate > 1)
+                    {
+                        NDN_THROW(std::invalid_argument("Link loss must be within [0, 1]: " + value));
+                    }
+                }
+                else if (key == "aqm")
+                {
+                    if (value == "none")
+                    {
+                        options.aqm = NO_AQM;
+                    }
+                    else if (value == "codel")
+                    {
+                        options.aqm = CODEL;
+                    }
+                    else if (value == "step")
+                    {
+                        options.aqm = STEP;
+                    }
+                    else
+                    {
+                        NDN_THROW(std::invalid_argument("Unknown link AQM: " + value));
+                    }
+                }
+                else if (key == "target")
+                {
+                    options.codelTarget = parseMilliseconds(key, value);
+                }
+                else if (key == "interval")
+                {
+                    options.codelInterval = parseMilliseconds(key, value);
+                    if (options.codelInterval <= 0_ns)
+                    {
+                        NDN_THROW(std::invalid_argument("CoDel interval must be positive: " + value));
+                    }
+                }
+                else if (key == "mark")
+                {
+                    options.markThreshold = parseValue<size_t>(key, value);
+                }
+                else if (key == "seed")
+                {
+                    options.seed = parseValue<uint32_t>(key, value);
+                }
+                else
+                {
+                    NDN_THROW(std::invalid_argument("Unknown link option " + key));
+                }
+            }
+            return options;
+        }
+
+        EmulatedLink::EmulatedLink(boost::asio::io_service &io, const Options &options)
+            : m_options(options),
+              m_scheduler(io),
+              m_rng(options.seed),
+              m_lossDistribution(0.0, 1.0)
+        {
+            for (size_t end = 0; end < m_ends.size(); ++end)
+            {
+                m_ends[end] = make_shared<EmulatedTransport>(*this, end);
+            }
+        }
+
+        EmulatedLink::~EmulatedLink()
+        {
+            // the Faces may keep their transport a little longer
+            for (const auto &transport : m_ends)
+            {
+                transport->detach();
+            }
+        }
+
+        shared_ptr<Transport>
+        EmulatedLink::getTransport(size_t end) const
+        {
+            return m_ends.at(end);
+        }
+
+        void EmulatedLink::transmit(size_t end, const Block &wire)
+        {
+            Direction &direction = m_directions[end];
+            ++direction.stats.nSent;
+
+            if (m_options.lossRate > 0 && m_lossDistribution(m_rng) < m_options.lossRate)
+            {
+                ++direction.stats.nLost;
+                return;
+            }
+            if (direction.queue.size() >= m_options.queueSize)
+            {
+                ++direction.stats.nDropped;
+                return;
+            }
+
+            direction.queue.push_back({wire, time::steady_clock::now()});
+            direction.stats.maxQueueLength = std::max(direction.stats.maxQueueLength, direction.queue.size());
+            if (!direction.isBusy)
+            {
+                startTransmission(end);
+            }
+        }
+
+        void EmulatedLink::startTransmission(size_t end)
+        {
+            Direction &direction = m_directions[end];
+            if (direction.queue.empty())
+            {
+                direction.isBusy = false;
+                return;
+            }
+            direction.isBusy = true;
+
+            auto now = time::steady_clock::now();
+            Block wire = std::move(direction.queue.front().wire);
+            auto sojourn = now - direction.queue.front().enqueueTime;
+            direction.queue.pop_front();
+
+            if (shouldMark(direction, sojourn, now))
+            {
+                ++direction.stats.nMarked;
+                lp::Packet packet(wire);
+                packet.set<lp::CongestionMarkField>(1);
+                wire = packet.wireEncode();
+            }
+
+            time::nanoseconds transmissionTime = 0_ns;
+            if (m_options.bandwidth > 0)
+            {
+                transmissionTime = time::nanoseconds(static_cast<int64_t>(wire.size() * 8 * 1e9 / m_options.bandwidth));
+            }
+            m_scheduler.schedule(transmissionTime + m_options.delay, [this, end, wire]
+                                 { deliver(end, wire); });
+            m_scheduler.schedule(transmissionTime, [this, end]
+                                 { startTransmission(end); });
+        }
+
+        bool
+        EmulatedLink::shouldMark(Direction &direction, time::nanoseconds sojourn, time::steady_clock::TimePoint now)
+        {
+            switch (m_options.aqm)
+            {
+            case NO_AQM:
+                return false;
+            case CODEL:
+                return shouldMarkCodel(direction, sojourn, now);
+            case STEP:
+                // the packet being dequeued counts towards the queue length
+                return direction.queue.size() + 1 > m_options.markThreshold;
+            }
+            return false;
+        }
+
+        bool
+        EmulatedLink::shouldMarkCodel(Direction &direction, time::nanoseconds sojourn, time::steady_clock::TimePoint now)
+        {
+            static const time::steady_clock::TimePoint NONE;
+
+            // RFC 8289 dequeue logic, marking the packet where CoDel would drop it
+            bool isOkToMark = false;
+            if (sojourn < m_options.codelTarget || direction.queue.empty())
+            {
+                direction.firstAboveTime = NONE;
+            }
+            else if (direction.firstAboveTime == NONE)
+            {
+                direction.firstAboveTime = now + m_options.codelInterval;
+            }
+            else if (now >= direction.firstAboveTime)
+            {
+                isOkToMark = true;
+            }
+
+            auto controlLaw = [this](time::steady_clock::TimePoint t, uint32_t count)
+            {
+                return t + time::nanoseconds(static_cast<int64_t>(m_options.codelInterval.count() / std::sqrt(count)));
+            };
+
+            if (direction.isMarking)
+            {
+                if (!isOkToMark)
+                {
+                    direction.isMarking = false;
+                    return false;
+                }
+                if (now >= direction.markNext)
+                {
+                    ++direction.markCount;
+                    direction.markNext = controlLaw(direction.markNext, direction.markCount);
+                    return true;
+                }
+                return false;
+            }
+
+            if (!isOkToMark)
+            {
+                return false;
+            }
+            direction.isMarking = true;
+            // resume near the former rate if the last marking state ended recently
+            uint32_t delta = direction.markCount - direction.lastMarkCount;
+            if (delta > 1 && now - direction.markNext < 16 * m_options.codelInterval)
+            {
+                direction.markCount = delta;
+            }
+            else
+            {
+                direction.markCount = 1;
+            }
+            direction.markNext = controlLaw(now, direction.markCount);
+            direction.lastMarkCount = direction.markCount;
+            return true;
+        }
+
+        void EmulatedLink::deliver(size_t end, const Block &wire)
+        {
+            Direction &direction = m_directions[end];
+            ++direction.stats.nDelivered;
+            direction.stats.nBytesDelivered += wire.size();
+            m_ends[1 - end]->receive(wire);
+        }
+
+        /**
+         * @brief Returns the KeyChain signing the management responses of every emulated transport
+         *
+         * The responses are only digest-signed, so one in-memory KeyChain serves all the links.
+         */
+        static KeyChain &
+        getCommandKeyChain()
+        {
+            static KeyChain keyChain("pib-memory:", "tpm-memory:");
+            return keyChain;
+        }
+
+        EmulatedTransport::EmulatedTransport(EmulatedLink &link, size_t end)
+            : m_link(&link),
+              m_end(end)
+        {
+        }
+
+        void EmulatedTransport::connect(boost::asio::io_service &ioService, ReceiveCallback receiveCallback)
+        {
+            Transport::connect(ioService, std::move(receiveCallback));
+            m_isConnected = true;
+        }
+
+        void EmulatedTransport::close()
+        {
+            m_isConnected = false;
+            m_isReceiving = false;
+        }
+
+        void EmulatedTransport::pause()
+        {
+            m_isReceiving = false;
+        }
+
+        void EmulatedTransport::resume()
+        {
+            if (m_isConnected)
+            {
+                m_isReceiving = true;
+            }
+        }
+
+        void EmulatedTransport::send(const Block &wire)
+        {
+            static const Name LOCALHOST("/localhost");
+
+            if (m_link == nullptr)
+            {
+                return;
+            }
+            if (wire.type() == tlv::Interest)
+            {
+                wire.parse();
+                auto name = wire.find(tlv::Name);
+                if (name != wire.elements_end() && LOCALHOST.isPrefixOf(Name(*name)))
+                {
+                    replyToCommand(Interest(wire));
+                    return;
+                }
+            }
+            m_link->transmit(m_end, wire);
+        }
+
+        void EmulatedTransport::send(const Block &header, const Block &payload)
+        {
+            // the header and the payload are the two parts of one packet on the link
+            auto buffer = make_shared<Buffer>(header.size() + payload.size());
+            std::copy(payload.begin(), payload.end(), std::copy(header.begin(), header.end(), buffer->begin()));
+            send(Block(std::move(buffer)));
+        }
+
+        void EmulatedTransport::replyToCommand(const Interest &interest)
+        {
+            // /localhost/nfd/rib/<verb>/<ControlParameters>/...
+            const Name &name = interest.getName();
+            if (name.size() < 5 || name.get(1) != name::Component("nfd") || name.get(2) != name::Component("rib"))
+            {
+                return;
+            }
+
+            nfd::ControlParameters params(name.get(4).blockFromValue());
+            if (!params.hasFaceId())
+            {
+                params.setFaceId(1);
+            }
+            if (!params.hasOrigin())
+            {
+                params.setOrigin(nfd::ROUTE_ORIGIN_APP);
+            }
+            if (name.get(3) == name::Component("register"))
+            {
+                if (!params.hasCost())
+                {
+                    params.setCost(0);
+                }
+                if (!params.hasFlags())
+                {
+                    params.setFlags(nfd::ROUTE_FLAG_CHILD_INHERIT);
+                }
+            }
+
+            nfd::ControlResponse response(200, "OK");
+            response.setBody(params.wireEncode());
+            auto data = make_shared<Data>(name);
+            data->setContent(response.wireEncode());
+            getCommandKeyChain().sign(*data, security::signingWithSha256());
+
+            auto self = shared_from_this();
+            m_ioService->post([self, data]
+                              { self->receive(data->wireEncode()); });
+        }
+
+        void EmulatedTransport::receive(const Block &wire)
+        {
+            if (m_isConnected && m_isReceiving)
+            {
+                m_receiveCallback(wire);
+            }
+        }
+
+        void EmulatedTransport::detach()
+        {
+            m_link = nullptr;
+        }
+    }
+}
@@ -0,0 +1,214 @@
+#ifndef CC_COMMON_EMULATED_LINK_H
+#define CC_COMMON_EMULATED_LINK_H
+#include "core/common.hpp"
+
+#include <ndn-cxx/transport/transport.hpp>
+#include <array>
+#include <deque>
+#include <random>
+
+namespace ndn
+{
+    namespace cc
+    {
+        class EmulatedTransport;
+
+        /**
+         * @brief Counters of one direction of an EmulatedLink
+         */
+        struct LinkStats
+        {
+            uint64_t nSent = 0;      //!< packets handed to the link
+            uint64_t nLost = 0;      //!< packets lost at random
+            uint64_t nDropped = 0;   //!< packets dropped by a full queue
+            uint64_t nMarked = 0;    //!< packets given a congestion mark
+            uint64_t nDelivered = 0; //!< packets delivered to the other end
+            uint64_t nBytesDelivered = 0;
+            size_t maxQueueLength = 0; //!< longest queue seen, in packets
+        };
+
+        /**
+         * @brief In-process point-to-point link between two Faces
+         *
+         * Each end is a Transport; the Face of a consumer and the Face of a producer created on the
+         * two ends exchange packets through it, within one io_service and without a forwarder.
+         * Each direction has a drop-tail FIFO queue drained at the link bandwidth, followed by the
+         * propagation delay. Packets are lost at random before entering the queue, and an active
+         * queue management scheme may mark packets with an NDNLPv2 CongestionMark as they leave
+         * the queue.
+         *
+         * The link also stands in for the forwarder management: command Interests under
+         * /localhost are answered at once with a successful response, so that prefix
+         * registrations succeed.
+         *
+         * Timing goes through a Scheduler, hence through ndn::time::steady_clock.
+         */
+        class EmulatedLink : noncopyable
+        {
+        public:
+            enum Aqm
+            {
+                NO_AQM, //!< drop-tail only
+                CODEL,  //!< mark at the CoDel control law once the sojourn time stays above target
+                STEP    //!< mark every packet leaving a queue longer than markThreshold
+            };
+
+            struct Options
+            {
+                double bandwidth = 0;                    //!< bits per second in each direction (0 == unlimited)
+                time::nanoseconds delay = 0_ns;          //!< one-way propagation delay
+                size_t queueSize = 1000;                 //!< packets held by the queue of each direction
+                double lossRate = 0;                     //!< probability that a packet is lost
+                Aqm aqm = NO_AQM;                        //!< active queue management
+                time::nanoseconds codelTarget = 5_ms;    //!< acceptable sojourn time of CODEL
+                time::nanoseconds codelInterval = 100_ms; //!< how long the sojourn time may stay above target
+                size_t markThreshold = 20;               //!< queue length, in packets, above which STEP marks
+                uint32_t seed = 1;                       //!< seed of the random loss
+            };
+
+            /**
+             * @brief Parses a comma-separated list of KEY=VALUE link options
+             *
+             * Keys are bw (Mbit/s), delay (ms), queue (packets), loss (probability), aqm (none,
+             * codel or step), target (ms), interval (ms), mark (packets) and seed. Keys not
+             * given keep their default value.
+             * @throw std::invalid_argument malformed specification
+             */
+            static Options
+            parseOptions(const std::string &spec);
+
+            EmulatedLink(boost::asio::io_service &io, const Options &options);
+
+            ~EmulatedLink();
+
+            /**
+             * @brief Returns the transport of end @p end (0 or 1)
+             */
+            shared_ptr<Transport>
+            getTransport(size_t end) const;
+
+            /**
+             * @brief Returns the counters of the direction leaving end @p end
+             */
+            const LinkStats &
+            getStats(size_t end) const
+            {
+                return m_directions.at(end).stats;
+            }
+
+            const Options &
+            getOptions() const
+            {
+                return m_options;
+            }
+
+        private:
+            struct QueuedPacket
+            {
+                Block wire;
+                time::steady_clock::TimePoint enqueueTime;
+            };
+
+            struct Direction
+            {
+                std::deque<QueuedPacket> queue;
+                bool isBusy = false; ///< \brief a packet is being serialized
+
+                // CoDel state, see RFC 8289
+                time::steady_clock::TimePoint firstAboveTime; ///< \brief zero when below target
+                time::steady_clock::TimePoint markNext;
+                uint32_t markCount = 0;
+                uint32_t lastMarkCount = 0;
+                bool isMarking = false;
+
+                LinkStats stats;
+            };
+
+            /**
+             * @brief Sends @p wire from end @p end to the other end
+             */
+            void
+            transmit(size_t end, const Block &wire);
+
+            /**
+             * @brief Starts serializing the packet at the head of the queue of @p end
+             */
+            void
+            startTransmission(size_t end);
+
+            /**
+             * @brief Decides whether the packet leaving the queue of @p direction is marked
+             */
+            bool
+            shouldMark(Direction &direction, time::nanoseconds sojourn, time::steady_clock::TimePoint now);
+
+            bool
+            shouldMarkCodel(Direction &direction, time::nanoseconds sojourn, time::steady_clock::TimePoint now);
+
+            void
+            deliver(size_t end, const Block &wire);
+
+            friend class EmulatedTransport;
+
+        private:
+            Options m_options;
+            Scheduler m_scheduler;
+            std::mt19937 m_rng;
+            std::uniform_real_distribution<double> m_lossDistribution;
+            std::array<Direction, 2> m_directions;
+            std::array<shared_ptr<EmulatedTransport>, 2> m_ends;
+        };
+
+        /**
+         * @brief Transport of one end of an EmulatedLink
+         */
+        class EmulatedTransport : public Transport,
+                                  public std::enable_shared_from_this<EmulatedTransport>
+        {
+        public:
+            EmulatedTransport(EmulatedLink &link, size_t end);
+
+            void
+            connect(boost::asio::io_service &ioService, ReceiveCallback receiveCallback) override;
+
+            void
+            close() override;
+
+            void
+            pause() override;
+
+            void
+            resume() override;
+
+            void
+            send(const Block &wire) override;
+
+            void
+            send(const Block &header, const Block &payload) override;
+
+        private:
+            /**
+             * @brief Answers a forwarder management command with a successful response
+             */
+            void
+            replyToCommand(const Interest &interest);
+
+            void
+            receive(const Block &wire);
+
+            /**
+             * @brief Detaches the transport from a link being destroyed
+             */
+            void
+            detach();
+
+            friend class EmulatedLink;
+
+        private:
+            EmulatedLink *m_link;
+            size_t m_end;
+        };
+    }
+}
+
+#endif // CC_COMMON_EMULATED_LINK_H
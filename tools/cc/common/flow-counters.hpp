@@ -0,0 +1,76 @@
+#ifndef CC_COMMON_FLOW_COUNTERS_H
+#define CC_COMMON_FLOW_COUNTERS_H
+#include "core/common.hpp"
+#include "latency-histogram.hpp"
+#include <atomic>
+
+namespace ndn
+{
+    namespace cc
+    {
+        /**
+         * @brief Snapshot of consumer counters
+         */
+        struct FlowStats
+        {
+            uint64_t nData = 0;  //!< Data packets received
+            uint64_t nBytes = 0; //!< Data bytes received
+
+            FlowStats &
+            operator+=(const FlowStats &other)
+            {
+                nData += other.nData;
+                nBytes += other.nBytes;
+                return *this;
+            }
+
+            FlowStats
+            operator-(const FlowStats &other) const
+            {
+                FlowStats diff;
+                diff.nData = nData - other.nData;
+                diff.nBytes = nBytes - other.nBytes;
+                return diff;
+            }
+        };
+
+        /**
+         * @brief Counters and delay histogram of one consumer, readable from any thread without locking
+         *
+         * Only the thread running the consumer writes the counters.
+         */
+        class FlowCounters : noncopyable
+        {
+        public:
+            void
+            onData(size_t size, time::nanoseconds delay)
+            {
+                m_nData.store(m_nData.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+                m_nBytes.store(m_nBytes.load(std::memory_order_relaxed) + size, std::memory_order_relaxed);
+                m_delay.record(delay);
+            }
+
+            FlowStats
+            snapshot() const
+            {
+                FlowStats stats;
+                stats.nData = m_nData.load(std::memory_order_relaxed);
+                stats.nBytes = m_nBytes.load(std::memory_order_relaxed);
+                return stats;
+            }
+
+            const LatencyHistogram &
+            getDelayHistogram() const
+            {
+                return m_delay;
+            }
+
+        private:
+            std::atomic<uint64_t> m_nData{0};
+            std::atomic<uint64_t> m_nBytes{0};
+            LatencyHistogram m_delay;
+        };
+    }
+}
+
+#endif // CC_COMMON_FLOW_COUNTERS_H
@@ -0,0 +1,84 @@
+#include "interest-template.hpp"
+#include "tlv-writer.hpp"
+
+#include <ndn-cxx/util/random.hpp>
+
+namespace ndn
+{
+    namespace cc
+    {
+        InterestTemplate::InterestTemplate(const Interest &prototype)
+            : m_prototype(prototype),
+              m_nonceOffset(-1)
+        {
+            Block wire = m_prototype.wireEncode();
+            wire.parse();
+            BOOST_ASSERT(!wire.elements().empty() && wire.elements().front().type() == tlv::Name);
+
+            const Block &name = wire.elements().front();
+            m_prefix = Buffer(name.value_begin(), name.value_end());
+            m_tail = Buffer(name.end(), wire.end());
+            for (const auto &element : wire.elements())
+            {
+                if (element.type() == tlv::Nonce)
+                {
+                    m_nonceOffset = element.value_begin() - name.end();
+                }
+            }
+            BOOST_ASSERT(m_nonceOffset >= 0);
+
+            // ServiceClass and Dsz may travel as packet tags instead of being part of the
+            // Interest wire; restore them on the decoded packet when that is the case
+            Interest decoded(wire);
+            m_shouldRestoreServiceClass = m_prototype.getServiceClass() &&
+                                          decoded.getServiceClass() != m_prototype.getServiceClass();
+            m_shouldRestoreDsz = m_prototype.getDsz() && decoded.getDsz() != m_prototype.getDsz();
+        }
+
+        Interest InterestTemplate::makeInterest(uint64_t seq)
+        {
+            size_t seqSize = sizeOfNonNegativeInteger(seq);
+            size_t componentSize = tlv::sizeOfVarNumber(tlv::GenericNameComponent) + tlv::sizeOfVarNumber(seqSize) + seqSize;
+            size_t nameLength = m_prefix.size() + componentSize;
+            size_t valueLength = tlv::sizeOfVarNumber(tlv::Name) + tlv::sizeOfVarNumber(nameLength) + nameLength + m_tail.size();
+            size_t totalLength = tlv::sizeOfVarNumber(tlv::Interest) + tlv::sizeOfVarNumber(valueLength) + valueLength;
+
+            // the Face keeps every expressed Interest until it is satisfied or expires, so a
+            // buffer could hardly ever be recycled: each Interest gets its own
+            auto buffer = make_shared<Buffer>(totalLength);
+            uint8_t *pos = buffer->data();
+            pos = writeVarNumber(pos, tlv::Interest);
+            pos = writeVarNumber(pos, valueLength);
+            pos = writeVarNumber(pos, tlv::Name);
+            pos = writeVarNumber(pos, nameLength);
+            pos = std::copy(m_prefix.begin(), m_prefix.end(), pos);
+            pos = writeVarNumber(pos, tlv::GenericNameComponent);
+            pos = writeVarNumber(pos, seqSize);
+            pos = writeNonNegativeInteger(pos, seq, seqSize);
+            std::copy(m_tail.begin(), m_tail.end(), pos);
+            writeNonNegativeInteger(pos + m_nonceOffset, random::generateWord32(), 4);
+
+            // the Face matches Data against a decoded Interest, so the wire is decoded once here;
+            // Interest::wireEncode decodes its own output the same way on the encoding path
+            Interest interest(Block(std::move(buffer)));
+            if (m_shouldRestoreServiceClass)
+            {
+                interest.setServiceClass(*m_prototype.getServiceClass());
+            }
+            if (m_shouldRestoreDsz)
+            {
+                interest.setDsz(*m_prototype.getDsz());
+            }
+            return interest;
+        }
+
+        Interest InterestTemplate::encodeInterest(uint64_t seq) const
+        {
+            Interest interest(m_prototype);
+            interest.setName(Name(m_prototype.getName()).appendNumber(seq));
+            interest.refreshNonce();
+            interest.wireEncode();
+            return interest;
+        }
+    }
+}
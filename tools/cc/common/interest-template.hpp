@@ -0,0 +1,53 @@
+#ifndef CC_COMMON_INTEREST_TEMPLATE_H
+#define CC_COMMON_INTEREST_TEMPLATE_H
+#include "core/common.hpp"
+
+namespace ndn
+{
+    namespace cc
+    {
+        /**
+         * @brief Pre-encoded wire template for consumer Interests
+         *
+         * The Interests of a consumer are named <prefix>/<seq> and otherwise carry the same
+         * fields (CanBePrefix, MustBeFresh, ServiceClass, Dsz, InterestLifetime, ...) except for
+         * the Nonce. The template keeps the encoded prefix components and the elements following
+         * the Name of a prototype Interest, and builds each Interest by writing the TLV headers,
+         * the prefix, the sequence-number component and that tail into one buffer and drawing a
+         * fresh Nonce in place, instead of copying the prefix Name and running a full encoding.
+         */
+        class InterestTemplate : noncopyable
+        {
+        public:
+            /**
+             * @param prototype Interest carrying the constant fields; its Name is the prefix
+             */
+            explicit InterestTemplate(const Interest &prototype);
+
+            /**
+             * @brief Builds the Interest for <prefix>/<seq> with a random Nonce
+             */
+            Interest
+            makeInterest(uint64_t seq);
+
+            /**
+             * @brief Builds the same Interest as makeInterest through Name construction and a
+             *        full encoding
+             *
+             * This is the reference path the template is checked and benchmarked against.
+             */
+            Interest
+            encodeInterest(uint64_t seq) const;
+
+        private:
+            Interest m_prototype;
+            Buffer m_prefix;               ///< \brief encoded components of the prefix
+            Buffer m_tail;                 ///< \brief elements following the Name
+            std::ptrdiff_t m_nonceOffset;  ///< \brief offset of the Nonce value in m_tail
+            bool m_shouldRestoreServiceClass; ///< \brief ServiceClass does not survive the wire
+            bool m_shouldRestoreDsz;          ///< \brief Dsz does not survive the wire
+        };
+    }
+}
+
+#endif // CC_COMMON_INTEREST_TEMPLATE_H
@@ -0,0 +1,103 @@
+#include "latency-histogram.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace ndn
+{
+    namespace cc
+    {
+        constexpr int LatencyHistogram::LINEAR_BITS;
+        constexpr size_t LatencyHistogram::N_SUB_BUCKETS;
+        constexpr size_t LatencyHistogram::N_BUCKETS;
+
+        HistogramSnapshot::HistogramSnapshot()
+            : m_counts(LatencyHistogram::N_BUCKETS),
+              m_count(0)
+        {
+        }
+
+        time::nanoseconds HistogramSnapshot::getPercentile(double percentile) const
+        {
+            if (m_count == 0)
+            {
+                return 0_ns;
+            }
+            auto rank = static_cast<uint64_t>(std::ceil(std::min(std::max(percentile, 0.0), 100.0) / 100.0 * m_count));
+            rank = std::max<uint64_t>(rank, 1);
+
+            uint64_t seen = 0;
+            for (size_t bucket = 0; bucket < m_counts.size(); ++bucket)
+            {
+                seen += m_counts[bucket];
+                if (seen >= rank)
+                {
+                    return time::nanoseconds(LatencyHistogram::getUpperEdge(bucket));
+                }
+            }
+            return getMax();
+        }
+
+        time::nanoseconds HistogramSnapshot::getMax() const
+        {
+            for (size_t bucket = m_counts.size(); bucket > 0; --bucket)
+            {
+                if (m_counts[bucket - 1] > 0)
+                {
+                    return time::nanoseconds(LatencyHistogram::getUpperEdge(bucket - 1));
+                }
+            }
+            return 0_ns;
+        }
+
+        HistogramSnapshot &HistogramSnapshot::operator+=(const HistogramSnapshot &other)
+        {
+            for (size_t bucket = 0; bucket < m_counts.size(); ++bucket)
+            {
+                m_counts[bucket] += other.m_counts[bucket];
+            }
+            m_count += other.m_count;
+            return *this;
+        }
+
+        HistogramSnapshot HistogramSnapshot::operator-(const HistogramSnapshot &other) const
+        {
+            HistogramSnapshot diff;
+            for (size_t bucket = 0; bucket < m_counts.size(); ++bucket)
+            {
+                diff.m_counts[bucket] = m_counts[bucket] - other.m_counts[bucket];
+            }
+            diff.m_count = m_count - other.m_count;
+            return diff;
+        }
+
+        LatencyHistogram::LatencyHistogram()
+            : m_counts(N_BUCKETS)
+        {
+        }
+
+        HistogramSnapshot LatencyHistogram::snapshot() const
+        {
+            HistogramSnapshot snapshot;
+            for (size_t bucket = 0; bucket < N_BUCKETS; ++bucket)
+            {
+                snapshot.m_counts[bucket] = m_counts[bucket].load(std::memory_order_relaxed);
+                snapshot.m_count += snapshot.m_counts[bucket];
+            }
+            return snapshot;
+        }
+
+        uint64_t LatencyHistogram::getUpperEdge(size_t bucket)
+        {
+            if (bucket < (size_t(1) << LINEAR_BITS))
+            {
+                return bucket;
+            }
+            size_t octave = (bucket - (size_t(1) << LINEAR_BITS)) / N_SUB_BUCKETS;
+            size_t sub = (bucket - (size_t(1) << LINEAR_BITS)) % N_SUB_BUCKETS;
+            int msb = static_cast<int>(octave) + LINEAR_BITS;
+            int shift = msb - (LINEAR_BITS - 1);
+            uint64_t lower = static_cast<uint64_t>(N_SUB_BUCKETS + sub) << shift;
+            return lower + ((uint64_t(1) << shift) - 1);
+        }
+    }
+}
@@ -0,0 +1,110 @@
+#ifndef CC_COMMON_LATENCY_HISTOGRAM_H
+#define CC_COMMON_LATENCY_HISTOGRAM_H
+#include "core/common.hpp"
+#include <algorithm>
+#include <atomic>
+
+namespace ndn
+{
+    namespace cc
+    {
+        /**
+         * @brief Copy of the counts of a LatencyHistogram, used to compute percentiles
+         */
+        class HistogramSnapshot
+        {
+        public:
+            HistogramSnapshot();
+
+            uint64_t
+            getCount() const
+            {
+                return m_count;
+            }
+
+            /**
+             * @brief Returns the duration that @p percentile % of the samples do not exceed
+             *
+             * The result is the upper edge of the bucket holding that sample, so it overestimates
+             * the exact percentile by at most the bucket width (under 1%).
+             */
+            time::nanoseconds
+            getPercentile(double percentile) const;
+
+            /**
+             * @brief Returns the upper edge of the highest non-empty bucket
+             */
+            time::nanoseconds
+            getMax() const;
+
+            HistogramSnapshot &
+            operator+=(const HistogramSnapshot &other);
+
+            /**
+             * @brief Returns the samples recorded between @p other and this snapshot
+             */
+            HistogramSnapshot
+            operator-(const HistogramSnapshot &other) const;
+
+        private:
+            std::vector<uint64_t> m_counts;
+            uint64_t m_count;
+
+            friend class LatencyHistogram;
+        };
+
+        /**
+         * @brief Log-linear (HDR-style) histogram of durations with a fixed memory footprint
+         *
+         * Durations below 2^LINEAR_BITS nanoseconds get one bucket each, larger ones fall into
+         * 2^(LINEAR_BITS - 1) buckets per power of two, which bounds the relative error to
+         * 2^-(LINEAR_BITS - 1). Recording is a bucket-index computation and a relaxed counter
+         * bump; only one thread may record, while any thread may take snapshots.
+         */
+        class LatencyHistogram : noncopyable
+        {
+        public:
+            static constexpr int LINEAR_BITS = 8;
+            static constexpr size_t N_SUB_BUCKETS = size_t(1) << (LINEAR_BITS - 1);
+            static constexpr size_t N_BUCKETS = (size_t(1) << LINEAR_BITS) + (64 - LINEAR_BITS) * N_SUB_BUCKETS;
+
+            LatencyHistogram();
+
+            void
+            record(time::nanoseconds duration)
+            {
+                auto &counter = m_counts[getBucket(static_cast<uint64_t>(std::max<time::nanoseconds::rep>(duration.count(), 0)))];
+                counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            }
+
+            HistogramSnapshot
+            snapshot() const;
+
+            static size_t
+            getBucket(uint64_t value);
+
+            /**
+             * @brief Returns the largest value that falls into @p bucket
+             */
+            static uint64_t
+            getUpperEdge(size_t bucket);
+
+        private:
+            std::vector<std::atomic<uint64_t>> m_counts;
+        };
+
+        inline size_t
+        LatencyHistogram::getBucket(uint64_t value)
+        {
+            if (value < (uint64_t(1) << LINEAR_BITS))
+            {
+                return static_cast<size_t>(value);
+            }
+            int msb = 63 - __builtin_clzll(value);
+            size_t sub = static_cast<size_t>(value >> (msb - (LINEAR_BITS - 1))) - N_SUB_BUCKETS;
+            return (size_t(1) << LINEAR_BITS) + (msb - LINEAR_BITS) * N_SUB_BUCKETS + sub;
+        }
+    }
+}
+
+#endif // CC_COMMON_LATENCY_HISTOGRAM_H
@@ -0,0 +1,327 @@
+#include "logger.hpp"
+#include <cstring>
+#include <fstream>
+
+namespace ndn
+{
+    namespace cc
+    {
+        namespace po = boost::program_options;
+
+        std::ostream &
+        operator<<(std::ostream &os, LogLevel level)
+        {
+            switch (level)
+            {
+            case LogLevel::NONE:
+                return os << "none";
+            case LogLevel::ERROR:
+                return os << "error";
+            case LogLevel::INFO:
+                return os << "info";
+            case LogLevel::DEBUG:
+                return os << "debug";
+            case LogLevel::TRACE:
+                return os << "trace";
+            }
+            return os << static_cast<int>(level);
+        }
+
+        LogLevel
+        parseLogLevel(const std::string &str)
+        {
+            for (auto level : {LogLevel::NONE, LogLevel::ERROR, LogLevel::INFO, LogLevel::DEBUG, LogLevel::TRACE})
+            {
+                if (boost::lexical_cast<std::string>(level) == str)
+                {
+                    return level;
+                }
+            }
+            NDN_THROW(std::invalid_argument("Unknown log level: " + str));
+        }
+
+        static void
+        printPayload(std::ostream &os, const LogRecord &record)
+        {
+            switch (record.type)
+            {
+            case LogRecord::PAYLOAD_NONE:
+                break;
+            case LogRecord::PAYLOAD_NAME:
+                os << Name(Block(record.payload, record.payloadSize));
+                break;
+            case LogRecord::PAYLOAD_TEXT:
+                os.write(reinterpret_cast<const char *>(record.payload), record.payloadSize);
+                break;
+            case LogRecord::PAYLOAD_NUMBER:
+                os << record.value;
+                break;
+            }
+        }
+
+        constexpr size_t LogRecord::PAYLOAD_CAPACITY;
+
+        StreamLogSink::StreamLogSink(std::ostream &os)
+            : m_os(os)
+        {
+        }
+
+        StreamLogSink::StreamLogSink(unique_ptr<std::ostream> os)
+            : m_ownedStream(std::move(os)),
+              m_os(*m_ownedStream)
+        {
+        }
+
+        void StreamLogSink::flush()
+        {
+            m_os.flush();
+        }
+
+        void TextLogSink::write(const LogRecord &record)
+        {
+            m_os << record.tag << ": ";
+            printPayload(m_os, record);
+            m_os << '\n';
+        }
+
+        void BinaryLogSink::write(const LogRecord &record)
+        {
+            auto tagLength = static_cast<uint8_t>(std::min<size_t>(std::strlen(record.tag),
+                                                                   std::numeric_limits<uint8_t>::max()));
+            m_os.write(reinterpret_cast<const char *>(&record.timestamp), sizeof(record.timestamp));
+            m_os.put(static_cast<char>(record.level));
+            m_os.put(static_cast<char>(tagLength));
+            m_os.write(record.tag, tagLength);
+            m_os.put(static_cast<char>(record.type));
+            m_os.write(reinterpret_cast<const char *>(&record.payloadSize), sizeof(record.payloadSize));
+            m_os.write(reinterpret_cast<const char *>(record.payload), record.payloadSize);
+            m_os.write(reinterpret_cast<const char *>(&record.value), sizeof(record.value));
+        }
+
+        Logger::Logger()
+            : m_level(LogLevel::NONE),
+              m_backend(Backend::SYNC),
+              m_sink(make_unique<TextLogSink>(std::cout)),
+              m_drainInterval(10_ms),
+              m_isDraining(false),
+              m_nDropped(0)
+        {
+        }
+
+        Logger::~Logger()
+        {
+            stop();
+        }
+
+        void Logger::configure(LogLevel level, Backend backend, unique_ptr<LogSink> sink,
+                               size_t ringCapacity, time::milliseconds drainInterval)
+        {
+            stop();
+
+            m_backend = backend;
+            m_sink = std::move(sink);
+            m_drainInterval = drainInterval;
+            m_nDropped = 0;
+            m_ring.reset();
+            if (m_backend == Backend::RING)
+            {
+                m_ring = make_unique<RingBuffer<LogRecord>>(ringCapacity);
+                m_isDraining = true;
+                m_drainer = std::thread([this]
+                                        { runDrainer(); });
+            }
+            m_level.store(level, std::memory_order_relaxed);
+        }
+
+        template <typename Fill>
+        void Logger::submit(LogLevel level, const char *tag, Fill &&fill)
+        {
+            auto init = [&](LogRecord &record)
+            {
+                record.timestamp = time::duration_cast<time::nanoseconds>(
+                                       time::steady_clock::now().time_since_epoch())
+                                       .count();
+                record.tag = tag;
+                record.value = 0;
+                record.level = level;
+                record.type = LogRecord::PAYLOAD_NONE;
+                record.payloadSize = 0;
+                fill(record);
+            };
+
+            if (m_backend == Backend::SYNC)
+            {
+                LogRecord record;
+                init(record);
+                std::lock_guard<std::mutex> lock(m_syncMutex);
+                m_sink->write(record);
+                m_sink->flush();
+            }
+            else if (!m_ring->tryPush(init))
+            {
+                m_nDropped.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+
+        static void
+        fillText(LogRecord &record, const std::string &text)
+        {
+            record.type = LogRecord::PAYLOAD_TEXT;
+            record.payloadSize = static_cast<uint16_t>(std::min(text.size(), LogRecord::PAYLOAD_CAPACITY));
+            std::memcpy(record.payload, text.data(), record.payloadSize);
+        }
+
+        void Logger::log(LogLevel level, const char *tag, const Name &name)
+        {
+            const Block &wire = name.wireEncode();
+            if (wire.size() <= LogRecord::PAYLOAD_CAPACITY)
+            {
+                submit(level, tag, [&](LogRecord &record)
+                       {
+                           record.type = LogRecord::PAYLOAD_NAME;
+                           record.payloadSize = static_cast<uint16_t>(wire.size());
+                           std::memcpy(record.payload, wire.wire(), wire.size()); });
+            }
+            else
+            {
+                // does not fit as TLV, keep the (truncated) URI instead
+                std::string uri = name.toUri();
+                submit(level, tag, [&](LogRecord &record)
+                       { fillText(record, uri); });
+            }
+        }
+
+        void Logger::log(LogLevel level, const char *tag, const std::string &text)
+        {
+            submit(level, tag, [&](LogRecord &record)
+                   { fillText(record, text); });
+        }
+
+        void Logger::log(LogLevel level, const char *tag, uint64_t value)
+        {
+            submit(level, tag, [&](LogRecord &record)
+                   {
+                       record.type = LogRecord::PAYLOAD_NUMBER;
+                       record.value = value; });
+        }
+
+        void Logger::stop()
+        {
+            if (!m_drainer.joinable())
+            {
+                return;
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(m_drainMutex);
+                m_isDraining = false;
+            }
+            m_drainCv.notify_all();
+            m_drainer.join();
+            drain();
+            m_sink->flush();
+        }
+
+        size_t Logger::drain()
+        {
+            size_t nRecords = 0;
+            LogRecord record;
+            while (m_ring->tryPop(record))
+            {
+                m_sink->write(record);
+                ++nRecords;
+            }
+            return nRecords;
+        }
+
+        void Logger::runDrainer()
+        {
+            while (m_isDraining)
+            {
+                if (drain() > 0)
+                {
+                    m_sink->flush();
+                }
+                else
+                {
+                    // writers never notify, an idle ring is simply polled every drain interval
+                    std::unique_lock<std::mutex> lock(m_drainMutex);
+                    m_drainCv.wait_for(lock, std::chrono::milliseconds(m_drainInterval.count()),
+                                       [this]
+                                       { return !m_isDraining; });
+                }
+            }
+        }
+
+        Logger &
+        getLogger()
+        {
+            static Logger logger;
+            return logger;
+        }
+
+        void
+        addLoggerOptions(po::options_description &desc, LoggerOptions &options, const std::string &defaultLevel)
+        {
+            desc.add_options()(
+                "log-level", po::value<std::string>(&options.level)->default_value(defaultLevel),
+                "log level (none, error, info, debug, trace)");
+            desc.add_options()(
+                "log-backend", po::value<std::string>(&options.backend)->default_value(options.backend),
+                "log backend: sync (write on the calling thread) or ring (lock-free ring drained by a background thread)");
+            desc.add_options()(
+                "log-format", po::value<std::string>(&options.format)->default_value(options.format),
+                "log format (text or binary)");
+            desc.add_options()(
+                "log-file", po::value<std::string>(&options.file),
+                "write the log to this file instead of the standard output");
+        }
+
+        void
+        applyLoggerOptions(const LoggerOptions &options)
+        {
+            LogLevel level = parseLogLevel(options.level);
+
+            Logger::Backend backend;
+            if (options.backend == "sync")
+            {
+                backend = Logger::Backend::SYNC;
+            }
+            else if (options.backend == "ring")
+            {
+                backend = Logger::Backend::RING;
+            }
+            else
+            {
+                NDN_THROW(std::invalid_argument("Unknown log backend: " + options.backend));
+            }
+
+            if (options.format != "text" && options.format != "binary")
+            {
+                NDN_THROW(std::invalid_argument("Unknown log format: " + options.format));
+            }
+
+            unique_ptr<std::ostream> file;
+            if (!options.file.empty())
+            {
+                file = make_unique<std::ofstream>(options.file, std::ios::binary | std::ios::trunc);
+                if (!*file)
+                {
+                    NDN_THROW(std::runtime_error("Cannot open log file " + options.file));
+                }
+            }
+
+            unique_ptr<LogSink> sink;
+            if (options.format == "text")
+            {
+                sink = file ? make_unique<TextLogSink>(std::move(file)) : make_unique<TextLogSink>(std::cout);
+            }
+            else
+            {
+                sink = file ? make_unique<BinaryLogSink>(std::move(file)) : make_unique<BinaryLogSink>(std::cout);
+            }
+
+            getLogger().configure(level, backend, std::move(sink));
+        }
+    }
+}
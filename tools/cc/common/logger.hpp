@@ -0,0 +1,250 @@
+#ifndef CC_COMMON_LOGGER_H
+#define CC_COMMON_LOGGER_H
+#include "core/common.hpp"
+#include "ring-buffer.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace ndn
+{
+    namespace cc
+    {
+        enum class LogLevel : uint8_t
+        {
+            NONE,
+            ERROR,
+            INFO,
+            DEBUG,
+            TRACE
+        };
+
+        std::ostream &
+        operator<<(std::ostream &os, LogLevel level);
+
+        /**
+         * @brief Parses a log level name (none, error, info, debug, trace)
+         * @throw std::invalid_argument unknown name
+         */
+        LogLevel
+        parseLogLevel(const std::string &str);
+
+        /**
+         * @brief Fixed-size log entry, formatted only when it reaches the sink
+         */
+        struct LogRecord
+        {
+            enum PayloadType : uint8_t
+            {
+                PAYLOAD_NONE,
+                PAYLOAD_NAME,  //!< payload holds the wire encoding of a Name
+                PAYLOAD_TEXT,  //!< payload holds (possibly truncated) text
+                PAYLOAD_NUMBER //!< value holds a number
+            };
+
+            static constexpr size_t PAYLOAD_CAPACITY = 96;
+
+            uint64_t timestamp;  //!< steady clock, in nanoseconds
+            const char *tag;     //!< string literal naming the event
+            uint64_t value;      //!< numeric payload
+            LogLevel level;
+            PayloadType type;
+            uint16_t payloadSize;
+            uint8_t payload[PAYLOAD_CAPACITY];
+        };
+
+        /**
+         * @brief Destination of log records
+         */
+        class LogSink : noncopyable
+        {
+        public:
+            virtual ~LogSink() = default;
+
+            virtual void
+            write(const LogRecord &record) = 0;
+
+            virtual void
+            flush() = 0;
+        };
+
+        /**
+         * @brief Sink writing to an output stream, optionally owning it
+         */
+        class StreamLogSink : public LogSink
+        {
+        public:
+            explicit StreamLogSink(std::ostream &os);
+
+            explicit StreamLogSink(unique_ptr<std::ostream> os);
+
+            void
+            flush() override;
+
+        protected:
+            unique_ptr<std::ostream> m_ownedStream;
+            std::ostream &m_os;
+        };
+
+        /**
+         * @brief Writes records as "tag: payload" lines, flushing only on request
+         */
+        class TextLogSink : public StreamLogSink
+        {
+        public:
+            using StreamLogSink::StreamLogSink;
+
+            void
+            write(const LogRecord &record) override;
+        };
+
+        /**
+         * @brief Writes records in a compact binary form
+         *
+         * Each record is: timestamp (8 octets), level (1), tag length (1), tag, payload type (1),
+         * payload length (2), payload, value (8); integers are in host byte order.
+         */
+        class BinaryLogSink : public StreamLogSink
+        {
+        public:
+            using StreamLogSink::StreamLogSink;
+
+            void
+            write(const LogRecord &record) override;
+        };
+
+        /**
+         * @brief Logger shared by the cc tools
+         *
+         * With the SYNC backend a record is formatted and flushed on the calling thread, like the
+         * original std::endl based output. With the RING backend the caller only copies the record
+         * into a lock-free ring, and a background thread drains it into the sink in batches;
+         * records are dropped (and counted) rather than blocking when the ring is full.
+         */
+        class Logger : noncopyable
+        {
+        public:
+            enum class Backend
+            {
+                SYNC,
+                RING
+            };
+
+            Logger();
+
+            ~Logger();
+
+            /**
+             * @brief Replaces level, backend and sink
+             *
+             * @note Not thread-safe, call before the tools start logging
+             */
+            void
+            configure(LogLevel level, Backend backend, unique_ptr<LogSink> sink,
+                      size_t ringCapacity = 65536,
+                      time::milliseconds drainInterval = 10_ms);
+
+            bool
+            isEnabled(LogLevel level) const
+            {
+                return level <= m_level.load(std::memory_order_relaxed);
+            }
+
+            void
+            log(LogLevel level, const char *tag, const Name &name);
+
+            void
+            log(LogLevel level, const char *tag, const std::string &text);
+
+            void
+            log(LogLevel level, const char *tag, const char *text)
+            {
+                log(level, tag, std::string(text));
+            }
+
+            void
+            log(LogLevel level, const char *tag, uint64_t value);
+
+            /**
+             * @brief Drains pending records and stops the background thread
+             */
+            void
+            stop();
+
+            uint64_t
+            getNDropped() const
+            {
+                return m_nDropped.load(std::memory_order_relaxed);
+            }
+
+        private:
+            template <typename Fill>
+            void
+            submit(LogLevel level, const char *tag, Fill &&fill);
+
+            size_t
+            drain();
+
+            void
+            runDrainer();
+
+        private:
+            std::atomic<LogLevel> m_level;
+            Backend m_backend;
+            unique_ptr<LogSink> m_sink;
+            unique_ptr<RingBuffer<LogRecord>> m_ring;
+            time::milliseconds m_drainInterval;
+
+            std::mutex m_syncMutex; ///< \brief serializes writers of the SYNC backend
+            std::thread m_drainer;
+            std::mutex m_drainMutex;
+            std::condition_variable m_drainCv; ///< \brief wakes the drainer up early on stop()
+            std::atomic<bool> m_isDraining;
+            std::atomic<uint64_t> m_nDropped;
+        };
+
+        /**
+         * @brief Returns the process-wide logger
+         */
+        Logger &
+        getLogger();
+
+        /**
+         * @brief Command line options selecting the logger configuration
+         */
+        struct LoggerOptions
+        {
+            std::string level;
+            std::string backend = "ring";
+            std::string format = "text";
+            std::string file;
+        };
+
+        void
+        addLoggerOptions(boost::program_options::options_description &desc, LoggerOptions &options,
+                         const std::string &defaultLevel);
+
+        /**
+         * @brief Configures getLogger() according to @p options
+         * @throw std::invalid_argument invalid option value
+         * @throw std::runtime_error log file cannot be opened
+         */
+        void
+        applyLoggerOptions(const LoggerOptions &options);
+    }
+}
+
+/**
+ * @brief Logs @p payload under @p tag, evaluating nothing unless @p level is enabled
+ */
+#define CC_LOG(level, tag, payload)                                               \
+    do                                                                            \
+    {                                                                             \
+        if (::ndn::cc::getLogger().isEnabled(::ndn::cc::LogLevel::level))         \
+        {                                                                         \
+            ::ndn::cc::getLogger().log(::ndn::cc::LogLevel::level, tag, payload); \
+        }                                                                         \
+    } while (false)
+
+#endif // CC_COMMON_LOGGER_H
@@ -0,0 +1,149 @@
+#ifndef CC_COMMON_RING_BUFFER_H
+#define CC_COMMON_RING_BUFFER_H
+#include "core/common.hpp"
+#include <atomic>
+
+namespace ndn
+{
+    namespace cc
+    {
+        /**
+         * @brief Bounded lock-free queue for many producers and a single consumer
+         *
+         * Each slot carries a sequence number telling whether it is free for the writer of a
+         * given position or holds an item for the reader of that position (D. Vyukov's bounded
+         * queue). Writers never block: tryPush() fails when the ring is full.
+         */
+        template <typename T>
+        class RingBuffer : noncopyable
+        {
+        public:
+            /**
+             * @param capacity number of slots, rounded up to a power of two
+             */
+            explicit RingBuffer(size_t capacity)
+            {
+                size_t size = 2;
+                while (size < capacity)
+                {
+                    size <<= 1;
+                }
+                m_mask = size - 1;
+                m_slots = make_unique<Slot[]>(size);
+                for (size_t i = 0; i < size; ++i)
+                {
+                    m_slots[i].sequence.store(i, std::memory_order_relaxed);
+                }
+            }
+
+            size_t
+            capacity() const
+            {
+                return m_mask + 1;
+            }
+
+            /**
+             * @brief Claims a slot and lets @p fill write the item in place
+             *
+             * @return false if the ring is full, @p fill is not called in that case
+             */
+            template <typename Fill>
+            bool
+            tryPush(Fill &&fill)
+            {
+                size_t pos = m_tail.load(std::memory_order_relaxed);
+                Slot *slot;
+                while (true)
+                {
+                    slot = &m_slots[pos & m_mask];
+                    size_t sequence = slot->sequence.load(std::memory_order_acquire);
+                    auto diff = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos);
+                    if (diff == 0)
+                    {
+                        if (m_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                        {
+                            break;
+                        }
+                    }
+                    else if (diff < 0)
+                    {
+                        return false;
+                    }
+                    else
+                    {
+                        pos = m_tail.load(std::memory_order_relaxed);
+                    }
+                }
+
+                fill(slot->item);
+                slot->sequence.store(pos + 1, std::memory_order_release);
+                return true;
+            }
+
+            /**
+             * @brief Removes the oldest item
+             *
+             * @note Must only be called from the single consumer thread
+             * @return false if the ring is empty
+             */
+            bool
+            tryPop(T &item)
+            {
+                size_t pos = m_head.load(std::memory_order_relaxed);
+                Slot &slot = m_slots[pos & m_mask];
+                size_t sequence = slot.sequence.load(std::memory_order_acquire);
+                if (sequence != pos + 1)
+                {
+                    return false;
+                }
+
+                item = slot.item;
+                slot.sequence.store(pos + m_mask + 1, std::memory_order_release);
+                m_head.store(pos + 1, std::memory_order_relaxed);
+                return true;
+            }
+
+        private:
+            struct Slot
+            {
+                std::atomic<size_t> sequence;
+                T item;
+            };
+
+            /**
+             * @brief Position counter kept away from its neighbours' cache lines
+             */
+            struct Position
+            {
+                char padding[64];
+                std::atomic<size_t> value{0};
+
+                size_t
+                load(std::memory_order order) const
+                {
+                    return value.load(order);
+                }
+
+                void
+                store(size_t pos, std::memory_order order)
+                {
+                    value.store(pos, order);
+                }
+
+                bool
+                compare_exchange_weak(size_t &expected, size_t desired, std::memory_order order)
+                {
+                    return value.compare_exchange_weak(expected, desired, order);
+                }
+            };
+
+            unique_ptr<Slot[]> m_slots;
+            size_t m_mask;
+
+            Position m_head; ///< \brief next position to read, owned by the consumer
+            Position m_tail; ///< \brief next position to write, claimed by producers
+        };
+    }
+}
+
+#endif // CC_COMMON_RING_BUFFER_H
@@ -0,0 +1,149 @@
+#ifndef CC_COMMON_SEQUENCE_TABLE_H
+#define CC_COMMON_SEQUENCE_TABLE_H
+#include "core/common.hpp"
+
+namespace ndn
+{
+    namespace cc
+    {
+        /**
+         * @brief Map from the sequence numbers of a sliding window to per-sequence state
+         *
+         * The entries live in a preallocated ring indexed by the sequence number modulo its size,
+         * a power of two. Sequence numbers closer to each other than the ring size never share a
+         * slot, so as long as the keys in the table span less than the ring, finding, inserting
+         * and erasing are single array accesses that allocate nothing. A key landing on the slot of
+         * another one doubles the ring until both fit, so memory is proportional to the spread of
+         * the keys, not to their number.
+         *
+         * It replaces std::unordered_map for the state of the Interests in flight, whose sequence
+         * numbers lie within the congestion window.
+         */
+        template <typename T>
+        class SequenceTable
+        {
+        public:
+            /**
+             * @param capacity initial number of sequence numbers the ring spans, rounded up to a
+             *                 power of two
+             */
+            explicit SequenceTable(size_t capacity = 4096)
+                : m_size(0)
+            {
+                size_t size = 1;
+                while (size < capacity)
+                {
+                    size <<= 1;
+                }
+                m_slots.resize(size);
+                m_mask = size - 1;
+            }
+
+            bool
+            empty() const
+            {
+                return m_size == 0;
+            }
+
+            size_t
+            size() const
+            {
+                return m_size;
+            }
+
+            /**
+             * @brief Returns the number of sequence numbers the ring spans
+             */
+            size_t
+            getCapacity() const
+            {
+                return m_slots.size();
+            }
+
+            /**
+             * @brief Returns the state of @p seq, or nullptr if it is not in the table
+             */
+            T *
+            find(uint64_t seq)
+            {
+                Slot &slot = m_slots[seq & m_mask];
+                return slot.isUsed && slot.seq == seq ? &slot.value : nullptr;
+            }
+
+            /**
+             * @brief Returns the state of @p seq, inserting a default one if it is not in the table
+             *
+             * Inserting may move the entries, which invalidates the pointers returned by find().
+             */
+            T &
+            insert(uint64_t seq)
+            {
+                while (m_slots[seq & m_mask].isUsed && m_slots[seq & m_mask].seq != seq)
+                {
+                    grow();
+                }
+
+                Slot &slot = m_slots[seq & m_mask];
+                if (!slot.isUsed)
+                {
+                    slot.seq = seq;
+                    slot.value = T{};
+                    slot.isUsed = true;
+                    ++m_size;
+                }
+                return slot.value;
+            }
+
+            /**
+             * @return the number of entries erased (0 or 1)
+             */
+            size_t
+            erase(uint64_t seq)
+            {
+                Slot &slot = m_slots[seq & m_mask];
+                if (!slot.isUsed || slot.seq != seq)
+                {
+                    return 0;
+                }
+                slot.isUsed = false;
+                slot.value = T{};
+                --m_size;
+                return 1;
+            }
+
+        private:
+            struct Slot
+            {
+                uint64_t seq = 0;
+                bool isUsed = false;
+                T value{};
+            };
+
+            /**
+             * @brief Doubles the ring, moving every entry to its slot in the larger one
+             */
+            void
+            grow()
+            {
+                std::vector<Slot> slots(m_slots.size() * 2);
+                uint64_t mask = slots.size() - 1;
+                for (auto &slot : m_slots)
+                {
+                    if (slot.isUsed)
+                    {
+                        slots[slot.seq & mask] = std::move(slot);
+                    }
+                }
+                m_slots = std::move(slots);
+                m_mask = mask;
+            }
+
+        private:
+            std::vector<Slot> m_slots;
+            uint64_t m_mask; ///< \brief ring size minus one
+            size_t m_size;
+        };
+    }
+}
+
+#endif // CC_COMMON_SEQUENCE_TABLE_H
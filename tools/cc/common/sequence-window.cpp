@@ -0,0 +1,137 @@
+#include "sequence-window.hpp"
+
+#include <algorithm>
+
+namespace ndn
+{
+    namespace cc
+    {
+        constexpr unsigned SequenceWindow::WORD_SHIFT;
+        constexpr uint64_t SequenceWindow::WORD_MASK;
+
+        SequenceWindow::SequenceWindow(size_t capacity)
+            : m_firstWord(0),
+              m_nWords(0),
+              m_size(0)
+        {
+            size_t nWords = 1;
+            while ((nWords << WORD_SHIFT) < capacity)
+            {
+                nWords <<= 1;
+            }
+            m_words.assign(nWords, 0);
+            m_mask = nWords - 1;
+        }
+
+        bool SequenceWindow::insert(uint64_t seq)
+        {
+            uint64_t word = seq >> WORD_SHIFT;
+            if (m_nWords == 0)
+            {
+                m_firstWord = word;
+                m_nWords = 1;
+            }
+            else if (word < m_firstWord)
+            {
+                resize(word, m_firstWord + m_nWords - word);
+            }
+            else if (word >= m_firstWord + m_nWords)
+            {
+                resize(m_firstWord, word - m_firstWord + 1);
+            }
+
+            uint64_t &bits = m_words[word & m_mask];
+            uint64_t bit = uint64_t(1) << (seq & WORD_MASK);
+            if ((bits & bit) != 0)
+            {
+                return false;
+            }
+            bits |= bit;
+            ++m_size;
+            return true;
+        }
+
+        size_t SequenceWindow::erase(uint64_t seq)
+        {
+            if (!contains(seq))
+            {
+                return 0;
+            }
+
+            m_words[(seq >> WORD_SHIFT) & m_mask] &= ~(uint64_t(1) << (seq & WORD_MASK));
+            --m_size;
+            trim();
+            return 1;
+        }
+
+        bool SequenceWindow::contains(uint64_t seq) const
+        {
+            uint64_t word = seq >> WORD_SHIFT;
+            if (word < m_firstWord || word >= m_firstWord + m_nWords)
+            {
+                return false;
+            }
+            return (m_words[word & m_mask] >> (seq & WORD_MASK) & 1) != 0;
+        }
+
+        uint64_t SequenceWindow::popMin()
+        {
+            uint64_t seq = getMin();
+            uint64_t &bits = m_words[m_firstWord & m_mask];
+            bits &= bits - 1; // clear the lowest set bit
+            --m_size;
+            trim();
+            return seq;
+        }
+
+        void SequenceWindow::clear()
+        {
+            std::fill(m_words.begin(), m_words.end(), 0);
+            m_nWords = 0;
+            m_size = 0;
+        }
+
+        void SequenceWindow::resize(uint64_t firstWord, uint64_t nWords)
+        {
+            if (nWords > m_words.size())
+            {
+                size_t newSize = m_words.size();
+                while (newSize < nWords)
+                {
+                    newSize <<= 1;
+                }
+
+                std::vector<uint64_t> words(newSize, 0);
+                uint64_t newMask = newSize - 1;
+                for (uint64_t word = m_firstWord; word < m_firstWord + m_nWords; ++word)
+                {
+                    words[word & newMask] = m_words[word & m_mask];
+                }
+                m_words.swap(words);
+                m_mask = newMask;
+            }
+
+            // words entering the window were cleared when they last left it
+            m_firstWord = firstWord;
+            m_nWords = nWords;
+        }
+
+        void SequenceWindow::trim()
+        {
+            if (m_size == 0)
+            {
+                m_nWords = 0;
+                return;
+            }
+            while (m_words[m_firstWord & m_mask] == 0)
+            {
+                ++m_firstWord;
+                --m_nWords;
+            }
+            while (m_words[(m_firstWord + m_nWords - 1) & m_mask] == 0)
+            {
+                --m_nWords;
+            }
+        }
+    }
+}
@@ -0,0 +1,105 @@
+#ifndef CC_COMMON_SEQUENCE_WINDOW_H
+#define CC_COMMON_SEQUENCE_WINDOW_H
+#include "core/common.hpp"
+
+namespace ndn
+{
+    namespace cc
+    {
+        /**
+         * @brief Ordered set of sequence numbers that lie within a sliding window
+         *
+         * The set is a bitmap over a ring of 64-bit words, one bit per sequence number. The ring
+         * spans the words from the one holding the smallest member to the one holding the largest,
+         * and the first word is kept non-empty, so inserting, erasing and popping the smallest
+         * member are O(1) (amortized over the words the window slides past). The ring grows when
+         * the members spread over more words than it has, so memory is proportional to the spread
+         * of the members, not to their number.
+         *
+         * It replaces std::set for the retransmission queues of the consumers, whose members are
+         * the lost sequence numbers of a window of Interests in flight.
+         */
+        class SequenceWindow
+        {
+        public:
+            /**
+             * @param capacity initial number of sequence numbers the window spans, rounded up to
+             *                 a power of two multiple of 64
+             */
+            explicit SequenceWindow(size_t capacity = 4096);
+
+            bool
+            empty() const
+            {
+                return m_size == 0;
+            }
+
+            size_t
+            size() const
+            {
+                return m_size;
+            }
+
+            /**
+             * @return whether @p seq was not a member yet
+             */
+            bool
+            insert(uint64_t seq);
+
+            /**
+             * @return the number of members erased (0 or 1)
+             */
+            size_t
+            erase(uint64_t seq);
+
+            bool
+            contains(uint64_t seq) const;
+
+            /**
+             * @brief Returns the smallest member
+             * @pre !empty()
+             */
+            uint64_t
+            getMin() const
+            {
+                BOOST_ASSERT(!empty());
+                return (m_firstWord << WORD_SHIFT) + __builtin_ctzll(m_words[m_firstWord & m_mask]);
+            }
+
+            /**
+             * @brief Removes and returns the smallest member
+             * @pre !empty()
+             */
+            uint64_t
+            popMin();
+
+            void
+            clear();
+
+        private:
+            /**
+             * @brief Makes the ring span @p nWords words starting at @p firstWord
+             */
+            void
+            resize(uint64_t firstWord, uint64_t nWords);
+
+            /**
+             * @brief Drops the empty words at both ends of the ring
+             */
+            void
+            trim();
+
+        private:
+            static constexpr unsigned WORD_SHIFT = 6;
+            static constexpr uint64_t WORD_MASK = (1 << WORD_SHIFT) - 1;
+
+            std::vector<uint64_t> m_words;
+            uint64_t m_mask;      ///< \brief ring size minus one
+            uint64_t m_firstWord; ///< \brief index (seq >> WORD_SHIFT) of the first word of the window
+            uint64_t m_nWords;    ///< \brief number of words the window spans
+            size_t m_size;
+        };
+    }
+}
+
+#endif // CC_COMMON_SEQUENCE_WINDOW_H
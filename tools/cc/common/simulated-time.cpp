@@ -0,0 +1,96 @@
+#include "simulated-time.hpp"
+
+namespace ndn
+{
+    namespace cc
+    {
+        class SimulatedTime::SteadyClock : public time::UnitTestSteadyClock
+        {
+        public:
+            SteadyClock()
+                : time::UnitTestSteadyClock(time::days(1)),
+                  m_nextWait(time::steady_clock::duration::max())
+            {
+            }
+
+            /**
+             * @brief Called by the io_service with the wait until the earliest timer of each timer
+             *        queue, whenever it checks the timers or a new timer becomes the earliest
+             */
+            time::steady_clock::duration
+            toWaitDuration(time::steady_clock::duration d) const override
+            {
+                m_nextWait = std::min(m_nextWait, d);
+                // a minimal real wait, so that the timers are checked again at once
+                return time::UnitTestSteadyClock::toWaitDuration(d);
+            }
+
+            void
+            resetNextWait()
+            {
+                m_nextWait = time::steady_clock::duration::max();
+            }
+
+            /**
+             * @brief Returns the shortest wait noted since resetNextWait()
+             *
+             * A timer cancelled since it was noted can make it too short, which only costs one
+             * more poll, but it is never too long.
+             */
+            time::steady_clock::duration
+            getNextWait() const
+            {
+                return m_nextWait;
+            }
+
+        private:
+            mutable time::steady_clock::duration m_nextWait;
+        };
+
+        SimulatedTime::SimulatedTime()
+            : m_steadyClock(make_shared<SteadyClock>()),
+              m_systemClock(make_shared<time::UnitTestSystemClock>())
+        {
+            time::setCustomClocks(m_steadyClock, m_systemClock);
+            m_start = time::steady_clock::now();
+        }
+
+        SimulatedTime::~SimulatedTime()
+        {
+            time::setCustomClocks(nullptr, nullptr);
+        }
+
+        size_t
+        SimulatedTime::run(boost::asio::io_service &io)
+        {
+            size_t nHandlers = 0;
+            while (!io.stopped())
+            {
+                m_steadyClock->resetNextWait();
+                size_t n = io.poll();
+                nHandlers += n;
+                if (n > 0)
+                {
+                    continue;
+                }
+
+                // nothing is ready at the current time
+                auto wait = m_steadyClock->getNextWait();
+                if (wait == time::steady_clock::duration::max() || wait <= time::steady_clock::duration::zero())
+                {
+                    // the timers were not checked during this poll, or a due one is about to be
+                    continue;
+                }
+                m_steadyClock->advance(wait);
+                m_systemClock->advance(wait);
+            }
+            return nHandlers;
+        }
+
+        time::nanoseconds
+        SimulatedTime::getElapsed() const
+        {
+            return time::steady_clock::now() - m_start;
+        }
+    }
+}
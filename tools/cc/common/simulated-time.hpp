@@ -0,0 +1,61 @@
+#ifndef CC_COMMON_SIMULATED_TIME_H
+#define CC_COMMON_SIMULATED_TIME_H
+#include "core/common.hpp"
+
+#include <ndn-cxx/util/time-unit-test-clock.hpp>
+
+namespace ndn
+{
+    namespace cc
+    {
+        /**
+         * @brief Discrete-event simulated time for an io_service
+         *
+         * While it exists, the ndn-cxx steady and system clocks are virtual: they only move when
+         * run() finds no handler ready, and then jump straight to the expiry of the earliest
+         * timer. Everything timed through Scheduler (consumers, Face timeouts, EmulatedLink)
+         * therefore runs as fast as the handlers execute, and two runs of the same setup take the
+         * same steps at the same virtual times.
+         *
+         * Timers not based on the ndn-cxx clocks (boost::asio::steady_timer) still wait in real
+         * time, and a handler busy polling the clock never lets it advance.
+         *
+         * Only one instance may exist at a time, since the clocks are process-wide.
+         */
+        class SimulatedTime : noncopyable
+        {
+        public:
+            SimulatedTime();
+
+            /**
+             * @brief Restores the real clocks
+             */
+            ~SimulatedTime();
+
+            /**
+             * @brief Runs the handlers of @p io until it is stopped or runs out of work
+             * @return the number of handlers run
+             */
+            size_t
+            run(boost::asio::io_service &io);
+
+            /**
+             * @brief Returns the simulated time elapsed since construction
+             */
+            time::nanoseconds
+            getElapsed() const;
+
+        private:
+            /**
+             * @brief Steady clock noting the wait until the earliest timer, as computed by the io_service
+             */
+            class SteadyClock;
+
+            shared_ptr<SteadyClock> m_steadyClock;
+            shared_ptr<time::UnitTestSystemClock> m_systemClock;
+            time::steady_clock::TimePoint m_start;
+        };
+    }
+}
+
+#endif // CC_COMMON_SIMULATED_TIME_H
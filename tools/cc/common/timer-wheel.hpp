@@ -0,0 +1,376 @@
+#ifndef CC_COMMON_TIMER_WHEEL_H
+#define CC_COMMON_TIMER_WHEEL_H
+#include "core/common.hpp"
+#include <array>
+
+namespace ndn
+{
+    namespace cc
+    {
+        /**
+         * @brief Hierarchical timer wheel
+         *
+         * Time is counted in ticks from the construction of the wheel. Each of the N_LEVELS levels
+         * has N_SLOTS slots, a slot of level k covering N_SLOTS^k ticks; a timer goes to the lowest
+         * level whose span covers its distance from the current tick, and timers of a higher-level
+         * slot are moved down once the current tick enters that slot (cascading). Timers are
+         * nodes of doubly-linked slot lists kept in a pool, so insert and cancel are O(1) and
+         * allocate nothing once the pool has grown; advancing costs O(1) per elapsed tick plus the
+         * cascaded and expired timers.
+         *
+         * Timers expire at the precision of a tick, in tick order; timers of the same tick expire
+         * in no particular order.
+         */
+        template <typename T>
+        class TimerWheel : noncopyable
+        {
+        public:
+            using Handle = uint32_t;
+            static constexpr Handle INVALID_HANDLE = std::numeric_limits<uint32_t>::max();
+
+            static constexpr unsigned SLOT_BITS = 8;
+            static constexpr size_t N_SLOTS = 1 << SLOT_BITS;
+            static constexpr size_t N_LEVELS = 4;
+
+            /**
+             * @param tick precision of the expiry times
+             * @param origin time of tick 0
+             */
+            explicit TimerWheel(time::nanoseconds tick = 1_ms,
+                                time::steady_clock::TimePoint origin = time::steady_clock::now())
+                : m_tick(tick),
+                  m_origin(origin),
+                  m_now(0),
+                  m_freeList(INVALID_HANDLE),
+                  m_size(0)
+            {
+                BOOST_ASSERT(m_tick > time::nanoseconds::zero());
+                m_heads.fill(INVALID_HANDLE);
+                for (auto &level : m_occupied)
+                {
+                    level.fill(0);
+                }
+            }
+
+            bool
+            empty() const
+            {
+                return m_size == 0;
+            }
+
+            size_t
+            size() const
+            {
+                return m_size;
+            }
+
+            /**
+             * @brief Returns the time up to which the wheel has expired its timers
+             */
+            time::steady_clock::TimePoint
+            getNow() const
+            {
+                return toTime(m_now);
+            }
+
+            /**
+             * @brief Adds a timer expiring at @p when
+             *
+             * A timer at or before the current time expires on the next advance().
+             */
+            Handle
+            insert(time::steady_clock::TimePoint when, T value)
+            {
+                Handle handle = m_freeList;
+                if (handle == INVALID_HANDLE)
+                {
+                    handle = static_cast<Handle>(m_nodes.size());
+                    m_nodes.emplace_back();
+                }
+                else
+                {
+                    m_freeList = m_nodes[handle].next;
+                }
+
+                Node &node = m_nodes[handle];
+                node.value = std::move(value);
+                node.tick = toTick(when);
+                node.isUsed = true;
+                link(handle);
+                ++m_size;
+                return handle;
+            }
+
+            /**
+             * @brief Removes a pending timer
+             * @return false if @p handle is not a pending timer
+             */
+            bool
+            cancel(Handle handle)
+            {
+                if (handle >= m_nodes.size() || !m_nodes[handle].isUsed)
+                {
+                    return false;
+                }
+                unlink(handle);
+                release(handle);
+                return true;
+            }
+
+            /**
+             * @brief Expires every timer up to @p until, calling @p onExpire(value) for each
+             *
+             * @p onExpire may insert and cancel timers.
+             * @return number of expired timers
+             */
+            template <typename F>
+            size_t
+            advance(time::steady_clock::TimePoint until, F &&onExpire)
+            {
+                uint64_t target = toTick(until);
+                size_t nExpired = expireSlot(DUE_SLOT, onExpire);
+
+                while (m_now < target)
+                {
+                    if (m_size == 0)
+                    {
+                        m_now = target;
+                        break;
+                    }
+
+                    ++m_now;
+                    // entering a new slot of level k + 1 when slot 0 of level k comes around
+                    for (size_t level = 1; level < N_LEVELS; ++level)
+                    {
+                        if ((m_now & (getLevelSpan(level) - 1)) != 0)
+                        {
+                            break;
+                        }
+                        cascade(level, (m_now >> (SLOT_BITS * level)) & (N_SLOTS - 1));
+                    }
+                    nExpired += expireSlot(m_now & (N_SLOTS - 1), onExpire);
+                    nExpired += expireSlot(DUE_SLOT, onExpire);
+                }
+                return nExpired;
+            }
+
+            /**
+             * @brief Returns the earliest time at which advance() may expire a timer
+             *
+             * The time is exact when a timer is due within the current level-0 rotation, otherwise it
+             * is the next cascade, after which it should be asked again.
+             * @pre !empty()
+             */
+            time::steady_clock::TimePoint
+            getNextExpiry() const
+            {
+                BOOST_ASSERT(!empty());
+                if (m_heads[DUE_SLOT] != INVALID_HANDLE)
+                {
+                    return toTime(m_now);
+                }
+
+                // level-0 timers are less than N_SLOTS ticks away, so the first occupied slot after
+                // the current one, in rotation order, holds the next of them
+                uint64_t next = std::numeric_limits<uint64_t>::max();
+                size_t current = m_now & (N_SLOTS - 1);
+                for (size_t i = 0; i <= N_WORDS; ++i)
+                {
+                    size_t word = (current / 64 + i) % N_WORDS;
+                    uint64_t bits = m_occupied[0][word];
+                    if (i == 0)
+                    {
+                        bits &= ~uint64_t(0) << (current % 64) << 1;
+                    }
+                    else if (i == N_WORDS)
+                    {
+                        bits &= (uint64_t(1) << (current % 64)) - 1;
+                    }
+                    if (bits != 0)
+                    {
+                        size_t slot = word * 64 + __builtin_ctzll(bits);
+                        next = m_now + ((slot - current) & (N_SLOTS - 1));
+                        break;
+                    }
+                }
+
+                // higher-level timers cascade no earlier than the next level-0 rotation
+                if (m_size > m_nLevel0)
+                {
+                    next = std::min<uint64_t>(next, (m_now | (N_SLOTS - 1)) + 1);
+                }
+                return toTime(next);
+            }
+
+        private:
+            static constexpr size_t DUE_SLOT = N_LEVELS * N_SLOTS; ///< \brief timers at or before m_now
+            static constexpr size_t N_WORDS = N_SLOTS / 64;        ///< \brief occupancy words per level
+
+            struct Node
+            {
+                T value{};
+                uint64_t tick = 0;
+                Handle prev = INVALID_HANDLE;
+                Handle next = INVALID_HANDLE;
+                uint32_t slot = 0;
+                bool isUsed = false;
+            };
+
+            static constexpr uint64_t
+            getLevelSpan(size_t level)
+            {
+                return uint64_t(1) << (SLOT_BITS * level);
+            }
+
+            uint64_t
+            toTick(time::steady_clock::TimePoint when) const
+            {
+                if (when <= m_origin)
+                {
+                    return 0;
+                }
+                return static_cast<uint64_t>((when - m_origin) / m_tick);
+            }
+
+            time::steady_clock::TimePoint
+            toTime(uint64_t tick) const
+            {
+                return m_origin + m_tick * static_cast<int64_t>(tick);
+            }
+
+            void
+            link(Handle handle)
+            {
+                Node &node = m_nodes[handle];
+                size_t slot = DUE_SLOT;
+                if (node.tick > m_now)
+                {
+                    uint64_t delta = node.tick - m_now;
+                    size_t level = 0;
+                    while (level < N_LEVELS - 1 && delta >= getLevelSpan(level + 1))
+                    {
+                        ++level;
+                    }
+                    // beyond the span of the wheel, the timer is moved again when its slot cascades
+                    uint64_t tick = delta < getLevelSpan(N_LEVELS) ? node.tick : m_now + getLevelSpan(N_LEVELS) - 1;
+                    slot = level * N_SLOTS + ((tick >> (SLOT_BITS * level)) & (N_SLOTS - 1));
+                    if (level == 0)
+                    {
+                        ++m_nLevel0;
+                    }
+                    m_occupied[level][(slot % N_SLOTS) / 64] |= uint64_t(1) << (slot % 64);
+                }
+
+                node.slot = static_cast<uint32_t>(slot);
+                node.prev = INVALID_HANDLE;
+                node.next = m_heads[slot];
+                if (node.next != INVALID_HANDLE)
+                {
+                    m_nodes[node.next].prev = handle;
+                }
+                m_heads[slot] = handle;
+            }
+
+            void
+            unlink(Handle handle)
+            {
+                Node &node = m_nodes[handle];
+                if (node.prev != INVALID_HANDLE)
+                {
+                    m_nodes[node.prev].next = node.next;
+                }
+                else
+                {
+                    m_heads[node.slot] = node.next;
+                }
+                if (node.next != INVALID_HANDLE)
+                {
+                    m_nodes[node.next].prev = node.prev;
+                }
+
+                if (node.slot != DUE_SLOT)
+                {
+                    size_t level = node.slot / N_SLOTS;
+                    if (level == 0)
+                    {
+                        --m_nLevel0;
+                    }
+                    if (m_heads[node.slot] == INVALID_HANDLE)
+                    {
+                        m_occupied[level][(node.slot % N_SLOTS) / 64] &= ~(uint64_t(1) << (node.slot % 64));
+                    }
+                }
+            }
+
+            void
+            release(Handle handle)
+            {
+                Node &node = m_nodes[handle];
+                node.value = T{};
+                node.isUsed = false;
+                node.next = m_freeList;
+                m_freeList = handle;
+                --m_size;
+            }
+
+            void
+            cascade(size_t level, size_t index)
+            {
+                size_t slot = level * N_SLOTS + index;
+                Handle handle = m_heads[slot];
+                m_heads[slot] = INVALID_HANDLE;
+                m_occupied[level][index / 64] &= ~(uint64_t(1) << (index % 64));
+                while (handle != INVALID_HANDLE)
+                {
+                    Handle next = m_nodes[handle].next;
+                    link(handle);
+                    handle = next;
+                }
+            }
+
+            template <typename F>
+            size_t
+            expireSlot(size_t slot, F &onExpire)
+            {
+                size_t nExpired = 0;
+                Handle handle;
+                while ((handle = m_heads[slot]) != INVALID_HANDLE)
+                {
+                    unlink(handle);
+                    T value = std::move(m_nodes[handle].value);
+                    release(handle);
+                    ++nExpired;
+                    onExpire(value);
+                }
+                return nExpired;
+            }
+
+        private:
+            time::nanoseconds m_tick;
+            time::steady_clock::TimePoint m_origin;
+            uint64_t m_now; ///< \brief current tick, every timer up to it has expired
+
+            std::vector<Node> m_nodes;
+            Handle m_freeList;
+            std::array<Handle, N_LEVELS * N_SLOTS + 1> m_heads;
+            std::array<std::array<uint64_t, N_WORDS>, N_LEVELS> m_occupied; ///< \brief non-empty slots
+            size_t m_size;
+            size_t m_nLevel0 = 0; ///< \brief timers in level-0 slots
+        };
+
+        template <typename T>
+        constexpr typename TimerWheel<T>::Handle TimerWheel<T>::INVALID_HANDLE;
+        template <typename T>
+        constexpr unsigned TimerWheel<T>::SLOT_BITS;
+        template <typename T>
+        constexpr size_t TimerWheel<T>::N_SLOTS;
+        template <typename T>
+        constexpr size_t TimerWheel<T>::N_LEVELS;
+        template <typename T>
+        constexpr size_t TimerWheel<T>::DUE_SLOT;
+        template <typename T>
+        constexpr size_t TimerWheel<T>::N_WORDS;
+    }
+}
+
+#endif // CC_COMMON_TIMER_WHEEL_H
@@ -0,0 +1,82 @@
+#ifndef CC_COMMON_TLV_WRITER_H
+#define CC_COMMON_TLV_WRITER_H
+#include "core/common.hpp"
+
+namespace ndn
+{
+    namespace cc
+    {
+        /**
+         * @brief Writes @p number as a TLV VAR-NUMBER at @p pos
+         * @return the position following the number
+         */
+        inline uint8_t *
+        writeVarNumber(uint8_t *pos, uint64_t number)
+        {
+            if (number < 253)
+            {
+                *pos++ = static_cast<uint8_t>(number);
+            }
+            else if (number <= std::numeric_limits<uint16_t>::max())
+            {
+                *pos++ = 253;
+                *pos++ = static_cast<uint8_t>(number >> 8);
+                *pos++ = static_cast<uint8_t>(number);
+            }
+            else if (number <= std::numeric_limits<uint32_t>::max())
+            {
+                *pos++ = 254;
+                for (int shift = 24; shift >= 0; shift -= 8)
+                {
+                    *pos++ = static_cast<uint8_t>(number >> shift);
+                }
+            }
+            else
+            {
+                *pos++ = 255;
+                for (int shift = 56; shift >= 0; shift -= 8)
+                {
+                    *pos++ = static_cast<uint8_t>(number >> shift);
+                }
+            }
+            return pos;
+        }
+
+        /**
+         * @brief Returns the size of @p number encoded as a NonNegativeInteger (1, 2, 4 or 8 octets)
+         */
+        inline size_t
+        sizeOfNonNegativeInteger(uint64_t number)
+        {
+            if (number <= std::numeric_limits<uint8_t>::max())
+            {
+                return 1;
+            }
+            if (number <= std::numeric_limits<uint16_t>::max())
+            {
+                return 2;
+            }
+            if (number <= std::numeric_limits<uint32_t>::max())
+            {
+                return 4;
+            }
+            return 8;
+        }
+
+        /**
+         * @brief Writes @p number as a NonNegativeInteger of @p size octets at @p pos
+         * @return the position following the number
+         */
+        inline uint8_t *
+        writeNonNegativeInteger(uint8_t *pos, uint64_t number, size_t size)
+        {
+            for (int shift = static_cast<int>(size - 1) * 8; shift >= 0; shift -= 8)
+            {
+                *pos++ = static_cast<uint8_t>(number >> shift);
+            }
+            return pos;
+        }
+    }
+}
+
+#endif // CC_COMMON_TLV_WRITER_H
@@ -0,0 +1,325 @@
+#include "trace-writer.hpp"
+#include <atomic>
+#include <csignal>
+#include <cstring>
+
+namespace ndn
+{
+    namespace cc
+    {
+        static_assert(sizeof(TraceRecord) == 40, "TraceRecord must not contain padding");
+        static_assert(sizeof(TraceFileHeader) == 16, "TraceFileHeader must not contain padding");
+
+        constexpr uint16_t TraceFileHeader::VERSION;
+
+        static const char TRACE_MAGIC[4] = {'C', 'C', 'T', 'R'};
+
+        // how often the flusher looks for a termination signal
+        static const std::chrono::milliseconds SIGNAL_CHECK_INTERVAL(50);
+
+        static_assert(ATOMIC_INT_LOCK_FREE == 2, "the signal handler requires a lock-free int");
+
+        // termination signal caught while the flusher runs, 0 if none
+        static std::atomic<int> g_pendingSignal(0);
+
+        static void
+        onTerminationSignal(int signo)
+        {
+            // the flusher writes the records and raises the signal again, a handler may not lock
+            g_pendingSignal = signo;
+        }
+
+        void TraceRecord::setDouble(size_t i, double value)
+        {
+            std::memcpy(&values[i], &value, sizeof(value));
+        }
+
+        double TraceRecord::getDouble(size_t i) const
+        {
+            double value;
+            std::memcpy(&value, &values[i], sizeof(value));
+            return value;
+        }
+
+        TraceWriter::~TraceWriter()
+        {
+            close();
+        }
+
+        void TraceWriter::open(const std::string &path, size_t bufferSize, time::milliseconds flushInterval)
+        {
+            close();
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            std::FILE *file = std::fopen(path.data(), "wb");
+            if (file == nullptr)
+            {
+                NDN_THROW(std::runtime_error("Cannot open trace file " + path));
+            }
+
+            TraceFileHeader header{};
+            std::memcpy(header.magic, TRACE_MAGIC, sizeof(header.magic));
+            header.version = TraceFileHeader::VERSION;
+            header.recordSize = sizeof(TraceRecord);
+            if (std::fwrite(&header, sizeof(header), 1, file) != 1 || std::fflush(file) != 0)
+            {
+                std::fclose(file);
+                NDN_THROW(std::runtime_error("Cannot write trace file " + path));
+            }
+
+            m_file = file;
+            m_buffer.resize(std::max<size_t>(bufferSize, 1));
+            m_nBuffered = 0;
+            m_start = time::steady_clock::now();
+            m_lastFlush = 0;
+            m_flushInterval = time::duration_cast<time::nanoseconds>(flushInterval).count();
+            m_nRecords = 0;
+        }
+
+        void TraceWriter::close()
+        {
+            stopFlusher();
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (m_file == nullptr)
+                {
+                    return;
+                }
+                writeBuffered();
+                std::fclose(m_file);
+                m_file = nullptr;
+            }
+
+            // a signal caught while the flusher was stopping terminates the process now
+            int signo = g_pendingSignal.exchange(0);
+            if (signo != 0)
+            {
+                std::raise(signo);
+            }
+        }
+
+        void TraceWriter::restartClock()
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            writeBuffered();
+            m_start = time::steady_clock::now();
+            m_lastFlush = 0;
+        }
+
+        void TraceWriter::append(TraceRecord::Type type, time::steady_clock::TimePoint now,
+                                 int64_t value0, int64_t value1, int64_t value2, uint32_t flow)
+        {
+            TraceRecord record{};
+            record.type = type;
+            record.flow = flow;
+            record.timestamp = getElapsed(now);
+            record.values[0] = value0;
+            record.values[1] = value1;
+            record.values[2] = value2;
+            append(record);
+        }
+
+        void TraceWriter::append(const TraceRecord &record)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_file == nullptr)
+            {
+                return;
+            }
+
+            m_buffer[m_nBuffered++] = record;
+            ++m_nRecords;
+            if (m_nBuffered == m_buffer.size() || record.timestamp - m_lastFlush >= m_flushInterval)
+            {
+                m_lastFlush = record.timestamp;
+                writeBuffered();
+            }
+        }
+
+        void TraceWriter::flush()
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            writeBuffered();
+        }
+
+        void TraceWriter::flushInBackground()
+        {
+            if (m_flusher.joinable())
+            {
+                return;
+            }
+            m_isFlushing = true;
+            m_flusher = std::thread([this]
+                                    { runFlusher(); });
+            std::signal(SIGINT, &onTerminationSignal);
+            std::signal(SIGTERM, &onTerminationSignal);
+        }
+
+        void TraceWriter::stopFlusher()
+        {
+            if (!m_flusher.joinable())
+            {
+                return;
+            }
+            std::signal(SIGINT, SIG_DFL);
+            std::signal(SIGTERM, SIG_DFL);
+
+            {
+                std::lock_guard<std::mutex> lock(m_flusherMutex);
+                m_isFlushing = false;
+            }
+            m_flusherCv.notify_all();
+            m_flusher.join();
+        }
+
+        void TraceWriter::runFlusher()
+        {
+            const std::chrono::nanoseconds interval(m_flushInterval);
+            auto lastFlush = std::chrono::steady_clock::now();
+            std::unique_lock<std::mutex> lock(m_flusherMutex);
+            while (m_isFlushing)
+            {
+                m_flusherCv.wait_for(lock, SIGNAL_CHECK_INTERVAL, [this]
+                                     { return !m_isFlushing; });
+
+                int signo = g_pendingSignal.exchange(0);
+                if (signo != 0)
+                {
+                    flush();
+                    std::signal(signo, SIG_DFL);
+                    std::raise(signo);
+                }
+
+                // the wall clock, as the trace clock may be simulated
+                auto now = std::chrono::steady_clock::now();
+                if (now - lastFlush >= interval)
+                {
+                    flush();
+                    lastFlush = now;
+                }
+            }
+        }
+
+        void TraceWriter::writeBuffered()
+        {
+            if (m_file == nullptr || m_nBuffered == 0)
+            {
+                return;
+            }
+            // a failed write only loses samples, the measurement goes on
+            std::fwrite(m_buffer.data(), sizeof(TraceRecord), m_nBuffered, m_file);
+            std::fflush(m_file);
+            m_nBuffered = 0;
+        }
+
+        TraceWriter &
+        getTraceWriter()
+        {
+            static TraceWriter writer;
+            return writer;
+        }
+
+        TraceReader::TraceReader(std::istream &is)
+            : m_is(is)
+        {
+            TraceFileHeader header;
+            if (!m_is.read(reinterpret_cast<char *>(&header), sizeof(header)) ||
+                std::memcmp(header.magic, TRACE_MAGIC, sizeof(header.magic)) != 0)
+            {
+                NDN_THROW(std::runtime_error("Not a cc trace file"));
+            }
+            if (header.version != TraceFileHeader::VERSION || header.recordSize != sizeof(TraceRecord))
+            {
+                NDN_THROW(std::runtime_error("Unsupported cc trace version " + std::to_string(header.version)));
+            }
+        }
+
+        bool TraceReader::read(TraceRecord &record)
+        {
+            m_is.read(reinterpret_cast<char *>(&record), sizeof(record));
+            if (m_is.gcount() == 0)
+            {
+                return false;
+            }
+            if (m_is.gcount() != sizeof(record))
+            {
+                NDN_THROW(std::runtime_error("Truncated cc trace record"));
+            }
+            return true;
+        }
+
+        void
+        printTraceHeader(std::ostream &os, TraceFormat format)
+        {
+            if (format == TraceFormat::CSV)
+            {
+                os << "type,timestamp,flow,value0,value1,value2\n";
+            }
+        }
+
+        static const char *
+        getTypeName(uint16_t type)
+        {
+            switch (type)
+            {
+            case TraceRecord::DELAY:
+                return "delay";
+            case TraceRecord::RATE:
+                return "rate";
+            case TraceRecord::WINDOW:
+                return "window";
+            case TraceRecord::TARGET_RATE:
+                return "target-rate";
+            case TraceRecord::MARKS:
+                return "marks";
+            }
+            return "unknown";
+        }
+
+        void
+        printTraceRecord(std::ostream &os, const TraceRecord &record, TraceFormat format)
+        {
+            const auto &v = record.values;
+            if (format == TraceFormat::CSV)
+            {
+                os << getTypeName(record.type) << "," << record.timestamp << "," << record.flow << ","
+                   << v[0] << "," << v[1] << ",";
+                if (record.type == TraceRecord::WINDOW || record.type == TraceRecord::MARKS)
+                {
+                    os << record.getDouble(2);
+                }
+                else
+                {
+                    os << v[2];
+                }
+                os << "\n";
+                return;
+            }
+
+            // the lines the consumers print without a binary trace
+            switch (record.type)
+            {
+            case TraceRecord::DELAY:
+                os << "cc:delay:<" << v[0] << "," << v[1] << "," << v[2] << ">\n";
+                break;
+            case TraceRecord::RATE:
+                os << "cc:rate:<" << v[0] << "," << v[1] << ">" << v[2] << "\n";
+                break;
+            case TraceRecord::WINDOW:
+                os << "cc:window:<" << record.timestamp << "," << v[0] << "," << record.getDouble(2) << ","
+                   << v[1] << ">\n";
+                break;
+            case TraceRecord::TARGET_RATE:
+                os << "cc:target-rate:<" << record.timestamp << "," << v[0] << "," << v[1] << "," << v[2] << ">\n";
+                break;
+            case TraceRecord::MARKS:
+                os << "cc:marks:<" << record.timestamp << "," << v[0] << "," << v[1] << "," << record.getDouble(2)
+                   << ">\n";
+                break;
+            default:
+                os << "cc:unknown:<" << record.type << ">\n";
+                break;
+            }
+        }
+    }
+}
@@ -0,0 +1,218 @@
+#ifndef CC_COMMON_TRACE_WRITER_H
+#define CC_COMMON_TRACE_WRITER_H
+#include "core/common.hpp"
+#include <condition_variable>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+
+namespace ndn
+{
+    namespace cc
+    {
+        /**
+         * @brief Fixed-size sample of a consumer trace
+         *
+         * The meaning of the values depends on the type:
+         *  - DELAY: elapsed time printed by the consumer (ns), sequence number, RTT (ns)
+         *  - RATE: report index, bytes received, Interests sent during the report interval
+         *  - WINDOW: sequence number, Interests in flight, congestion window (a double)
+         *  - TARGET_RATE: sequence number, TargetRate of the Data, send rate after the update
+         *  - MARKS: Data received in a round trip, congestion-marked Data among them, marked
+         *           fraction estimate (DCTCP alpha) after the round (a double)
+         */
+        struct TraceRecord
+        {
+            enum Type : uint16_t
+            {
+                DELAY = 1,
+                RATE = 2,
+                WINDOW = 3,
+                TARGET_RATE = 4,
+                MARKS = 5
+            };
+
+            uint16_t type;
+            uint16_t reserved;
+            uint32_t flow;      //!< consumer within the process (0 for single-flow tools)
+            int64_t timestamp;  //!< nanoseconds since the trace was opened
+            int64_t values[3];
+
+            /**
+             * @brief Stores a double in values[@p i]
+             */
+            void
+            setDouble(size_t i, double value);
+
+            double
+            getDouble(size_t i) const;
+        };
+
+        /**
+         * @brief Header at the start of a trace file
+         *
+         * Integers of the header and of the records are in host byte order.
+         */
+        struct TraceFileHeader
+        {
+            static constexpr uint16_t VERSION = 1;
+
+            char magic[4];       //!< "CCTR"
+            uint16_t version;
+            uint16_t recordSize; //!< sizeof(TraceRecord)
+            uint64_t reserved;
+        };
+
+        enum class TraceFormat
+        {
+            TEXT, //!< the cc:delay:<...> lines the consumers print
+            CSV   //!< one row per record, with a header row
+        };
+
+        /**
+         * @brief Writes trace records into a binary file
+         *
+         * Records are buffered and written when the buffer is full, when the flush interval has
+         * elapsed since the last write (checked on append, against the record timestamp), and on
+         * close, so that recording a sample costs a copy into memory rather than formatting and
+         * flushing a line. Consumers on several threads may share the writer; appends are
+         * serialized by a lock that is uncontended in the single-threaded tools.
+         *
+         * A tool that may be interrupted also starts flushInBackground(), as appends stop with the
+         * consumers and the close on exit is skipped when a signal terminates the process.
+         */
+        class TraceWriter : noncopyable
+        {
+        public:
+            TraceWriter() = default;
+
+            ~TraceWriter();
+
+            /**
+             * @brief Opens (truncates) the trace file and starts the trace clock
+             * @throw std::runtime_error the file cannot be opened
+             */
+            void
+            open(const std::string &path, size_t bufferSize = 16384, time::milliseconds flushInterval = 1_s);
+
+            void
+            close();
+
+            /**
+             * @brief Restarts the trace clock, e.g. after switching to simulated time
+             */
+            void
+            restartClock();
+
+            bool
+            isEnabled() const
+            {
+                return m_file != nullptr;
+            }
+
+            /**
+             * @brief Records a sample of consumer @p flow taken at @p now
+             */
+            void
+            append(TraceRecord::Type type, time::steady_clock::TimePoint now,
+                   int64_t value0, int64_t value1, int64_t value2, uint32_t flow = 0);
+
+            void
+            append(const TraceRecord &record);
+
+            /**
+             * @brief Returns the timestamp of a record taken at @p now
+             */
+            int64_t
+            getElapsed(time::steady_clock::TimePoint now) const
+            {
+                return time::duration_cast<time::nanoseconds>(now - m_start).count();
+            }
+
+            /**
+             * @brief Writes the buffered records
+             */
+            void
+            flush();
+
+            /**
+             * @brief Starts a thread writing the buffered records every flush interval, and on
+             *        SIGINT or SIGTERM before letting the signal terminate the process
+             *
+             * The thread stops on close(), which restores the default signal handlers.
+             */
+            void
+            flushInBackground();
+
+            uint64_t
+            getNRecords() const
+            {
+                return m_nRecords;
+            }
+
+        private:
+            void
+            writeBuffered();
+
+            void
+            stopFlusher();
+
+            void
+            runFlusher();
+
+        private:
+            std::mutex m_mutex;
+            std::FILE *m_file = nullptr;
+            std::vector<TraceRecord> m_buffer;
+            size_t m_nBuffered = 0;
+            time::steady_clock::TimePoint m_start;
+            int64_t m_lastFlush = 0;
+            int64_t m_flushInterval = 0;
+            uint64_t m_nRecords = 0;
+
+            std::thread m_flusher;
+            std::mutex m_flusherMutex;
+            std::condition_variable m_flusherCv; ///< \brief wakes the flusher up early on close()
+            bool m_isFlushing = false;
+        };
+
+        /**
+         * @brief Returns the process-wide trace writer, disabled until opened
+         */
+        TraceWriter &
+        getTraceWriter();
+
+        /**
+         * @brief Reads the records of a trace file
+         */
+        class TraceReader : noncopyable
+        {
+        public:
+            /**
+             * @throw std::runtime_error @p is does not start with a valid trace header
+             */
+            explicit TraceReader(std::istream &is);
+
+            /**
+             * @return false at the end of the trace
+             * @throw std::runtime_error the trace ends with a truncated record
+             */
+            bool
+            read(TraceRecord &record);
+
+        private:
+            std::istream &m_is;
+        };
+
+        /**
+         * @brief Prints the header row of @p format, if it has one
+         */
+        void
+        printTraceHeader(std::ostream &os, TraceFormat format);
+
+        void
+        printTraceRecord(std::ostream &os, const TraceRecord &record, TraceFormat format);
+    }
+}
+
+#endif // CC_COMMON_TRACE_WRITER_H
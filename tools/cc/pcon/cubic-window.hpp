@@ -0,0 +1,99 @@
+#ifndef CC_PCON_CUBIC_WINDOW_H
+#define CC_PCON_CUBIC_WINDOW_H
+#include "core/common.hpp"
+
+#include <cmath>
+
+namespace ndn
+{
+    namespace cc
+    {
+        namespace client
+        {
+            /**
+             * @brief Window growth function of TCP CUBIC, ported from RFC 8312
+             *
+             * W_max and K only change on a congestion event, so they are computed there; the
+             * target window of a Data is then three multiplies on the time since the epoch, the
+             * instant t = K at which the window is back to W_max.
+             */
+            class CubicWindow
+            {
+            public:
+                static constexpr double C = 0.4;
+
+                CubicWindow(double beta, bool useFastConvergence, time::steady_clock::TimePoint now)
+                    : m_beta(beta),
+                      m_useFastConvergence(useFastConvergence),
+                      m_wMax(0),
+                      m_lastWmax(0),
+                      m_epoch(now)
+                {
+                }
+
+                /**
+                 * @brief Starts a new epoch on a congestion event at @p window
+                 * @return the reduced window, W_max * beta without fast convergence
+                 */
+                double
+                onCongestion(double window, time::steady_clock::TimePoint now)
+                {
+                    // A flow remembers the last value of W_max,
+                    // before it updates W_max for the current congestion event.
+                    if (m_useFastConvergence && window < m_lastWmax * (1 - FAST_CONV_DIFF / 100))
+                    {
+                        m_wMax = window * (1.0 + m_beta) / 2.0;
+                    }
+                    else
+                    {
+                        m_wMax = window;
+                    }
+                    m_lastWmax = window;
+
+                    // K = cubic_root(W_max*(1-beta_cubic)/C) (Eq. 2)
+                    const double k = std::cbrt(m_wMax * (1 - m_beta) / C);
+                    m_epoch = now + time::duration_cast<time::nanoseconds>(time::duration<double>(k));
+                    return window * m_beta;
+                }
+
+                /**
+                 * @brief Starts an epoch at @p window when slow start ends without a congestion
+                 *        event, so that the window grows from there along the plateau (K = 0)
+                 */
+                void
+                startEpoch(double window, time::steady_clock::TimePoint now)
+                {
+                    m_wMax = window;
+                    m_epoch = now;
+                }
+
+                /**
+                 * @brief Returns the target W_cubic(t) = C*(t-K)^3 + W_max (Eq. 1) at @p now
+                 */
+                double
+                getTarget(time::steady_clock::TimePoint now) const
+                {
+                    const double d = time::duration_cast<time::nanoseconds>(now - m_epoch).count() * 1e-9;
+                    return C * d * d * d + m_wMax;
+                }
+
+                double
+                getWmax() const
+                {
+                    return m_wMax;
+                }
+
+            private:
+                static constexpr double FAST_CONV_DIFF = 1.0; // In percent
+
+                double m_beta;
+                bool m_useFastConvergence;
+                double m_wMax;
+                double m_lastWmax;
+                time::steady_clock::TimePoint m_epoch; ///< \brief time of t = K in the current epoch
+            };
+        }
+    }
+}
+
+#endif // CC_PCON_CUBIC_WINDOW_H
@@ -16,11 +16,18 @@ namespace ndn
                   m_ssthresh(std::numeric_limits<double>::max()),
                   m_highData(0),
                   m_recPoint(0.0),
-                  m_useCubicFastConv(options.useCubicFastConv),
+                  // BIC leaves its TCP slow start at BIC_LOW_WINDOW, before HyStart would act
+                  m_useHyStart(options.useHyStart && options.ccAlgorithm != CcAlgorithm::BIC),
+                  m_hyStart(HyStart::Options()),
+                  m_dctcpG(options.dctcpG),
+                  // as RFC 8257 recommends, the first marks halve the window
+                  m_dctcpAlpha(1.0),
+                  // the first round trip ends with the Data of the first Interest
+                  m_dctcpRoundEnd(options.startSeq),
+                  m_dctcpNData(0),
+                  m_dctcpNMarked(0),
                   m_cubicBeta(options.cubicBeta),
-                  m_cubicWmax(0),
-                  m_cubicLastWmax(0),
-                  m_cubicLastDecrease(time::steady_clock::now()),
+                  m_cubic(options.cubicBeta, options.useCubicFastConv, time::steady_clock::now()),
                   m_bicMinWin(0),
                   m_bicMaxWin(std::numeric_limits<double>::max()),
                   m_bicTargetWin(0),
@@ -30,21 +37,22 @@ namespace ndn
             {
             }
 
-            void PconConsumer::onTimeout(uint32_t seq)
+            void PconConsumer::onTimeout(uint64_t seq)
             {
-                WindowDecrease();
+                WindowDecrease(time::steady_clock::now(), false);
 
                 if (m_inFlight > static_cast<uint32_t>(0))
                 {
                     m_inFlight--;
                 }
+                traceWindow(seq);
 
-                Consumer::onTimeout(seq);
+                Engine::onTimeout(seq);
             }
 
-            void PconConsumer::onData(const Data &data, uint32_t seq, const time::steady_clock::TimePoint &sendTime)
+            void PconConsumer::onData(const Data &data, uint64_t seq, const SendInfo &info)
             {
-                Consumer::onData(data, seq, sendTime);
+                Engine::onData(data, seq, info);
 
                 // Set highest received Data to sequence number
                 if (m_highData < seq)
@@ -52,30 +60,47 @@ namespace ndn
                     m_highData = seq;
                 }
 
-                if (data.getCongestionMark() > 0)
+                bool isMarked = data.getCongestionMark() > 0;
+                if (m_ccAlgorithm == CcAlgorithm::DCTCP)
                 {
-                    std::cout << "Congestion Mark received: " << seq << std::endl;
-                    if (m_reactToCongestionMarks)
+                    updateMarkedFraction(seq, isMarked, m_dataTime);
+                }
+
+                if (isMarked)
+                {
+                    // DCTCP expects marks on every round trip, and traces them instead
+                    if (m_ccAlgorithm != CcAlgorithm::DCTCP)
                     {
-                        WindowDecrease();
+                        std::cout << "Congestion Mark received: " << seq << std::endl;
+                    }
+                    if (m_reactToCongestionMarks || m_ccAlgorithm == CcAlgorithm::DCTCP)
+                    {
+                        WindowDecrease(m_dataTime, true);
                     }
                 }
                 else
                 {
-                    WindowIncrease();
+                    // HyStart samples the RTT of Interests sent once, in slow start
+                    if (m_useHyStart && m_window < m_ssthresh && !info.isRetx &&
+                        m_hyStart.onData(m_dataTime, seq, m_nextSeq - 1, m_dataTime - info.sendTime, m_window))
+                    {
+                        exitSlowStart(m_dataTime);
+                    }
+                    WindowIncrease(m_dataTime);
                 }
 
                 if (m_inFlight > static_cast<uint32_t>(0))
                 {
                     m_inFlight--;
                 }
+                traceWindow(seq);
 
                 scheduleNextPacket();
             }
 
-            void PconConsumer::WindowIncrease()
+            void PconConsumer::WindowIncrease(time::steady_clock::TimePoint now)
             {
-                if (m_ccAlgorithm == CcAlgorithm::AIMD)
+                if (m_ccAlgorithm == CcAlgorithm::AIMD || m_ccAlgorithm == CcAlgorithm::DCTCP)
                 {
                     if (m_window < m_ssthresh)
                     {
@@ -88,7 +113,7 @@ namespace ndn
                 }
                 else if (m_ccAlgorithm == CcAlgorithm::CUBIC)
                 {
-                    CubicIncrease();
+                    CubicIncrease(now);
                 }
                 else if (m_ccAlgorithm == CcAlgorithm::BIC)
                 {
@@ -100,14 +125,26 @@ namespace ndn
                 }
             }
 
-            void PconConsumer::WindowDecrease()
+            void PconConsumer::WindowDecrease(time::steady_clock::TimePoint now, bool isCongestionMark)
             {
-                if (!m_useCwa || m_highData > m_recPoint)
+                // DCTCP reduces the window at most once per round trip, as the marked fraction
+                // it reduces by covers a whole round trip
+                bool isOncePerRtt = m_useCwa || m_ccAlgorithm == CcAlgorithm::DCTCP;
+                if (!isOncePerRtt || m_highData > m_recPoint)
                 {
                     const double diff = m_nextSeq - m_highData;
                     BOOST_ASSERT(diff > 0);
 
-                    m_recPoint = m_nextSeq + (m_addRttSuppress * diff);
+                    // DCTCP recovers after one round trip, the span of the marked fraction it
+                    // reduced by, while CWA suppresses further reductions for longer
+                    if (m_ccAlgorithm == CcAlgorithm::DCTCP)
+                    {
+                        m_recPoint = m_nextSeq;
+                    }
+                    else
+                    {
+                        m_recPoint = m_nextSeq + (m_addRttSuppress * diff);
+                    }
 
                     if (m_ccAlgorithm == CcAlgorithm::AIMD)
                     {
@@ -117,12 +154,18 @@ namespace ndn
                     }
                     else if (m_ccAlgorithm == CcAlgorithm::CUBIC)
                     {
-                        CubicDecrease();
+                        CubicDecrease(now);
                     }
                     else if (m_ccAlgorithm == CcAlgorithm::BIC)
                     {
                         BicDecrease();
                     }
+                    else if (m_ccAlgorithm == CcAlgorithm::DCTCP)
+                    {
+                        // marks by the fraction of marked Data (RFC 8257), timeouts like AIMD
+                        m_ssthresh = m_window * (isCongestionMark ? 1 - m_dctcpAlpha / 2 : m_beta);
+                        m_window = m_ssthresh;
+                    }
                     else
                     {
                         BOOST_ASSERT_MSG(false, "Unknown CC Algorithm");
@@ -133,7 +176,55 @@ namespace ndn
                     {
                         m_window = m_initialWindowSize;
                     }
+                    m_hyStart.reset();
+                }
+            }
+
+            void PconConsumer::exitSlowStart(time::steady_clock::TimePoint now)
+            {
+                if (m_options.printSamples)
+                {
+                    std::cout << "Slow start ended by " << m_hyStart.getLastExit() << ": window " << m_window << std::endl;
+                }
+                m_ssthresh = m_window;
+                if (m_ccAlgorithm == CcAlgorithm::CUBIC)
+                {
+                    m_cubic.startEpoch(m_window, now);
+                }
+            }
+
+            void PconConsumer::updateMarkedFraction(uint64_t seq, bool isMarked, time::steady_clock::TimePoint now)
+            {
+                ++m_dctcpNData;
+                if (isMarked)
+                {
+                    ++m_dctcpNMarked;
+                }
+                if (seq < m_dctcpRoundEnd)
+                {
+                    return;
                 }
+
+                // the Data of the first Interest sent after the round trip started ends it
+                const double fraction = static_cast<double>(m_dctcpNMarked) / m_dctcpNData;
+                m_dctcpAlpha = (1 - m_dctcpG) * m_dctcpAlpha + m_dctcpG * fraction;
+
+                TraceWriter &trace = getTraceWriter();
+                if (trace.isEnabled())
+                {
+                    TraceRecord record{};
+                    record.type = TraceRecord::MARKS;
+                    record.timestamp = trace.getElapsed(now);
+                    record.values[0] = m_dctcpNData;
+                    record.values[1] = m_dctcpNMarked;
+                    record.setDouble(2, m_dctcpAlpha);
+                    record.flow = m_options.flowId;
+                    trace.append(record);
+                }
+
+                m_dctcpRoundEnd = m_nextSeq;
+                m_dctcpNData = 0;
+                m_dctcpNMarked = 0;
             }
 
             void PconConsumer::BicIncrease()
@@ -215,72 +306,32 @@ namespace ndn
                 }
             }
 
-            void PconConsumer::CubicIncrease()
+            void PconConsumer::CubicIncrease(time::steady_clock::TimePoint now)
             {
-                // 1. Time since last congestion event in Seconds
-                const double t = time::duration_cast<time::microseconds>(
-                                     time::steady_clock::now() - m_cubicLastDecrease)
-                                     .count() /
-                                 1e6;
-
-                // 2. Time it takes to increase the window to cubic_wmax
-                // K = cubic_root(W_max*(1-beta_cubic)/C) (Eq. 2)
-                const double k = std::cbrt(m_cubicWmax * (1 - m_cubicBeta) / CUBIC_C);
-
-                // 3. Target: W_cubic(t) = C*(t-K)^3 + W_max (Eq. 1)
-                const double w_cubic = CUBIC_C * std::pow(t - k, 3) + m_cubicWmax;
-
-                // 4. Estimate of Reno Increase (Currently Disabled)
-                //  const double rtt = m_rtt->GetCurrentEstimate().GetSeconds();
-                //  const double w_est = m_cubic_wmax*m_beta + (3*(1-m_beta)/(1+m_beta)) * (t/rtt);
-                constexpr double w_est = 0.0;
-
-                // Actual adaptation
                 if (m_window < m_ssthresh)
                 {
                     m_window += 1.0;
+                    return;
                 }
-                else
-                {
-                    BOOST_ASSERT(m_cubicWmax > 0);
+                BOOST_ASSERT(m_cubic.getWmax() > 0);
 
-                    double cubic_increment = std::max(w_cubic, w_est) - m_window;
-                    // Cubic increment must be positive:
-                    // Note: This change is not part of the RFC, but I added it to improve performance.
-                    if (cubic_increment < 0)
-                    {
-                        cubic_increment = 0.0;
-                    }
+                // Estimate of Reno Increase (Currently Disabled)
+                //  const double rtt = m_rtt->GetCurrentEstimate().GetSeconds();
+                //  const double w_est = m_cubic_wmax*m_beta + (3*(1-m_beta)/(1+m_beta)) * (t/rtt);
+                const double cubic_increment = m_cubic.getTarget(now) - m_window;
+                // Cubic increment must be positive:
+                // Note: This change is not part of the RFC, but I added it to improve performance.
+                if (cubic_increment > 0)
+                {
                     m_window += cubic_increment / m_window;
                 }
             }
 
-            void PconConsumer::CubicDecrease()
+            void PconConsumer::CubicDecrease(time::steady_clock::TimePoint now)
             {
-                // This implementation is ported from https://datatracker.ietf.org/doc/rfc8312/
-                const double FAST_CONV_DIFF = 1.0; // In percent
-
-                // A flow remembers the last value of W_max,
-                // before it updates W_max for the current congestion event.
-
-                // Current w_max < last_wmax
-                if (m_useCubicFastConv && m_window < m_cubicLastWmax * (1 - FAST_CONV_DIFF / 100))
-                {
-                    m_cubicLastWmax = m_window;
-                    m_cubicWmax = m_window * (1.0 + m_cubicBeta) / 2.0;
-                }
-                else
-                {
-                    // Save old cwnd as w_max:
-                    m_cubicLastWmax = m_window;
-                    m_cubicWmax = m_window;
-                }
-
-                m_ssthresh = m_window * m_cubicBeta;
+                m_ssthresh = m_cubic.onCongestion(m_window, now);
                 m_ssthresh = std::max<double>(m_ssthresh, m_initialWindowSize);
                 m_window = m_ssthresh;
-
-                m_cubicLastDecrease = time::steady_clock::now();
             }
 
         }
@@ -1,32 +1,57 @@
+#ifndef CC_PCON_PCON_CONSUMER_H
+#define CC_PCON_PCON_CONSUMER_H
+#include "cubic-window.hpp"
 #include "window-consumer.hpp"
 
+#include "core/hystart.hpp"
+
 namespace ndn
 {
     namespace cc
     {
         namespace client
         {
-            class PconConsumer : public WindowConsumer
+            class PconConsumer : public WindowConsumer<PconConsumer>
             {
             public:
                 explicit PconConsumer(Face &face, const Options &options);
 
-                virtual void onData(const Data &data, uint32_t seq, const time::steady_clock::TimePoint &sendTime);
+                void onData(const Data &data, uint64_t seq, const SendInfo &info);
 
-                virtual void onTimeout(uint32_t seq);
+                void onTimeout(uint64_t seq);
 
             private:
+                /**
+                 * @param now arrival time of the Data
+                 */
+                void
+                WindowIncrease(time::steady_clock::TimePoint now);
+
+                /**
+                 * @param now time of the congestion event
+                 * @param isCongestionMark the event is a congestion mark rather than a timeout
+                 */
+                void
+                WindowDecrease(time::steady_clock::TimePoint now, bool isCongestionMark);
+
+                /**
+                 * @brief Ends slow start at the current window, on a HyStart detection
+                 */
                 void
-                WindowIncrease();
+                exitSlowStart(time::steady_clock::TimePoint now);
 
+                /**
+                 * @brief Counts a Data in the marked fraction of the current round trip, and
+                 *        updates the DCTCP alpha when the round trip ends
+                 */
                 void
-                WindowDecrease();
+                updateMarkedFraction(uint64_t seq, bool isMarked, time::steady_clock::TimePoint now);
 
                 void
-                CubicIncrease();
+                CubicIncrease(time::steady_clock::TimePoint now);
 
                 void
-                CubicDecrease();
+                CubicDecrease(time::steady_clock::TimePoint now);
 
                 void
                 BicIncrease();
@@ -42,17 +67,22 @@ namespace ndn
                 bool m_useCwa;
 
                 double m_ssthresh;
-                uint32_t m_highData;
+                uint64_t m_highData;
                 double m_recPoint;
 
+                bool m_useHyStart;
+                HyStart m_hyStart;
+
+                // DCTCP Parameters //
+                double m_dctcpG;
+                double m_dctcpAlpha;      //!< moving average of the fraction of marked Data
+                uint64_t m_dctcpRoundEnd; //!< first sequence number requested in the round trip, whose Data ends it
+                uint64_t m_dctcpNData;    //!< Data received in the current round trip
+                uint64_t m_dctcpNMarked;  //!< marked Data among them
+
                 // TCP CUBIC Parameters //
-                static constexpr double CUBIC_C = 0.4;
-                bool m_useCubicFastConv;
                 double m_cubicBeta;
-
-                double m_cubicWmax;
-                double m_cubicLastWmax;
-                time::steady_clock::TimePoint m_cubicLastDecrease;
+                CubicWindow m_cubic;
 
                 // TCP BIC Parameters //
                 //! Regular TCP behavior (including slow start) until this window size
@@ -71,4 +101,6 @@ namespace ndn
             };
         }
     }
-}
\ No newline at end of file
+}
+
+#endif // CC_PCON_PCON_CONSUMER_H
@@ -1,26 +1,219 @@
+#ifndef CC_PCON_WINDOW_CONSUMER_H
+#define CC_PCON_WINDOW_CONSUMER_H
 #include "ndn-consumer.hpp"
 
+#include <algorithm>
+#include <limits>
+
 namespace ndn
 {
     namespace cc
     {
         namespace client
         {
-            class WindowConsumer : public Consumer
+            /**
+             * @brief Window-based controller, growing the window by one per Data
+             *
+             * Free window credits are spent by a single send event, which expresses Interests
+             * back to back until the window is full, so that filling a window costs one trip
+             * through the io_service rather than one per Interest. With paceOverRtt, the event
+             * sends at most paceBurst Interests and comes back for the next burst after the same
+             * share of the smoothed RTT, so that a window is spread over one RTT.
+             *
+             * @tparam Derived the final consumer, which may redefine the hooks of ConsumerEngine
+             *                 to adapt the window differently
+             */
+            template <typename Derived>
+            class WindowConsumer : public ConsumerEngine<Derived>
             {
             public:
-                explicit WindowConsumer(Face &face, const Options &options);
+                using Engine = ConsumerEngine<Derived>;
+
+                WindowConsumer(Face &face, const Options &options)
+                    : Engine(face, options),
+                      m_window(options.initialWindowSize),
+                      m_inFlight(0),
+                      m_initialWindowSize(options.initialWindowSize),
+                      m_setInitialWindowOnTimeout(options.setInitialWindowOnTimeout),
+                      fixedRate(options.fixedRate),
+                      delayStart(options.delayStart),
+                      timingStop(options.timingStop),
+                      delayGreedy(options.delayGreedy),
+                      greedyRate(options.greedyRate),
+                      dsz(options.dsz),
+                      m_paceOverRtt(options.paceOverRtt),
+                      m_paceBurst(std::max<uint32_t>(options.paceBurst, 1)),
+                      m_isSendingWindow(false)
+                {
+                }
+
+                static Interest
+                makeInterestPrototype(const ConsumerOptions &options)
+                {
+                    Interest interest(options.prefix);
+                    interest.setCanBePrefix(false);
+                    interest.setMustBeFresh(true);
+                    interest.setServiceClass(5);
+                    interest.setInterestLifetime(options.lifetime);
+                    return interest;
+                }
+
+                void
+                onData(const Data &data, uint64_t seq, const SendInfo &info)
+                {
+                    Engine::onData(data, seq, info);
+                    m_window++;
+                    if (m_inFlight > static_cast<uint32_t>(0))
+                    {
+                        m_inFlight--;
+                    }
+                    traceWindow(seq);
+                    this->derived().scheduleNextPacket();
+                }
+
+                void
+                onTimeout(uint64_t seq)
+                {
+                    if (m_inFlight > static_cast<uint32_t>(0))
+                    {
+                        m_inFlight -= 1;
+                    }
+                    if (m_setInitialWindowOnTimeout)
+                    {
+                        m_window = m_initialWindowSize;
+                    }
+                    traceWindow(seq);
+                    Engine::onTimeout(seq);
+                }
 
-                virtual void onData(const Data &data, uint32_t seq, const time::steady_clock::TimePoint &sendTime);
+                void
+                willSendInterest(uint64_t seq)
+                {
+                    m_inFlight++;
+                    Engine::willSendInterest(seq);
+                }
 
-                virtual void onTimeout(uint32_t seq);
+                void
+                scheduleNextPacket()
+                {
+                    if (this->m_stopFlag)
+                    {
+                        return;
+                    }
+                    if (this->m_firstTime)
+                    {
+                        this->m_firstTime = false;
+                        if (this->timingStop > 0)
+                        {
+                            this->m_scheduler.schedule(time::milliseconds(this->timingStop), [this]
+                                                       { this->derived().stop(); });
+                        }
+                        if (this->delayGreedy > 0 && this->greedyRate > 0)
+                        {
+                            this->m_scheduler.schedule(time::milliseconds(this->delayGreedy), [this]
+                                                       { startGreedy(); });
+                        }
+                        this->m_nextInterestEvent = this->m_scheduler.schedule(time::milliseconds(this->delayStart), [this]
+                                                                               { sendWindow(); });
+                        return;
+                    }
 
-                virtual void willSendInterest(uint32_t seq);
+                    if (this->fixedRate > 0)
+                    {
+                        auto waitTime = (this->dsz * 1000000000) / this->fixedRate + 1;
+                        this->m_nextInterestEvent = this->m_scheduler.schedule(time::nanoseconds(waitTime), [this]
+                                                                               { this->sendPacket(); });
+                        return;
+                    }
+                    if (m_isSendingWindow)
+                    {
+                        // sendWindow() goes on with the next Interest itself
+                        return;
+                    }
+                    if (m_window == static_cast<uint32_t>(0))
+                    {
+                        this->m_nextInterestEvent.cancel();
+                        this->m_nextInterestEvent = this->m_scheduler.schedule(time::milliseconds(1000), [this]
+                                                                               { sendWindow(); });
+                    }
+                    else if (m_inFlight >= m_window)
+                    {
+                        // simply do nothing
+                    }
+                    else if (!this->m_nextInterestEvent)
+                    {
+                        this->m_nextInterestEvent = this->m_scheduler.schedule(time::nanoseconds(0), [this]
+                                                                               { sendWindow(); });
+                    }
+                }
 
             protected:
-                virtual void scheduleNextPacket();
+                /**
+                 * @brief Expresses Interests until the window is full, or a burst of them when pacing
+                 */
+                void
+                sendWindow()
+                {
+                    if (this->fixedRate > 0)
+                    {
+                        // the fixed rate times each Interest itself
+                        this->sendPacket();
+                        return;
+                    }
+                    uint32_t budget = m_paceOverRtt ? m_paceBurst : std::numeric_limits<uint32_t>::max();
+                    bool isExhausted = false;
+                    m_isSendingWindow = true;
+                    // at least one Interest, as after the 1 s wait of an empty window
+                    do
+                    {
+                        uint64_t nSent = this->m_nSent;
+                        this->sendPacket();
+                        isExhausted = this->m_nSent == nSent;
+                    } while (!isExhausted && --budget > 0 && !this->m_stopFlag && m_inFlight < m_window);
+                    m_isSendingWindow = false;
 
-                void startGreedy();
+                    // with no sequence number left, only a timeout (retransmission) calls for more
+                    if (isExhausted || this->m_stopFlag || m_inFlight >= m_window)
+                    {
+                        return;
+                    }
+                    time::nanoseconds delay(0);
+                    if (m_paceOverRtt)
+                    {
+                        // the share of the smoothed RTT of one burst
+                        delay = time::nanoseconds(static_cast<int64_t>(
+                            this->m_rtt.GetCurrentEstimate().count() * m_paceBurst / m_window));
+                    }
+                    this->m_nextInterestEvent = this->m_scheduler.schedule(delay, [this]
+                                                                           { sendWindow(); });
+                }
+
+                void
+                startGreedy()
+                {
+                    this->fixedRate = this->greedyRate;
+                }
+
+                /**
+                 * @brief Records the window after an update, if a binary trace is enabled
+                 */
+                void
+                traceWindow(uint64_t seq)
+                {
+                    TraceWriter &trace = getTraceWriter();
+                    if (!trace.isEnabled())
+                    {
+                        return;
+                    }
+                    TraceRecord record{};
+                    record.type = TraceRecord::WINDOW;
+                    record.timestamp = trace.getElapsed(time::steady_clock::now());
+                    record.values[0] = seq;
+                    record.values[1] = m_inFlight;
+                    record.setDouble(2, m_window);
+                    record.flow = this->m_options.flowId;
+                    trace.append(record);
+                }
 
             protected:
                 double m_window;
@@ -35,7 +228,13 @@ namespace ndn
                 int32_t delayGreedy;
                 int32_t greedyRate;
                 uint64_t dsz;
+
+                bool m_paceOverRtt;
+                uint32_t m_paceBurst;
+                bool m_isSendingWindow; ///< \brief sendWindow() is expressing Interests
             };
         }
     }
-}
\ No newline at end of file
+}
+
+#endif // CC_PCON_WINDOW_CONSUMER_H
@@ -0,0 +1,93 @@
+#include "admission-controller.hpp"
+#include <algorithm>
+
+namespace ndn
+{
+    namespace cc
+    {
+        namespace server
+        {
+            constexpr size_t AdmissionController::N_CLASSES;
+
+            TokenBucket::TokenBucket(double rate, double burst)
+                : m_rate(rate),
+                  m_burst(std::max(burst, 1.0)),
+                  m_tokens(m_burst)
+            {
+            }
+
+            bool TokenBucket::tryConsume(time::steady_clock::TimePoint now)
+            {
+                if (m_rate <= 0)
+                {
+                    return true;
+                }
+
+                if (now > m_lastRefill)
+                {
+                    double elapsed = time::duration_cast<time::nanoseconds>(now - m_lastRefill).count() / 1e9;
+                    m_tokens = std::min(m_burst, m_tokens + elapsed * m_rate);
+                    m_lastRefill = now;
+                }
+
+                if (m_tokens < 1.0)
+                {
+                    return false;
+                }
+                m_tokens -= 1.0;
+                return true;
+            }
+
+            AdmissionController::AdmissionController(double defaultRate, const std::map<int, double> &classRates,
+                                                     double burst)
+            {
+                for (const auto &classRate : classRates)
+                {
+                    if (classRate.first < 0 || static_cast<size_t>(classRate.first) >= N_CLASSES)
+                    {
+                        NDN_THROW(std::invalid_argument("ServiceClass " + to_string(classRate.first) +
+                                                        " is out of range"));
+                    }
+                }
+
+                m_buckets.reserve(N_CLASSES + 2);
+                for (int serviceClass = -1; serviceClass < static_cast<int>(N_CLASSES); ++serviceClass)
+                {
+                    auto it = classRates.find(serviceClass);
+                    m_buckets.emplace_back(it == classRates.end() ? defaultRate : it->second, burst);
+                }
+                m_buckets.emplace_back(defaultRate, burst);
+            }
+
+            bool AdmissionController::admit(int serviceClass, time::steady_clock::TimePoint now)
+            {
+                size_t index = 0;
+                if (serviceClass >= 0)
+                {
+                    index = std::min(static_cast<size_t>(serviceClass), N_CLASSES) + 1;
+                }
+                return m_buckets[index].tryConsume(now);
+            }
+
+            std::pair<int, double> AdmissionController::parseClassRate(const std::string &classRate)
+            {
+                auto pos = classRate.find('=');
+                if (pos == std::string::npos)
+                {
+                    NDN_THROW(std::invalid_argument("missing '='"));
+                }
+                int serviceClass = std::stoi(classRate.substr(0, pos));
+                if (serviceClass < 0 || static_cast<size_t>(serviceClass) >= N_CLASSES)
+                {
+                    NDN_THROW(std::invalid_argument("class must be between 0 and " + to_string(N_CLASSES - 1)));
+                }
+                double rate = std::stod(classRate.substr(pos + 1));
+                if (rate <= 0)
+                {
+                    NDN_THROW(std::invalid_argument("rate must be positive"));
+                }
+                return {serviceClass, rate};
+            }
+        }
+    }
+}
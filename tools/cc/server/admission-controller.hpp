@@ -0,0 +1,91 @@
+#ifndef CC_SERVER_ADMISSION_CONTROLLER_H
+#define CC_SERVER_ADMISSION_CONTROLLER_H
+#include "core/common.hpp"
+
+namespace ndn
+{
+    namespace cc
+    {
+        namespace server
+        {
+            /**
+             * @brief Token bucket refilled lazily on every request
+             */
+            class TokenBucket
+            {
+            public:
+                /**
+                 * @param rate refill rate, in tokens per second (0 == unlimited)
+                 * @param burst bucket depth, in tokens
+                 */
+                TokenBucket(double rate, double burst);
+
+                /**
+                 * @brief Takes one token if there is one
+                 */
+                bool
+                tryConsume(time::steady_clock::TimePoint now);
+
+                double
+                getRate() const
+                {
+                    return m_rate;
+                }
+
+            private:
+                double m_rate;
+                double m_burst;
+                double m_tokens;
+                time::steady_clock::TimePoint m_lastRefill;
+            };
+
+            /**
+             * @brief Admits Interests up to a configured rate per ServiceClass
+             *
+             * Every ServiceClass below N_CLASSES (and Interests without one) has its own token bucket,
+             * whose rate is either the class-specific rate or the default rate. Classes of N_CLASSES
+             * and above share one more bucket at the default rate. Interests beyond the rate are
+             * rejected, and the producer answers them with a Nack or a congestion-marked Data.
+             */
+            class AdmissionController : noncopyable
+            {
+            public:
+                enum Action
+                {
+                    NACK, //!< reject with a Congestion Nack
+                    MARK  //!< serve, but with a congestion mark
+                };
+
+                /**
+                 * @param defaultRate Interests per second admitted for classes not in @p classRates (0 == unlimited)
+                 * @param classRates Interests per second admitted for specific ServiceClasses
+                 * @param burst Interests admitted back to back after an idle period
+                 * @throw std::invalid_argument a class in @p classRates is outside [0, N_CLASSES)
+                 */
+                AdmissionController(double defaultRate, const std::map<int, double> &classRates, double burst);
+
+                /**
+                 * @brief Returns whether an Interest of @p serviceClass (-1 if absent) is within the rate
+                 */
+                bool
+                admit(int serviceClass, time::steady_clock::TimePoint now = time::steady_clock::now());
+
+                /**
+                 * @brief Parses a class admission rate given as CLASS=RATE
+                 * @throw std::invalid_argument malformed, CLASS outside [0, N_CLASSES) or RATE not positive
+                 */
+                static std::pair<int, double>
+                parseClassRate(const std::string &classRate);
+
+            public:
+                static constexpr size_t N_CLASSES = 256;
+
+            private:
+                /// \brief index 0 for Interests without ServiceClass, N_CLASSES + 1 for classes of N_CLASSES and above
+                std::vector<TokenBucket> m_buckets;
+            };
+        }
+    }
+}
+
+#endif // CC_SERVER_ADMISSION_CONTROLLER_H
@@ -0,0 +1,305 @@
+#include "batching-transport.hpp"
+
+#include <ndn-cxx/util/config-file.hpp>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <tuple>
+
+namespace ndn
+{
+    namespace cc
+    {
+        namespace server
+        {
+            BatchingTransport::BatchingTransport(const std::string &socketPath, const Options &options)
+                : m_socketPath(socketPath),
+                  m_options(options),
+                  m_nPendingBytes(0),
+                  m_isFlushScheduled(false),
+                  m_isWriting(false),
+                  m_inputBufferSize(0),
+                  m_isReadPending(false)
+            {
+                m_options.maxPackets = std::max<size_t>(m_options.maxPackets, 1);
+            }
+
+            BatchingTransport::~BatchingTransport()
+            {
+                close();
+            }
+
+            std::string BatchingTransport::getDefaultSocketPath()
+            {
+                std::string uri;
+                const char *env = std::getenv("NDN_CLIENT_TRANSPORT");
+                if (env != nullptr)
+                {
+                    uri = env;
+                }
+                else
+                {
+                    ConfigFile config;
+                    uri = config.getParsedConfiguration().get<std::string>("transport", "");
+                }
+
+                if (uri.empty())
+                {
+#ifdef __linux__
+                    return "/run/nfd.sock";
+#else
+                    return "/var/run/nfd.sock";
+#endif
+                }
+
+                const std::string scheme = "unix://";
+                if (uri.compare(0, scheme.size(), scheme) != 0)
+                {
+                    NDN_THROW(Error("Egress batching needs a Unix socket transport, not " + uri));
+                }
+                return uri.substr(scheme.size());
+            }
+
+            void BatchingTransport::connect(boost::asio::io_service &ioService, ReceiveCallback receiveCallback)
+            {
+                Transport::connect(ioService, std::move(receiveCallback));
+
+                m_socket = make_unique<boost::asio::local::stream_protocol::socket>(ioService);
+                m_flushTimer = make_unique<boost::asio::steady_timer>(ioService);
+
+                // the forwarder is local, so there is little point in connecting asynchronously
+                boost::system::error_code error;
+                m_socket->connect(boost::asio::local::stream_protocol::endpoint(m_socketPath), error);
+                if (error)
+                {
+                    m_socket.reset();
+                    NDN_THROW(Error(error, "Cannot connect to " + m_socketPath));
+                }
+                m_isConnected = true;
+
+                if (!m_pending.empty())
+                {
+                    flush();
+                }
+            }
+
+            void BatchingTransport::close()
+            {
+                if (m_socket == nullptr)
+                {
+                    return;
+                }
+
+                boost::system::error_code error; // to silently ignore all errors
+                m_flushTimer->cancel(error);
+                m_socket->cancel(error);
+                m_socket->close(error);
+                m_socket.reset();
+
+                m_isConnected = false;
+                m_isReceiving = false;
+                m_isReadPending = false;
+                m_isWriting = false;
+                m_isFlushScheduled = false;
+                m_pending.clear();
+                m_nPendingBytes = 0;
+                m_writing.clear();
+                m_inputBufferSize = 0;
+            }
+
+            void BatchingTransport::pause()
+            {
+                // cancelling the socket would also abort a write in flight, so a pending read is
+                // simply not re-armed once it completes
+                m_isReceiving = false;
+            }
+
+            void BatchingTransport::resume()
+            {
+                if (!m_isConnected || m_isReceiving)
+                {
+                    return;
+                }
+                m_isReceiving = true;
+                if (!m_isReadPending)
+                {
+                    asyncReceive();
+                }
+            }
+
+            void BatchingTransport::send(const Block &wire)
+            {
+                enqueue(wire);
+            }
+
+            void BatchingTransport::send(const Block &header, const Block &payload)
+            {
+                enqueue(header);
+                enqueue(payload);
+            }
+
+            void BatchingTransport::enqueue(const Block &wire)
+            {
+                if (m_pending.empty())
+                {
+                    m_batchStart = time::steady_clock::now();
+                }
+                m_pending.push_back(wire);
+                m_nPendingBytes += wire.size();
+
+                if (!m_isConnected)
+                {
+                    // written by connect()
+                    return;
+                }
+
+                if (m_pending.size() >= m_options.maxPackets || m_nPendingBytes >= m_options.maxBytes)
+                {
+                    flush();
+                    return;
+                }
+
+                if (m_isFlushScheduled)
+                {
+                    return;
+                }
+                m_isFlushScheduled = true;
+
+                auto self = shared_from_this();
+                if (m_options.flushDelay > 0_us)
+                {
+                    m_flushTimer->expires_from_now(std::chrono::microseconds(m_options.flushDelay.count()));
+                    m_flushTimer->async_wait([this, self](const boost::system::error_code &error)
+                                             {
+                                                 if (!error)
+                                                 {
+                                                     flush();
+                                                 } });
+                }
+                else
+                {
+                    m_ioService->post([this, self]
+                                      { flush(); });
+                }
+            }
+
+            void BatchingTransport::flush()
+            {
+                if (m_isFlushScheduled)
+                {
+                    m_isFlushScheduled = false;
+                    boost::system::error_code error;
+                    m_flushTimer->cancel(error);
+                }
+
+                if (!m_isConnected || m_isWriting || m_pending.empty())
+                {
+                    // a write in flight picks the pending packets up once it completes
+                    return;
+                }
+
+                m_writing.swap(m_pending);
+                m_writingBatchStart = m_batchStart;
+                m_nPendingBytes = 0;
+
+                m_writeBuffers.clear();
+                for (const auto &wire : m_writing)
+                {
+                    m_writeBuffers.emplace_back(wire.wire(), wire.size());
+                }
+
+                m_isWriting = true;
+                size_t nPackets = m_writing.size();
+                auto self = shared_from_this();
+                boost::asio::async_write(*m_socket, m_writeBuffers,
+                                         [this, self, nPackets](const boost::system::error_code &error, size_t)
+                                         { onWritten(error, nPackets); });
+            }
+
+            void BatchingTransport::onWritten(const boost::system::error_code &error, size_t nPackets)
+            {
+                if (error == boost::asio::error::operation_aborted || m_socket == nullptr)
+                {
+                    // closed in the meantime
+                    return;
+                }
+                if (error)
+                {
+                    close();
+                    NDN_THROW(Error(error, "Error while writing to " + m_socketPath));
+                }
+
+                m_counters.onFlush(nPackets, time::steady_clock::now() - m_writingBatchStart);
+                m_isWriting = false;
+                m_writing.clear();
+
+                if (!m_pending.empty() && !m_isFlushScheduled)
+                {
+                    flush();
+                }
+            }
+
+            void BatchingTransport::asyncReceive()
+            {
+                m_isReadPending = true;
+                auto self = shared_from_this();
+                m_socket->async_receive(boost::asio::buffer(m_inputBuffer + m_inputBufferSize,
+                                                            MAX_NDN_PACKET_SIZE - m_inputBufferSize),
+                                        [this, self](const boost::system::error_code &error, size_t nBytesReceived)
+                                        { onReceived(error, nBytesReceived); });
+            }
+
+            void BatchingTransport::onReceived(const boost::system::error_code &error, size_t nBytesReceived)
+            {
+                if (error == boost::asio::error::operation_aborted || m_socket == nullptr)
+                {
+                    return;
+                }
+                m_isReadPending = false;
+                if (error)
+                {
+                    close();
+                    NDN_THROW(Error(error, "Error while receiving from " + m_socketPath));
+                }
+
+                m_inputBufferSize += nBytesReceived;
+
+                size_t offset = 0;
+                bool isOk = true;
+                while (offset < m_inputBufferSize)
+                {
+                    Block element;
+                    std::tie(isOk, element) = Block::fromBuffer(m_inputBuffer + offset, m_inputBufferSize - offset);
+                    if (!isOk)
+                    {
+                        break;
+                    }
+                    offset += element.size();
+                    m_receiveCallback(element);
+                    if (m_socket == nullptr)
+                    {
+                        // closed by the callback
+                        return;
+                    }
+                }
+
+                if (!isOk && offset == 0 && m_inputBufferSize == MAX_NDN_PACKET_SIZE)
+                {
+                    close();
+                    NDN_THROW(Error("Input buffer full, but a valid TLV cannot be decoded"));
+                }
+
+                if (offset > 0)
+                {
+                    std::memmove(m_inputBuffer, m_inputBuffer + offset, m_inputBufferSize - offset);
+                    m_inputBufferSize -= offset;
+                }
+
+                if (m_isReceiving)
+                {
+                    asyncReceive();
+                }
+            }
+        }
+    }
+}
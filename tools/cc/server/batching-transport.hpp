@@ -0,0 +1,121 @@
+#ifndef CC_SERVER_BATCHING_TRANSPORT_H
+#define CC_SERVER_BATCHING_TRANSPORT_H
+#include "core/common.hpp"
+#include "producer-stats.hpp"
+
+#include <ndn-cxx/transport/transport.hpp>
+#include <boost/asio/local/stream_protocol.hpp>
+#include <boost/asio/steady_timer.hpp>
+
+namespace ndn
+{
+    namespace cc
+    {
+        namespace server
+        {
+            /**
+             * @brief Unix stream transport that coalesces outgoing packets into vectored writes
+             *
+             * Packets sent while a batch is open are only queued. The batch is written with a single
+             * gather write (sendmsg) when it reaches maxPackets or maxBytes, when the flush delay
+             * expires, or, with a zero flush delay, once the handlers already queued on the
+             * io_service have run, i.e. at the end of the current event-loop turn. While a write is
+             * in flight newly sent packets form the next batch, which may then grow past the limits.
+             */
+            class BatchingTransport : public Transport,
+                                      public std::enable_shared_from_this<BatchingTransport>
+            {
+            public:
+                struct Options
+                {
+                    size_t maxPackets = 64;               //!< flush once that many packets are queued
+                    size_t maxBytes = 256 * 1024;         //!< flush once that many bytes are queued
+                    time::microseconds flushDelay = 0_us; //!< flush delay (0 == end of the event-loop turn)
+                };
+
+                BatchingTransport(const std::string &socketPath, const Options &options);
+
+                ~BatchingTransport() override;
+
+                /**
+                 * @brief Returns the forwarder socket path configured for ndn-cxx applications
+                 *
+                 * The path comes from NDN_CLIENT_TRANSPORT or the client.conf transport, like the one
+                 * of the default Face transport.
+                 * @throw Transport::Error the configured transport is not a Unix socket
+                 */
+                static std::string
+                getDefaultSocketPath();
+
+                void
+                connect(boost::asio::io_service &ioService, ReceiveCallback receiveCallback) override;
+
+                void
+                close() override;
+
+                void
+                pause() override;
+
+                void
+                resume() override;
+
+                void
+                send(const Block &wire) override;
+
+                void
+                send(const Block &header, const Block &payload) override;
+
+                /**
+                 * @brief Returns the egress counters
+                 *
+                 * @note The counters may be read from any thread
+                 */
+                const EgressCounters &
+                getCounters() const
+                {
+                    return m_counters;
+                }
+
+            private:
+                void
+                enqueue(const Block &wire);
+
+                void
+                flush();
+
+                void
+                onWritten(const boost::system::error_code &error, size_t nPackets);
+
+                void
+                asyncReceive();
+
+                void
+                onReceived(const boost::system::error_code &error, size_t nBytesReceived);
+
+            private:
+                std::string m_socketPath;
+                Options m_options;
+                unique_ptr<boost::asio::local::stream_protocol::socket> m_socket;
+                unique_ptr<boost::asio::steady_timer> m_flushTimer;
+
+                std::vector<Block> m_pending;
+                size_t m_nPendingBytes;
+                time::steady_clock::TimePoint m_batchStart; ///< \brief when the first pending packet was queued
+                bool m_isFlushScheduled;
+
+                std::vector<Block> m_writing; ///< \brief packets of the write in flight
+                std::vector<boost::asio::const_buffer> m_writeBuffers;
+                time::steady_clock::TimePoint m_writingBatchStart;
+                bool m_isWriting;
+
+                uint8_t m_inputBuffer[MAX_NDN_PACKET_SIZE];
+                size_t m_inputBufferSize;
+                bool m_isReadPending;
+
+                EgressCounters m_counters;
+            };
+        }
+    }
+}
+
+#endif // CC_SERVER_BATCHING_TRANSPORT_H
@@ -0,0 +1,271 @@
+#include "data-signer.hpp"
+
+#include <ndn-cxx/security/safe-bag.hpp>
+#include <ndn-cxx/security/signing-helpers.hpp>
+#include <ndn-cxx/security/transform/base64-encode.hpp>
+#include <ndn-cxx/security/transform/buffer-source.hpp>
+#include <ndn-cxx/security/transform/stream-sink.hpp>
+#include <ndn-cxx/util/random.hpp>
+
+#include <sstream>
+
+namespace ndn
+{
+    namespace cc
+    {
+        namespace server
+        {
+            std::ostream &
+            operator<<(std::ostream &os, SigningMode mode)
+            {
+                switch (mode)
+                {
+                case SigningMode::NONE:
+                    return os << "none";
+                case SigningMode::DIGEST_SHA256:
+                    return os << "sha256";
+                case SigningMode::HMAC:
+                    return os << "hmac";
+                case SigningMode::ECDSA:
+                    return os << "ecdsa";
+                }
+                return os << static_cast<int>(mode);
+            }
+
+            SigningMode
+            parseSigningMode(const std::string &str)
+            {
+                for (auto mode : {SigningMode::NONE, SigningMode::DIGEST_SHA256, SigningMode::HMAC, SigningMode::ECDSA})
+                {
+                    if (boost::lexical_cast<std::string>(mode) == str)
+                    {
+                        return mode;
+                    }
+                }
+                NDN_THROW(std::invalid_argument("Unknown signing mode: " + str));
+            }
+
+            static std::string
+            makeHmacKey()
+            {
+                uint8_t key[32];
+                random::generateSecureBytes(key, sizeof(key));
+
+                std::ostringstream os;
+                security::transform::bufferSource(key, sizeof(key)) >>
+                    security::transform::base64Encode(false) >>
+                    security::transform::streamSink(os);
+                return os.str();
+            }
+
+            /// \brief protects the signing key only while it is copied between in-memory KeyChains
+            static const char SIGNING_KEY_PASSWORD[] = "cc-producer-signer";
+
+            /**
+             * @brief Creates the ECDSA key every signer thread signs with, exported for import
+             */
+            static shared_ptr<security::SafeBag>
+            makeSigningKey()
+            {
+                KeyChain keyChain("pib-memory:", "tpm-memory:");
+                auto identity = keyChain.createIdentity("/cc/producer/signer", EcKeyParams());
+                return keyChain.exportSafeBag(identity.getDefaultKey().getDefaultCertificate(),
+                                              SIGNING_KEY_PASSWORD, sizeof(SIGNING_KEY_PASSWORD) - 1);
+            }
+
+            class DataSigner::Context : noncopyable
+            {
+            public:
+                /**
+                 * @param signingKey ECDSA key and certificate, required by the ECDSA mode
+                 */
+                Context(SigningMode mode, const std::string &hmacKey, const security::SafeBag *signingKey)
+                    : m_keyChain("pib-memory:", "tpm-memory:")
+                {
+                    switch (mode)
+                    {
+                    case SigningMode::NONE:
+                        BOOST_ASSERT(false);
+                        break;
+                    case SigningMode::DIGEST_SHA256:
+                        m_signingInfo = security::signingWithSha256();
+                        break;
+                    case SigningMode::HMAC:
+                        m_signingInfo.setSigningHmacKey(hmacKey);
+                        break;
+                    case SigningMode::ECDSA:
+                        BOOST_ASSERT(signingKey != nullptr);
+                        m_keyChain.importSafeBag(*signingKey, SIGNING_KEY_PASSWORD, sizeof(SIGNING_KEY_PASSWORD) - 1);
+                        m_signingInfo = security::signingByCertificate(signingKey->getCertificate().getName());
+                        break;
+                    }
+                }
+
+                void
+                sign(Data &data)
+                {
+                    m_keyChain.sign(data, m_signingInfo);
+                }
+
+            private:
+                KeyChain m_keyChain;
+                security::SigningInfo m_signingInfo;
+            };
+
+            DataSigner::DataSigner(boost::asio::io_service &io, SigningMode mode, const std::string &hmacKey,
+                                   size_t cacheCapacity, size_t nThreads, size_t maxPending)
+                : m_io(io),
+                  m_mode(mode),
+                  m_hmacKey(hmacKey.empty() ? makeHmacKey() : hmacKey),
+                  m_cacheCapacity(cacheCapacity),
+                  m_maxPending(maxPending),
+                  m_isStopping(false),
+                  m_nHits(0),
+                  m_nMisses(0),
+                  m_nDropped(0)
+            {
+                BOOST_ASSERT(m_mode != SigningMode::NONE);
+
+                shared_ptr<security::SafeBag> signingKey;
+                if (m_mode == SigningMode::ECDSA)
+                {
+                    signingKey = makeSigningKey();
+                }
+
+                if (nThreads == 0)
+                {
+                    m_inlineContext = make_unique<Context>(m_mode, m_hmacKey, signingKey.get());
+                    return;
+                }
+
+                // KeyChain is not thread-safe, so every thread signs with its own copy of the key
+                for (size_t i = 0; i < nThreads; ++i)
+                {
+                    m_contexts.push_back(make_unique<Context>(m_mode, m_hmacKey, signingKey.get()));
+                }
+                for (const auto &context : m_contexts)
+                {
+                    Context *c = context.get();
+                    m_threads.emplace_back([this, c]
+                                           { runSigner(*c); });
+                }
+            }
+
+            DataSigner::~DataSigner()
+            {
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    m_isStopping = true;
+                }
+                m_cv.notify_all();
+                for (auto &thread : m_threads)
+                {
+                    thread.join();
+                }
+            }
+
+            void DataSigner::sign(const Name &name, const ResponseVariant &variant, const std::function<Data()> &makeData,
+                                  const Callback &done)
+            {
+                Key key{name, variant};
+                if (m_cacheCapacity > 0)
+                {
+                    auto it = m_cache.find(key);
+                    if (it != m_cache.end())
+                    {
+                        ++m_nHits;
+                        m_lru.splice(m_lru.begin(), m_lru, it->second);
+                        done(it->second->second);
+                        return;
+                    }
+                }
+                ++m_nMisses;
+
+                if (m_inlineContext != nullptr)
+                {
+                    Data data = makeData();
+                    m_inlineContext->sign(data);
+                    insert(key, data);
+                    done(data);
+                    return;
+                }
+
+                auto pending = m_pending.find(key);
+                if (pending != m_pending.end())
+                {
+                    pending->second.push_back(done);
+                    return;
+                }
+                if (m_pending.size() >= m_maxPending)
+                {
+                    ++m_nDropped;
+                    return;
+                }
+                m_pending[key].push_back(done);
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    m_jobs.push_back({std::move(key), makeData()});
+                }
+                m_cv.notify_one();
+            }
+
+            void DataSigner::insert(const Key &key, const Data &data)
+            {
+                if (m_cacheCapacity == 0)
+                {
+                    return;
+                }
+
+                auto it = m_cache.find(key);
+                if (it != m_cache.end())
+                {
+                    it->second->second = data;
+                    m_lru.splice(m_lru.begin(), m_lru, it->second);
+                    return;
+                }
+
+                m_lru.emplace_front(key, data);
+                m_cache.emplace(key, m_lru.begin());
+                if (m_lru.size() > m_cacheCapacity)
+                {
+                    m_cache.erase(m_lru.back().first);
+                    m_lru.pop_back();
+                }
+            }
+
+            void DataSigner::runSigner(Context &context)
+            {
+                while (true)
+                {
+                    Job job;
+                    {
+                        std::unique_lock<std::mutex> lock(m_mutex);
+                        m_cv.wait(lock, [this]
+                                  { return m_isStopping || !m_jobs.empty(); });
+                        if (m_isStopping)
+                        {
+                            return;
+                        }
+                        job = std::move(m_jobs.front());
+                        m_jobs.pop_front();
+                    }
+
+                    context.sign(job.data);
+                    job.data.wireEncode();
+
+                    m_io.post([this, job]
+                              {
+                                  auto pending = m_pending.find(job.key);
+                                  BOOST_ASSERT(pending != m_pending.end());
+                                  std::vector<Callback> callbacks = std::move(pending->second);
+                                  m_pending.erase(pending);
+                                  insert(job.key, job.data);
+                                  for (const auto &done : callbacks)
+                                  {
+                                      done(job.data);
+                                  } });
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,190 @@
+#ifndef CC_SERVER_DATA_SIGNER_H
+#define CC_SERVER_DATA_SIGNER_H
+#include "core/common.hpp"
+
+#include <condition_variable>
+#include <deque>
+#include <list>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+namespace ndn
+{
+    namespace cc
+    {
+        namespace server
+        {
+            enum class SigningMode
+            {
+                NONE,          //!< fake SignatureType 255 carrying a counter, no cryptography
+                DIGEST_SHA256, //!< DigestSha256
+                HMAC,          //!< HMAC-SHA256 with a shared key
+                ECDSA          //!< ECDSA-SHA256 with a key of an in-memory identity
+            };
+
+            std::ostream &
+            operator<<(std::ostream &os, SigningMode mode);
+
+            /**
+             * @brief Parses a signing mode name (none, sha256, hmac, ecdsa)
+             * @throw std::invalid_argument unknown name
+             */
+            SigningMode
+            parseSigningMode(const std::string &str);
+
+            /**
+             * @brief Fields other than the Name that go into the signed portion of a response
+             */
+            struct ResponseVariant
+            {
+                size_t payloadSize = 0;
+                int serviceClass = -1; //!< -1 without a ServiceClass
+                uint32_t targetRate = 0;
+
+                bool
+                operator==(const ResponseVariant &other) const
+                {
+                    return payloadSize == other.payloadSize && serviceClass == other.serviceClass &&
+                           targetRate == other.targetRate;
+                }
+            };
+
+            /**
+             * @brief Signs producer responses, caching signed packets by name
+             *
+             * A response is looked up by its Name and its ResponseVariant, and a hit reuses the
+             * signed packet as is. Misses are signed either inline or, with signer threads, by a
+             * pool of threads each owning its own in-memory KeyChain, with a copy of the same key
+             * in the ECDSA mode; the signed packet is then handed back on the io_service of the
+             * producer. A miss for a response that is already being signed waits for the same
+             * packet. When the threads fall behind by maxPending responses, further misses are
+             * dropped and counted, as the Interests would expire before their turn anyway.
+             *
+             * All member functions must be called from the thread running the io_service.
+             */
+            class DataSigner : noncopyable
+            {
+            public:
+                using Callback = std::function<void(const Data &)>;
+
+                /**
+                 * @param io io_service on which signed packets are handed back
+                 * @param mode signing mode, must not be NONE
+                 * @param hmacKey base64 HMAC key, a random one is generated if empty
+                 * @param cacheCapacity number of signed packets kept (0 == no cache)
+                 * @param nThreads number of signer threads (0 == sign inline)
+                 * @param maxPending number of distinct responses queued for the signer threads
+                 */
+                DataSigner(boost::asio::io_service &io, SigningMode mode, const std::string &hmacKey,
+                           size_t cacheCapacity, size_t nThreads, size_t maxPending = 4096);
+
+                ~DataSigner();
+
+                /**
+                 * @brief Delivers the signed response for @p name to @p done
+                 *
+                 * @param name Data name
+                 * @param variant the other signed fields of the response
+                 * @param makeData builds the unsigned response, only called on a cache miss
+                 * @param done receives the signed response, synchronously on a cache hit or with
+                 *             inline signing; never if the signer threads are maxPending
+                 *             responses behind (see getNDropped())
+                 */
+                void
+                sign(const Name &name, const ResponseVariant &variant, const std::function<Data()> &makeData,
+                     const Callback &done);
+
+                uint64_t
+                getNHits() const
+                {
+                    return m_nHits;
+                }
+
+                uint64_t
+                getNMisses() const
+                {
+                    return m_nMisses;
+                }
+
+                /**
+                 * @brief Returns the number of misses dropped because the queue was full
+                 */
+                uint64_t
+                getNDropped() const
+                {
+                    return m_nDropped;
+                }
+
+            private:
+                struct Key
+                {
+                    Name name;
+                    ResponseVariant variant;
+
+                    bool
+                    operator==(const Key &other) const
+                    {
+                        return variant == other.variant && name == other.name;
+                    }
+                };
+
+                struct KeyHash
+                {
+                    size_t
+                    operator()(const Key &key) const
+                    {
+                        return std::hash<Name>()(key.name) ^
+                               (key.variant.payloadSize * 0x9e3779b97f4a7c15ULL) ^
+                               (static_cast<uint64_t>(key.variant.serviceClass + 1) * 0xc2b2ae3d27d4eb4fULL) ^
+                               (key.variant.targetRate * 0x165667b19e3779f9ULL);
+                    }
+                };
+
+                /**
+                 * @brief KeyChain and signing parameters of one signing thread
+                 */
+                class Context;
+
+                struct Job
+                {
+                    Key key;
+                    Data data;
+                };
+
+                void
+                insert(const Key &key, const Data &data);
+
+                void
+                runSigner(Context &context);
+
+            private:
+                boost::asio::io_service &m_io;
+                SigningMode m_mode;
+                std::string m_hmacKey;
+                size_t m_cacheCapacity;
+
+                /// \brief most recently used first
+                std::list<std::pair<Key, Data>> m_lru;
+                std::unordered_map<Key, std::list<std::pair<Key, Data>>::iterator, KeyHash> m_cache;
+                /// \brief responses being signed by the pool, with the callbacks waiting for each
+                std::unordered_map<Key, std::vector<Callback>, KeyHash> m_pending;
+                size_t m_maxPending;
+
+                unique_ptr<Context> m_inlineContext;
+                std::vector<unique_ptr<Context>> m_contexts;
+                std::vector<std::thread> m_threads;
+                std::mutex m_mutex;
+                std::condition_variable m_cv;
+                std::deque<Job> m_jobs;
+                bool m_isStopping;
+
+                uint64_t m_nHits;
+                uint64_t m_nMisses;
+                uint64_t m_nDropped;
+            };
+        }
+    }
+}
+
+#endif // CC_SERVER_DATA_SIGNER_H
@@ -0,0 +1,118 @@
+#include "data-template.hpp"
+#include "tools/cc/common/tlv-writer.hpp"
+#include <ndn-cxx/signature.hpp>
+#include <algorithm>
+
+namespace ndn
+{
+    namespace cc
+    {
+        namespace server
+        {
+            DataTemplate::DataTemplate(PayloadPool &payloads, time::milliseconds freshnessPeriod, uint64_t signatureValue,
+                                       size_t nMaxTails)
+                : m_payloads(payloads),
+                  m_freshnessPeriod(freshnessPeriod),
+                  m_signatureValue(signatureValue),
+                  m_nMaxTails(std::max<size_t>(nMaxTails, 1))
+            {
+            }
+
+            Data DataTemplate::makeUnsignedData(const Name &name, size_t payloadSize, optional<int> serviceClass,
+                                                uint32_t targetRate)
+            {
+                Data data(name);
+                if (serviceClass)
+                {
+                    data.setServiceClass(*serviceClass);
+                }
+                data.setTargetRate(targetRate);
+                data.setFreshnessPeriod(m_freshnessPeriod);
+                data.setContent(m_payloads.getFilled(payloadSize));
+                return data;
+            }
+
+            Data DataTemplate::encodeData(const Name &name, size_t payloadSize, optional<int> serviceClass,
+                                          uint32_t targetRate)
+            {
+                Data data = makeUnsignedData(name, payloadSize, serviceClass, targetRate);
+
+                Signature signature;
+                SignatureInfo signatureInfo(static_cast<::ndn::tlv::SignatureTypeValue>(255));
+                signature.setInfo(signatureInfo);
+                signature.setValue(::ndn::makeNonNegativeIntegerBlock(::ndn::tlv::SignatureValue, m_signatureValue));
+                data.setSignature(signature);
+                data.wireEncode();
+                return data;
+            }
+
+            static Buffer
+            getTailWire(const Data &prototype)
+            {
+                Block wire = prototype.wireEncode();
+                wire.parse();
+                BOOST_ASSERT(!wire.elements().empty() && wire.elements().front().type() == tlv::Name);
+                return Buffer(wire.elements().front().end(), wire.end());
+            }
+
+            const DataTemplate::Tail &DataTemplate::getTail(size_t payloadSize, optional<int> serviceClass)
+            {
+                // sizes above the pool maximum share the tail of the clamped size
+                payloadSize = std::min(payloadSize, m_payloads.getMaxSize());
+                TailKey key(serviceClass ? *serviceClass : -1, payloadSize);
+                auto it = m_tails.find(key);
+                if (it != m_tails.end())
+                {
+                    m_lru.splice(m_lru.begin(), m_lru, it->second);
+                    return it->second->second;
+                }
+
+                // Encode prototypes once and keep everything after their Name. Two TargetRates that
+                // both need 4 octets tell where the value sits.
+                constexpr uint32_t maxRate = std::numeric_limits<uint32_t>::max();
+                Tail tail{getTailWire(encodeData(Name(), payloadSize, serviceClass, maxRate)), -1};
+                Buffer other = getTailWire(encodeData(Name(), payloadSize, serviceClass, maxRate - 1));
+                BOOST_ASSERT(other.size() == tail.wire.size());
+                auto diff = std::mismatch(tail.wire.begin(), tail.wire.end(), other.begin());
+                BOOST_ASSERT(diff.first != tail.wire.end());
+                // the last octet of the value is the one that differs
+                tail.rateOffset = diff.first - tail.wire.begin() - 3;
+
+                m_lru.emplace_front(key, std::move(tail));
+                m_tails.emplace(key, m_lru.begin());
+                if (m_lru.size() > m_nMaxTails)
+                {
+                    m_tails.erase(m_lru.back().first);
+                    m_lru.pop_back();
+                }
+                return m_lru.front().second;
+            }
+
+            Block DataTemplate::makeWire(const Name &name, size_t payloadSize, optional<int> serviceClass,
+                                         uint32_t targetRate)
+            {
+                const Tail &tail = getTail(payloadSize, serviceClass);
+                const Block &nameWire = name.wireEncode();
+
+                size_t valueLength = nameWire.size() + tail.wire.size();
+                size_t totalLength = tlv::sizeOfVarNumber(tlv::Data) + tlv::sizeOfVarNumber(valueLength) + valueLength;
+
+                // the transport may hold on to the wire until it has been written, so the buffer can
+                // only be recycled when nobody else references it anymore
+                if (m_buffer == nullptr || m_buffer.use_count() > 1)
+                {
+                    m_buffer = make_shared<Buffer>();
+                }
+                m_buffer->resize(totalLength);
+
+                uint8_t *pos = m_buffer->data();
+                pos = writeVarNumber(pos, tlv::Data);
+                pos = writeVarNumber(pos, valueLength);
+                pos = std::copy(nameWire.begin(), nameWire.end(), pos);
+                std::copy(tail.wire.begin(), tail.wire.end(), pos);
+                writeNonNegativeInteger(pos + tail.rateOffset, targetRate, 4);
+                return Block(m_buffer);
+            }
+        }
+    }
+}
@@ -0,0 +1,115 @@
+#ifndef CC_SERVER_DATA_TEMPLATE_H
+#define CC_SERVER_DATA_TEMPLATE_H
+#include "core/common.hpp"
+#include "core/payload-pool.hpp"
+
+#include <list>
+
+namespace ndn
+{
+    namespace cc
+    {
+        namespace server
+        {
+            /**
+             * @brief Pre-encoded wire template for producer responses
+             *
+             * Every response of the producer carries the same MetaInfo and (fake) signature, and its
+             * Content comes from a PayloadPool, so only the Name, the ServiceClass, the payload size
+             * and the TargetRate differ between Interests. The template encodes everything that
+             * follows the Name once per ServiceClass and payload size and builds each response by
+             * splicing the Interest Name in front of that tail, so the per-Interest cost is a single
+             * copy instead of a full TLV encoding.
+             *
+             * The tail reserves a 4-octet NonNegativeInteger for the TargetRate that is overwritten
+             * in place. The result is a wire Block meant to go straight to the transport, so no Data
+             * is decoded on the response path.
+             *
+             * Consumers choose the payload size through Dsz, so the tails are kept in an LRU cache of
+             * bounded size rather than one per size ever requested.
+             */
+            class DataTemplate : noncopyable
+            {
+            public:
+                /**
+                 * @param payloads source of the Content blocks, must outlive the template
+                 * @param freshnessPeriod FreshnessPeriod of the responses
+                 * @param signatureValue value of the fake signature
+                 * @param nMaxTails tails kept at most, least recently used first out
+                 */
+                DataTemplate(PayloadPool &payloads, time::milliseconds freshnessPeriod, uint64_t signatureValue,
+                             size_t nMaxTails = 256);
+
+                /**
+                 * @brief Builds the wire of a response for @p name
+                 *
+                 * @param name Data name, usually the Interest name
+                 * @param payloadSize Content size, clamped to the maximum of the payload pool
+                 * @param serviceClass ServiceClass to carry, if any
+                 * @param targetRate TargetRate to carry
+                 */
+                Block
+                makeWire(const Name &name, size_t payloadSize, optional<int> serviceClass,
+                         uint32_t targetRate = std::numeric_limits<uint32_t>::max());
+
+                /**
+                 * @brief Builds a response with the fields of the template, neither signed nor encoded
+                 *
+                 * This is the input of a real signature, which encodes the packet itself.
+                 */
+                Data
+                makeUnsignedData(const Name &name, size_t payloadSize, optional<int> serviceClass,
+                                 uint32_t targetRate = std::numeric_limits<uint32_t>::max());
+
+                /**
+                 * @brief Builds a response the same way as the template but through a full encoding
+                 *
+                 * This is the reference path the template is checked and benchmarked against.
+                 */
+                Data
+                encodeData(const Name &name, size_t payloadSize, optional<int> serviceClass,
+                           uint32_t targetRate = std::numeric_limits<uint32_t>::max());
+
+                /**
+                 * @brief Returns the number of tails in the cache
+                 */
+                size_t
+                getNTails() const
+                {
+                    return m_tails.size();
+                }
+
+            private:
+                struct Tail
+                {
+                    Buffer wire;        ///< \brief elements following the Name
+                    std::ptrdiff_t rateOffset; ///< \brief offset of the TargetRate value in wire
+                };
+
+                using TailKey = std::pair<int, size_t>;
+
+                /**
+                 * @brief Returns the pre-encoded elements following the Name
+                 *
+                 * The reference is valid until the next call.
+                 */
+                const Tail &
+                getTail(size_t payloadSize, optional<int> serviceClass);
+
+            private:
+                PayloadPool &m_payloads;
+                time::milliseconds m_freshnessPeriod;
+                uint64_t m_signatureValue;
+
+                size_t m_nMaxTails;
+                std::list<std::pair<TailKey, Tail>> m_lru;
+                /// \brief tails keyed by ServiceClass (-1 when absent) and payload size
+                std::map<TailKey, std::list<std::pair<TailKey, Tail>>::iterator> m_tails;
+
+                shared_ptr<Buffer> m_buffer; ///< \brief wire buffer reused once the previous response is released
+            };
+        }
+    }
+}
+
+#endif // CC_SERVER_DATA_TEMPLATE_H
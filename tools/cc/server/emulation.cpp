@@ -0,0 +1,79 @@
+#include "emulation.hpp"
+
+namespace ndn
+{
+    namespace cc
+    {
+        namespace server
+        {
+            static Options
+            makeProducerOptions(const EmulatedLink::Options &linkOptions, const Name &prefix, uint32_t payloadSize)
+            {
+                Options options;
+                options.prefix = prefix;
+                options.payloadSize = payloadSize;
+                options.egressCapacity = static_cast<uint64_t>(linkOptions.bandwidth / 8);
+                return options;
+            }
+
+            Emulation::Emulation(const EmulatedLink::Options &linkOptions, const Name &prefix, uint32_t payloadSize,
+                                 bool isSimulated)
+                : m_simulatedTime(isSimulated ? make_unique<SimulatedTime>() : nullptr),
+                  m_runDuration(0),
+                  m_link(m_io, linkOptions),
+                  m_keyChain("pib-memory:", "tpm-memory:"),
+                  m_consumerFace(m_link.getTransport(0), m_io, m_keyChain),
+                  m_producerFace(m_link.getTransport(1), m_io, m_keyChain),
+                  m_producerOptions(makeProducerOptions(linkOptions, prefix, payloadSize)),
+                  m_producer(m_producerFace, m_keyChain, m_producerOptions)
+            {
+            }
+
+            void Emulation::start()
+            {
+                m_producer.start();
+                // complete the registration now, or the first Interests would find no filter
+                m_io.poll();
+                m_io.reset();
+            }
+
+            void Emulation::run()
+            {
+                auto start = std::chrono::steady_clock::now();
+                if (m_simulatedTime != nullptr)
+                {
+                    m_simulatedTime->run(m_io);
+                }
+                else
+                {
+                    m_io.run();
+                }
+                m_runDuration = std::chrono::steady_clock::now() - start;
+            }
+
+            void Emulation::stop()
+            {
+                m_io.stop();
+            }
+
+            void Emulation::printStats(std::ostream &os) const
+            {
+                // end 0 sends the Interests, end 1 the Data
+                for (size_t end = 0; end < 2; ++end)
+                {
+                    const LinkStats &stats = m_link.getStats(end);
+                    os << "cc:link:<" << (end == 0 ? "interest" : "data") << "," << stats.nSent << ","
+                       << stats.nLost << "," << stats.nDropped << "," << stats.nMarked << ","
+                       << stats.nDelivered << "," << stats.nBytesDelivered << "," << stats.maxQueueLength
+                       << ">" << std::endl;
+                }
+                if (m_simulatedTime != nullptr)
+                {
+                    // simulated and real seconds
+                    os << "cc:simulation:<" << m_simulatedTime->getElapsed().count() / 1e9 << ","
+                       << std::chrono::duration<double>(m_runDuration).count() << ">" << std::endl;
+                }
+            }
+        }
+    }
+}
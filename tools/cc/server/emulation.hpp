@@ -0,0 +1,87 @@
+#ifndef CC_SERVER_EMULATION_H
+#define CC_SERVER_EMULATION_H
+#include "core/common.hpp"
+#include "tools/cc/common/emulated-link.hpp"
+#include "tools/cc/common/simulated-time.hpp"
+#include "ndn-producer.hpp"
+
+#include <chrono>
+
+namespace ndn
+{
+    namespace cc
+    {
+        namespace server
+        {
+            /**
+             * @brief A producer and a consumer Face joined by an EmulatedLink in one process
+             *
+             * The consumer Face is end 0 of the link, and a Producer serving the consumer prefix
+             * runs on end 1. The producer stamps TargetRate from the link bandwidth, so that rate
+             * feedback matches the emulated bottleneck.
+             *
+             * In simulated time, the emulation switches the clocks to SimulatedTime on construction,
+             * before the consumer is created on its Face, and runs at the speed of the handlers.
+             */
+            class Emulation : noncopyable
+            {
+            public:
+                /**
+                 * @param linkOptions link parameters
+                 * @param prefix prefix served by the producer
+                 * @param payloadSize payload size of the Data, unless the Interests request one
+                 * @param isSimulated run in simulated instead of real time
+                 */
+                Emulation(const EmulatedLink::Options &linkOptions, const Name &prefix, uint32_t payloadSize,
+                          bool isSimulated = false);
+
+                /**
+                 * @brief Returns the Face on which the consumer must run
+                 */
+                Face &
+                getConsumerFace()
+                {
+                    return m_consumerFace;
+                }
+
+                /**
+                 * @brief Registers the producer prefix, after which the consumer may start
+                 */
+                void
+                start();
+
+                /**
+                 * @brief Processes the events of both Faces until stop()
+                 */
+                void
+                run();
+
+                /**
+                 * @brief Stops the io_service shared by both Faces
+                 */
+                void
+                stop();
+
+                /**
+                 * @brief Prints the counters of both directions of the link, and the simulated and
+                 *        real duration of a simulated run
+                 */
+                void
+                printStats(std::ostream &os) const;
+
+            private:
+                unique_ptr<SimulatedTime> m_simulatedTime; ///< \brief first, so that the others run on its clocks
+                std::chrono::steady_clock::duration m_runDuration; ///< \brief real time taken by run()
+                boost::asio::io_service m_io;
+                EmulatedLink m_link;
+                KeyChain m_keyChain;
+                Face m_consumerFace;
+                Face m_producerFace;
+                Options m_producerOptions;
+                Producer m_producer;
+            };
+        }
+    }
+}
+
+#endif // CC_SERVER_EMULATION_H
@@ -1,7 +1,13 @@
+#include "batching-transport.hpp"
 #include "ndn-producer.hpp"
+#include "tools/cc/common/logger.hpp"
 #include "core/common.hpp"
 #include "core/version.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
 namespace ndn
 {
     namespace cc
@@ -11,50 +17,222 @@ namespace ndn
 
             namespace po = boost::program_options;
 
-            class Runner : noncopyable
+            /**
+             * @brief A producer with its own Face, driven by its own thread
+             */
+            class Worker : noncopyable
             {
             public:
-                explicit Runner(const Options &options)
+                explicit Worker(const Options &options)
                     : m_options(options),
-                    m_producer(m_face, m_keyChain, options)
+                      m_transport(makeTransport(m_options)),
+                      m_face(m_transport),
+                      m_producer(m_face, m_keyChain, m_options),
+                      m_isRunning(false),
+                      m_hasFailed(false)
                 {
                     m_producer.afterFinish.connect([this]
-                                                   {
-                        m_producer.stop();
-                        });
+                                                   { m_producer.stop(); });
+                }
 
+                void
+                start()
+                {
+                    m_isRunning = true;
+                    m_thread = std::thread([this]
+                                           { run(); });
                 }
 
-                int
-                run()
+                void
+                join()
+                {
+                    if (m_thread.joinable())
+                    {
+                        m_thread.join();
+                    }
+                }
+
+                bool
+                isRunning() const
+                {
+                    return m_isRunning;
+                }
+
+                bool
+                hasFailed() const
+                {
+                    return m_hasFailed;
+                }
+
+                const Name &
+                getPrefix() const
+                {
+                    return m_options.prefix;
+                }
+
+                ProducerStats
+                getStats() const
+                {
+                    ProducerStats stats = m_producer.getCounters().snapshot();
+                    if (m_transport != nullptr)
+                    {
+                        m_transport->getCounters().snapshot(stats);
+                    }
+                    return stats;
+                }
+
+                HistogramSnapshot
+                getLatency() const
                 {
-                    std::cout << "Producer SERVER " << m_options.prefix << std::endl;
+                    return m_producer.getLatencyHistogram().snapshot();
+                }
 
+            private:
+                /**
+                 * @brief Returns the batching egress, or nullptr to let the Face pick its default transport
+                 */
+                static shared_ptr<BatchingTransport>
+                makeTransport(const Options &options)
+                {
+                    if (options.egressBatchSize <= 1)
+                    {
+                        return nullptr;
+                    }
+                    BatchingTransport::Options transportOptions;
+                    transportOptions.maxPackets = options.egressBatchSize;
+                    transportOptions.maxBytes = options.egressBatchBytes;
+                    transportOptions.flushDelay = options.egressFlushDelay;
+                    return make_shared<BatchingTransport>(BatchingTransport::getDefaultSocketPath(), transportOptions);
+                }
+
+                void
+                run()
+                {
                     try
                     {
-                        // Interest interest(Name("/A/1"));
-                        // interest.setCanBePrefix(false);
-                        // interest.setMustBeFresh(true);
-                        // interest.setServiceClass(0);
-                        // m_producer.onInterest(interest);
                         m_producer.start();
                         m_face.processEvents();
                     }
                     catch (const std::exception &e)
                     {
                         std::cerr << "ERROR: " << e.what() << std::endl;
-                        return 1;
+                        m_hasFailed = true;
                     }
-
-                    return 0;
+                    m_isRunning = false;
                 }
 
             private:
-                const Options &m_options;
+                Options m_options;
 
+                shared_ptr<BatchingTransport> m_transport;
                 Face m_face;
                 KeyChain m_keyChain;
                 Producer m_producer;
+
+                std::thread m_thread;
+                std::atomic<bool> m_isRunning;
+                std::atomic<bool> m_hasFailed;
+            };
+
+            class Runner : noncopyable
+            {
+            public:
+                explicit Runner(const Options &options)
+                    : m_options(options)
+                {
+                    for (uint32_t i = 0; i < m_options.nThreads; ++i)
+                    {
+                        m_workers.push_back(make_unique<Worker>(makeWorkerOptions(m_options, i)));
+                    }
+                }
+
+                int
+                run()
+                {
+                    for (const auto &worker : m_workers)
+                    {
+                        std::cout << "Producer SERVER " << worker->getPrefix() << std::endl;
+                        worker->start();
+                    }
+
+                    if (m_options.statsInterval > 0_ms)
+                    {
+                        reportStats();
+                    }
+
+                    bool hasFailed = false;
+                    for (const auto &worker : m_workers)
+                    {
+                        worker->join();
+                        hasFailed = hasFailed || worker->hasFailed();
+                    }
+                    return hasFailed ? 1 : 0;
+                }
+
+            private:
+                /**
+                 * @brief Prints the counters aggregated over all workers until every worker has stopped
+                 */
+                void
+                reportStats()
+                {
+                    ProducerStats last;
+                    HistogramSnapshot lastLatency;
+                    uint64_t nReports = 0;
+                    while (std::any_of(m_workers.begin(), m_workers.end(),
+                                       [](const auto &worker)
+                                       { return worker->isRunning(); }))
+                    {
+                        std::this_thread::sleep_for(std::chrono::milliseconds(m_options.statsInterval.count()));
+
+                        ProducerStats total;
+                        for (const auto &worker : m_workers)
+                        {
+                            total += worker->getStats();
+                        }
+                        auto diff = total - last;
+                        last = total;
+
+                        std::cout << "cc:producer:<" << ++nReports << "," << diff.nInterests << ","
+                                  << diff.nData << "," << diff.nBytes;
+                        if (m_options.egressBatchSize > 1)
+                        {
+                            // average batch size and flush latency (in microseconds) over the interval
+                            double batchSize = diff.nBatches > 0 ? static_cast<double>(diff.nBatchedPackets) / diff.nBatches : 0.0;
+                            double flushLatency = diff.nBatches > 0 ? diff.flushLatency.count() / 1e3 / diff.nBatches : 0.0;
+                            std::cout << "," << diff.nBatches << "," << batchSize << "," << flushLatency;
+                        }
+                        if (m_options.admitRate > 0 || !m_options.classAdmitRates.empty())
+                        {
+                            std::cout << "," << diff.nNacks << "," << diff.nMarked;
+                        }
+                        std::cout << ">" << std::endl;
+
+                        if (m_options.recordLatency)
+                        {
+                            HistogramSnapshot latency;
+                            for (const auto &worker : m_workers)
+                            {
+                                latency += worker->getLatency();
+                            }
+                            auto latencyDiff = latency - lastLatency;
+                            lastLatency = std::move(latency);
+
+                            // Interest-to-put latency percentiles over the interval, in microseconds
+                            auto toUs = [](time::nanoseconds d)
+                            { return d.count() / 1e3; };
+                            std::cout << "cc:producer:latency:<" << nReports << "," << latencyDiff.getCount() << ","
+                                      << toUs(latencyDiff.getPercentile(50)) << ","
+                                      << toUs(latencyDiff.getPercentile(99)) << ","
+                                      << toUs(latencyDiff.getPercentile(99.9)) << ","
+                                      << toUs(latencyDiff.getMax()) << ">" << std::endl;
+                        }
+                    }
+                }
+
+            private:
+                const Options &m_options;
+                std::vector<unique_ptr<Worker>> m_workers;
             };
 
             static void
@@ -71,6 +249,7 @@ namespace ndn
             main(int argc, char *argv[])
             {
                 Options options;
+                LoggerOptions loggerOptions;
                 std::string prefix;
 
                 po::options_description visibleDesc("Options");
@@ -81,6 +260,83 @@ namespace ndn
                 visibleDesc.add_options()("size,s",
                                           po::value<uint32_t>()->default_value(1024),
                                           "size of response payload");
+                visibleDesc.add_options()("payload-distribution",
+                                          po::value<std::string>(&options.payloadDistribution),
+                                          "payload sizes of responses to Interests without Dsz, instead of --size: "
+                                          "fixed:N, uniform:MIN-MAX, bimodal:SMALL,LARGE,P (P == probability of SMALL) "
+                                          "or trace:FILE (sizes replayed in a loop)");
+                visibleDesc.add_options()("honor-dsz",
+                                          po::value<bool>(&options.honorDsz)->default_value(true),
+                                          "serve the payload size requested by the Dsz of the Interest when present");
+                visibleDesc.add_options()("max-size",
+                                          po::value<uint32_t>(&options.maxPayloadSize)->default_value(8700),
+                                          "upper bound of any payload size, requested or drawn");
+                visibleDesc.add_options()("wire-template",
+                                          po::value<bool>(&options.useWireTemplate)->default_value(true),
+                                          "splice responses into a pre-encoded Data template instead of encoding each one");
+                visibleDesc.add_options()("threads,t",
+                                          po::value<uint32_t>(&options.nThreads)->default_value(1),
+                                          "number of worker threads, each with its own Face and producer");
+                visibleDesc.add_options()("shared-prefix",
+                                          "let every worker register <prefix> instead of <prefix>/i; the forwarder "
+                                          "strategy then picks the workers (best-route sends everything to one, "
+                                          "multicast makes all of them answer each Interest)");
+                visibleDesc.add_options()("stats-interval",
+                                          po::value<time::milliseconds::rep>()->default_value(0),
+                                          "report counters aggregated over all workers every interval, in milliseconds (0 == off)");
+                visibleDesc.add_options()("capacity",
+                                          po::value<uint64_t>(&options.egressCapacity)->default_value(0),
+                                          "egress capacity shared through the TargetRate of responses, in bytes per second, "
+                                          "split evenly among the worker threads (0 == stamp the maximum rate)");
+                visibleDesc.add_options()("rate-policy",
+                                          po::value<std::string>()->default_value("maxmin"),
+                                          "how the capacity is shared among consumers: maxmin or weighted (by ServiceClass)");
+                visibleDesc.add_options()("class-weight",
+                                          po::value<std::vector<std::string>>()->composing(),
+                                          "weight of a ServiceClass under the weighted policy, as CLASS=WEIGHT (repeatable)");
+                visibleDesc.add_options()("rate-window",
+                                          po::value<time::milliseconds::rep>()->default_value(1000),
+                                          "sliding window over which arrival rates are measured, in milliseconds");
+                visibleDesc.add_options()("batch-size",
+                                          po::value<size_t>(&options.egressBatchSize)->default_value(1),
+                                          "coalesce up to this many outgoing packets into one vectored write (1 == off)");
+                visibleDesc.add_options()("batch-bytes",
+                                          po::value<size_t>(&options.egressBatchBytes)->default_value(256 * 1024),
+                                          "flush a batch once it holds this many bytes");
+                visibleDesc.add_options()("flush-delay",
+                                          po::value<time::microseconds::rep>()->default_value(0),
+                                          "how long a batch may wait for more packets, in microseconds "
+                                          "(0 == until the end of the current event-loop turn)");
+                visibleDesc.add_options()("signing",
+                                          po::value<std::string>()->default_value("none"),
+                                          "how responses are signed: none (fake signature), sha256, hmac or ecdsa");
+                visibleDesc.add_options()("hmac-key",
+                                          po::value<std::string>(&options.hmacKey),
+                                          "base64 key of the hmac signing mode (default: random)");
+                visibleDesc.add_options()("signature-cache",
+                                          po::value<size_t>(&options.signatureCacheSize)->default_value(65536),
+                                          "number of signed responses reused for repeated names (0 == off)");
+                visibleDesc.add_options()("signer-threads",
+                                          po::value<size_t>(&options.nSignerThreads)->default_value(1),
+                                          "threads per worker signing responses missing from the cache (0 == sign inline)");
+                visibleDesc.add_options()("latency",
+                                          po::bool_switch(&options.recordLatency),
+                                          "record the Interest-to-put latency of every Interest and add its "
+                                          "p50/p99/p99.9/max to the --stats-interval reports");
+                visibleDesc.add_options()("admit-rate",
+                                          po::value<double>(&options.admitRate)->default_value(0),
+                                          "Interests per second admitted per ServiceClass and worker (0 == unlimited)");
+                visibleDesc.add_options()("admit-class",
+                                          po::value<std::vector<std::string>>()->composing(),
+                                          "Interests per second admitted for a ServiceClass from 0 to 255, as CLASS=RATE (repeatable)");
+                visibleDesc.add_options()("admit-burst",
+                                          po::value<double>(&options.admitBurst)->default_value(32),
+                                          "Interests admitted back to back after an idle period");
+                visibleDesc.add_options()("overload-action",
+                                          po::value<std::string>()->default_value("nack"),
+                                          "response to Interests beyond the admitted rate: nack (Congestion Nack) "
+                                          "or mark (Data with a congestion mark)");
+                addLoggerOptions(visibleDesc, loggerOptions, "none");
                 visibleDesc.add_options()("version,V", "print program version and exit");
 
                 po::options_description hiddenDesc;
@@ -143,8 +399,163 @@ namespace ndn
                 }
 
                 options.payloadSize = vm["size"].as<uint32_t>();
+                if (!options.payloadDistribution.empty())
+                {
+                    try
+                    {
+                        PayloadDistribution check(options.payloadDistribution);
+                    }
+                    catch (const std::exception &e)
+                    {
+                        std::cerr << "ERROR: " << e.what() << std::endl;
+                        return 2;
+                    }
+                }
+
+                if (options.nThreads < 1)
+                {
+                    std::cerr << "ERROR: at least one worker thread is required" << std::endl;
+                    return 2;
+                }
+                options.shardPrefixes = vm.count("shared-prefix") == 0;
+                std::string ratePolicy = vm["rate-policy"].as<std::string>();
+                if (ratePolicy == "maxmin")
+                {
+                    options.ratePolicy = RateAllocator::MAX_MIN;
+                }
+                else if (ratePolicy == "weighted")
+                {
+                    options.ratePolicy = RateAllocator::WEIGHTED;
+                }
+                else
+                {
+                    std::cerr << "ERROR: unknown rate policy " << ratePolicy << std::endl;
+                    return 2;
+                }
+
+                if (vm.count("class-weight") > 0)
+                {
+                    for (const auto &classWeight : vm["class-weight"].as<std::vector<std::string>>())
+                    {
+                        auto pos = classWeight.find('=');
+                        try
+                        {
+                            if (pos == std::string::npos)
+                            {
+                                NDN_THROW(std::invalid_argument("missing '='"));
+                            }
+                            double weight = std::stod(classWeight.substr(pos + 1));
+                            if (weight <= 0)
+                            {
+                                NDN_THROW(std::invalid_argument("weight must be positive"));
+                            }
+                            options.classWeights[std::stoi(classWeight.substr(0, pos))] = weight;
+                        }
+                        catch (const std::exception &e)
+                        {
+                            std::cerr << "ERROR: invalid class weight " << classWeight << ": " << e.what() << std::endl;
+                            return 2;
+                        }
+                    }
+                }
+
+                if (vm.count("admit-class") > 0)
+                {
+                    for (const auto &classRate : vm["admit-class"].as<std::vector<std::string>>())
+                    {
+                        try
+                        {
+                            auto parsed = AdmissionController::parseClassRate(classRate);
+                            options.classAdmitRates[parsed.first] = parsed.second;
+                        }
+                        catch (const std::exception &e)
+                        {
+                            std::cerr << "ERROR: invalid class admission rate " << classRate << ": " << e.what() << std::endl;
+                            return 2;
+                        }
+                    }
+                }
+                if (options.admitRate < 0)
+                {
+                    std::cerr << "ERROR: admission rate cannot be negative" << std::endl;
+                    return 2;
+                }
+                if (options.admitBurst < 1)
+                {
+                    std::cerr << "ERROR: admission burst must be at least 1" << std::endl;
+                    return 2;
+                }
+                std::string overloadAction = vm["overload-action"].as<std::string>();
+                if (overloadAction == "nack")
+                {
+                    options.overloadAction = AdmissionController::NACK;
+                }
+                else if (overloadAction == "mark")
+                {
+                    options.overloadAction = AdmissionController::MARK;
+                }
+                else
+                {
+                    std::cerr << "ERROR: unknown overload action " << overloadAction << std::endl;
+                    return 2;
+                }
+
+                options.rateWindow = time::milliseconds(vm["rate-window"].as<time::milliseconds::rep>());
+                if (options.rateWindow <= 0_ms)
+                {
+                    std::cerr << "ERROR: rate window must be positive" << std::endl;
+                    return 2;
+                }
+
+                options.egressFlushDelay = time::microseconds(vm["flush-delay"].as<time::microseconds::rep>());
+                if (options.egressFlushDelay < 0_us)
+                {
+                    std::cerr << "ERROR: flush delay cannot be negative" << std::endl;
+                    return 2;
+                }
+                if (options.egressBatchSize > 1 && options.egressBatchBytes == 0)
+                {
+                    std::cerr << "ERROR: batch bytes must be positive" << std::endl;
+                    return 2;
+                }
+
+                try
+                {
+                    options.signingMode = parseSigningMode(vm["signing"].as<std::string>());
+                }
+                catch (const std::invalid_argument &e)
+                {
+                    std::cerr << "ERROR: " << e.what() << std::endl;
+                    return 2;
+                }
+
+                options.statsInterval = time::milliseconds(vm["stats-interval"].as<time::milliseconds::rep>());
+                if (options.statsInterval < 0_ms)
+                {
+                    std::cerr << "ERROR: stats interval cannot be negative" << std::endl;
+                    return 2;
+                }
 
-                return Runner(options).run();
+                try
+                {
+                    applyLoggerOptions(loggerOptions);
+                }
+                catch (const std::exception &e)
+                {
+                    std::cerr << "ERROR: " << e.what() << std::endl;
+                    return 2;
+                }
+
+                try
+                {
+                    Runner runner(options);
+                    return runner.run();
+                }
+                catch (const std::exception &e)
+                {
+                    std::cerr << "ERROR: " << e.what() << std::endl;
+                    return 1;
+                }
             }
 
         } // namespace server
@@ -1,6 +1,11 @@
 #include "ndn-producer.hpp"
-#include <ndn-cxx/signature.hpp>
-#include <iostream>
+#include "tools/cc/common/logger.hpp"
+
+#include <ndn-cxx/lp/packet.hpp>
+#include <ndn-cxx/lp/tags.hpp>
+#include <ndn-cxx/transport/transport.hpp>
+#include <algorithm>
+#include <limits>
 
 namespace ndn
 {
@@ -8,16 +13,81 @@ namespace ndn
     {
         namespace server
         {
+            static std::string
+            getPayloadSpec(const Options &options)
+            {
+                return options.payloadDistribution.empty() ? to_string(options.payloadSize)
+                                                           : options.payloadDistribution;
+            }
+
+            /**
+             * @brief Identifies the consumer of an Interest
+             *
+             * Consumers name their Interests <prefix>/<seq>, so the flow is the Name without its last
+             * component, refined by the incoming face when the forwarder reports it.
+             */
+            static uint64_t
+            makeFlowKey(const Interest &interest)
+            {
+                const Name &name = interest.getName();
+                const Block &wire = name.wireEncode();
+                const uint8_t *end = name.empty() ? wire.value_end() : name.at(-1).wire();
+
+                // FNV-1a
+                uint64_t hash = 14695981039346656037ULL;
+                for (const uint8_t *pos = wire.value_begin(); pos != end; ++pos)
+                {
+                    hash = (hash ^ *pos) * 1099511628211ULL;
+                }
+
+                auto incomingFaceId = interest.getTag<lp::IncomingFaceIdTag>();
+                if (incomingFaceId != nullptr)
+                {
+                    hash = (hash ^ incomingFaceId->get()) * 1099511628211ULL;
+                }
+                return hash;
+            }
+
+            Options
+            makeWorkerOptions(const Options &options, uint32_t worker)
+            {
+                Options workerOptions(options);
+                if (options.shardPrefixes && options.nThreads > 1)
+                {
+                    workerOptions.prefix.appendNumber(worker);
+                }
+                workerOptions.egressCapacity = options.egressCapacity / std::max<uint32_t>(options.nThreads, 1);
+                return workerOptions;
+            }
+
             Producer::Producer(Face &face, KeyChain &keyChain, const Options &options)
-                : m_face(face),
+                : m_options(options),
+                  m_face(face),
                   m_keyChain(keyChain),
-                  m_options(options),
                   m_isRunning(false),
-                  m_signature(0)
+                  m_signature(0),
+                  m_payloadSizes(getPayloadSpec(options)),
+                  m_template(getPayloadPool(), options.freshnessPeriod, m_signature)
             {
-                auto b = make_shared<Buffer>();
-                b->assign(m_options.payloadSize, 'a');
-                m_payload = Block(tlv::Content, std::move(b));
+                for (size_t payloadSize : m_payloadSizes.getSupport())
+                {
+                    getPayloadPool().getFilled(std::min<size_t>(payloadSize, m_options.maxPayloadSize));
+                }
+                if (m_options.egressCapacity > 0)
+                {
+                    m_rateAllocator = make_unique<RateAllocator>(m_options.egressCapacity, m_options.rateWindow,
+                                                                 m_options.ratePolicy, m_options.classWeights);
+                }
+                if (m_options.admitRate > 0 || !m_options.classAdmitRates.empty())
+                {
+                    m_admission = make_unique<AdmissionController>(m_options.admitRate, m_options.classAdmitRates,
+                                                                   m_options.admitBurst);
+                }
+                if (m_options.signingMode != SigningMode::NONE)
+                {
+                    m_signer = make_unique<DataSigner>(m_face.getIoService(), m_options.signingMode, m_options.hmacKey,
+                                                       m_options.signatureCacheSize, m_options.nSignerThreads);
+                }
             }
 
             void Producer::run()
@@ -54,31 +124,127 @@ namespace ndn
                 m_face.setInterestFilter(m_options.prefix, nullptr);
             }
 
+            void Producer::putData(const Data &data, bool isCongested)
+            {
+                if (!isCongested)
+                {
+                    m_face.put(data);
+                    return;
+                }
+
+                // tags are not part of the wire encoding, so the copy shares it with cached responses
+                Data marked(data);
+                marked.setTag(make_shared<lp::CongestionMarkTag>(1));
+                m_face.put(marked);
+                m_counters.onMarked();
+            }
+
+            void Producer::putWire(const Name &name, const Block &wire, bool isCongested)
+            {
+                // the Face would decode the Data only to encode it again, so the wire goes to its
+                // transport as is, with the congestion mark in an NDNLPv2 header; the size limit
+                // enforced by Face::put is checked here instead
+                Block packetWire = wire;
+                if (isCongested)
+                {
+                    lp::Packet packet;
+                    packet.add<lp::CongestionMarkField>(1);
+                    packet.add<lp::FragmentField>(std::make_pair(wire.begin(), wire.end()));
+                    packetWire = packet.wireEncode();
+                }
+
+                if (packetWire.size() > MAX_NDN_PACKET_SIZE)
+                {
+                    NDN_THROW(Face::OversizedPacketError('D', name, packetWire.size()));
+                }
+                m_face.getTransport()->send(packetWire);
+                if (isCongested)
+                {
+                    m_counters.onMarked();
+                }
+            }
+
+            void Producer::onResponded(const Name &name, size_t size, time::steady_clock::TimePoint receiveTime)
+            {
+                m_counters.onData(size);
+                if (m_options.recordLatency)
+                {
+                    auto latency = time::steady_clock::now() - receiveTime;
+                    m_latency.record(latency);
+                    afterRespond(name, latency);
+                }
+            }
+
             void Producer::onInterest(const Interest &interest)
             {
+                auto receiveTime = m_options.recordLatency ? time::steady_clock::now() : time::steady_clock::TimePoint();
                 afterReceive(interest.getName());
+                m_counters.onInterest();
 
-                Data data(interest.getName());
+                optional<int> serviceClass;
                 if (interest.getServiceClass())
                 {
-                    int serviceClass = *interest.getServiceClass();
-                    data.setServiceClass(serviceClass);
+                    serviceClass = static_cast<int>(std::min<uint64_t>(*interest.getServiceClass(),
+                                                                       std::numeric_limits<int>::max()));
+                }
+
+                bool isCongested = m_admission != nullptr && !m_admission->admit(serviceClass ? *serviceClass : -1);
+                if (isCongested && m_options.overloadAction == AdmissionController::NACK)
+                {
+                    lp::Nack nack(interest);
+                    nack.setReason(lp::NackReason::CONGESTION);
+                    m_face.put(nack);
+                    m_counters.onNack();
+                    CC_LOG(TRACE, "onInterest:nack", interest.getName());
+                    return;
+                }
+
+                size_t payloadSize = 0;
+                if (m_options.honorDsz && interest.getDsz())
+                {
+                    payloadSize = static_cast<size_t>(std::min<uint64_t>(*interest.getDsz(), m_options.maxPayloadSize));
+                }
+                else
+                {
+                    payloadSize = std::min<size_t>(m_payloadSizes.next(), m_options.maxPayloadSize);
                 }
-                // 设置 targetRate 为最大32位整数
-                data.setTargetRate(std::numeric_limits<uint32_t>::max());
-                data.setFreshnessPeriod(m_options.freshnessPeriod);
-                data.setContent(m_payload);
 
-                Signature signature;
-                SignatureInfo signatureInfo(static_cast<::ndn::tlv::SignatureTypeValue>(255));
-                signature.setInfo(signatureInfo);
-                signature.setValue(::ndn::makeNonNegativeIntegerBlock(::ndn::tlv::SignatureValue, m_signature));
-                data.setSignature(signature);
-                data.wireEncode();
+                uint32_t targetRate = std::numeric_limits<uint32_t>::max();
+                if (m_rateAllocator != nullptr)
+                {
+                    uint64_t rate = m_rateAllocator->onInterest(makeFlowKey(interest), serviceClass ? *serviceClass : -1,
+                                                                payloadSize);
+                    targetRate = static_cast<uint32_t>(std::min<uint64_t>(rate, targetRate));
+                }
 
-                // m_keyChain.sign(data);
-                m_face.put(data);
-                std::cout << "onInterest: " << interest.getName() << std::endl;
+                if (m_signer != nullptr)
+                {
+                    ResponseVariant variant;
+                    variant.payloadSize = payloadSize;
+                    variant.serviceClass = serviceClass ? *serviceClass : -1;
+                    variant.targetRate = targetRate;
+                    m_signer->sign(interest.getName(), variant,
+                                   [&]
+                                   { return m_template.makeUnsignedData(interest.getName(), payloadSize, serviceClass, targetRate); },
+                                   [this, receiveTime, isCongested](const Data &data)
+                                   {
+                                       putData(data, isCongested);
+                                       onResponded(data.getName(), data.wireEncode().size(), receiveTime);
+                                   });
+                }
+                else if (m_options.useWireTemplate)
+                {
+                    Block wire = m_template.makeWire(interest.getName(), payloadSize, serviceClass, targetRate);
+                    putWire(interest.getName(), wire, isCongested);
+                    onResponded(interest.getName(), wire.size(), receiveTime);
+                }
+                else
+                {
+                    Data data = m_template.encodeData(interest.getName(), payloadSize, serviceClass, targetRate);
+                    putData(data, isCongested);
+                    onResponded(data.getName(), data.wireEncode().size(), receiveTime);
+                }
+                CC_LOG(TRACE, "onInterest", interest.getName());
             }
         }
     }
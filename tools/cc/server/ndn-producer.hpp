@@ -1,4 +1,13 @@
+#ifndef CC_SERVER_NDN_PRODUCER_H
+#define CC_SERVER_NDN_PRODUCER_H
 #include "core/common.hpp"
+#include "tools/cc/common/latency-histogram.hpp"
+#include "admission-controller.hpp"
+#include "data-signer.hpp"
+#include "data-template.hpp"
+#include "payload-distribution.hpp"
+#include "producer-stats.hpp"
+#include "rate-allocator.hpp"
 
 namespace ndn
 {
@@ -14,8 +23,49 @@ namespace ndn
                 Name prefix;                              //!< prefix to register
                 time::milliseconds freshnessPeriod = 4_s; //!< data freshness period
                 uint32_t payloadSize = 0;                 //!< response payload size (0 == no payload)
+                std::string payloadDistribution;          //!< payload size distribution, overrides payloadSize if not empty
+                bool honorDsz = true;                     //!< serve the Dsz requested by the Interest when present
+                uint32_t maxPayloadSize = 8700;           //!< upper bound of any payload size
+                bool useWireTemplate = true;              //!< splice responses into a pre-encoded template
+                uint32_t nThreads = 1;                    //!< number of worker threads, each with its own Face
+                bool shardPrefixes = true;                //!< with several workers, worker i registers prefix/i instead of prefix
+                time::milliseconds statsInterval = 0_ms;  //!< aggregated counters report interval (0 == off)
+
+                uint64_t egressCapacity = 0;                              //!< bytes/s shared by TargetRate (0 == always stamp the maximum)
+                RateAllocator::Policy ratePolicy = RateAllocator::MAX_MIN; //!< how the capacity is shared among flows
+                std::map<int, double> classWeights;                       //!< ServiceClass weights of the WEIGHTED policy
+                time::milliseconds rateWindow = 1_s;                      //!< sliding window of the arrival rates
+
+                size_t egressBatchSize = 1;                 //!< packets coalesced per egress write (1 == no batching)
+                size_t egressBatchBytes = 256 * 1024;       //!< bytes coalesced per egress write
+                time::microseconds egressFlushDelay = 0_us; //!< how long a batch may stay open (0 == until the end of the event-loop turn)
+
+                SigningMode signingMode = SigningMode::NONE; //!< how responses are signed
+                std::string hmacKey;                         //!< base64 key of the HMAC mode (empty == random)
+                size_t signatureCacheSize = 65536;           //!< signed responses cached by name (0 == no cache)
+                size_t nSignerThreads = 1;                   //!< threads signing cache misses (0 == sign inline)
+
+                bool recordLatency = false; //!< time the Interest-to-put path of every Interest
+
+                double admitRate = 0;                                                 //!< Interests/s admitted per ServiceClass (0 == unlimited)
+                std::map<int, double> classAdmitRates;                                //!< admitted Interests/s of specific ServiceClasses
+                double admitBurst = 32;                                               //!< Interests admitted back to back after an idle period
+                AdmissionController::Action overloadAction = AdmissionController::NACK; //!< response to Interests beyond the rate
             };
 
+            /**
+             * @brief Returns the options of worker @p worker out of Options::nThreads
+             *
+             * With several workers and Options::shardPrefixes, worker i registers <prefix>/i: workers
+             * sharing one prefix would leave the split to the forwarder strategy, which sends all
+             * Interests to one of them under best-route and to all of them under multicast.
+             *
+             * Each worker advertises TargetRates from its own share of the egress capacity, so that
+             * the rates of all workers add up to Options::egressCapacity.
+             */
+            Options
+            makeWorkerOptions(const Options &options, uint32_t worker);
+
             class Producer : noncopyable
             {
             public:
@@ -28,6 +78,16 @@ namespace ndn
                  */
                 signal::Signal<Producer, Name> afterReceive;
 
+                /**
+                 * @brief Signals when the response to an Interest has been put
+                 *
+                 * Only emitted when Options::recordLatency is set.
+                 *
+                 * @param name response name
+                 * @param latency time from receiving the Interest to putting the response
+                 */
+                signal::Signal<Producer, Name, time::nanoseconds> afterRespond;
+
                 /**
                  * @brief Signals when finished pinging
                  */
@@ -50,6 +110,45 @@ namespace ndn
                 void
                 stop();
 
+                /**
+                 * @brief Returns the counters of this producer
+                 *
+                 * @note The counters may be read from any thread
+                 */
+                const ProducerCounters &
+                getCounters() const
+                {
+                    return m_counters;
+                }
+
+                /**
+                 * @brief Returns the Interest-to-put latencies recorded so far
+                 *
+                 * @note The histogram may be read from any thread
+                 */
+                const LatencyHistogram &
+                getLatencyHistogram() const
+                {
+                    return m_latency;
+                }
+
+            private:
+                /**
+                 * @brief Puts @p data, with a congestion mark if @p isCongested
+                 */
+                void
+                putData(const Data &data, bool isCongested);
+
+                /**
+                 * @brief Sends the encoded Data @p wire, with a congestion mark if @p isCongested
+                 * @throw Face::OversizedPacketError the packet exceeds MAX_NDN_PACKET_SIZE, as with Face::put
+                 */
+                void
+                putWire(const Name &name, const Block &wire, bool isCongested);
+
+                void
+                onResponded(const Name &name, size_t size, time::steady_clock::TimePoint receiveTime);
+
             public:
                 /**
                  * @brief Called when interest received
@@ -63,11 +162,19 @@ namespace ndn
                 const Options &m_options;
                 Face &m_face;
                 KeyChain &m_keyChain;
-                Block m_payload;
                 bool m_isRunning;
                 uint32_t m_signature;
+                PayloadDistribution m_payloadSizes;
+                DataTemplate m_template;
+                ProducerCounters m_counters;
+                LatencyHistogram m_latency;
+                unique_ptr<RateAllocator> m_rateAllocator;
+                unique_ptr<AdmissionController> m_admission;
+                unique_ptr<DataSigner> m_signer;
                 RegisteredPrefixHandle m_registeredPrefix;
             };
         }
     }
-}
\ No newline at end of file
+}
+
+#endif // CC_SERVER_NDN_PRODUCER_H
@@ -0,0 +1,144 @@
+#include "payload-distribution.hpp"
+#include <algorithm>
+#include <fstream>
+#include <set>
+
+namespace ndn
+{
+    namespace cc
+    {
+        namespace server
+        {
+            constexpr size_t PayloadDistribution::N_UNIFORM_SIZES;
+
+            static size_t
+            parseSize(const std::string &str)
+            {
+                size_t pos = 0;
+                unsigned long long size = 0;
+                try
+                {
+                    size = std::stoull(str, &pos);
+                }
+                catch (const std::exception &)
+                {
+                    pos = 0;
+                }
+                if (pos == 0 || pos != str.size() || str[0] == '-')
+                {
+                    NDN_THROW(std::invalid_argument("Invalid payload size: " + str));
+                }
+                return static_cast<size_t>(size);
+            }
+
+            PayloadDistribution::PayloadDistribution(const std::string &spec, uint32_t seed)
+                : m_kind(FIXED),
+                  m_pSmall(0.0),
+                  m_traceIndex(0),
+                  m_rng(seed)
+            {
+                auto colon = spec.find(':');
+                std::string kind = colon == std::string::npos ? "fixed" : spec.substr(0, colon);
+                std::string args = colon == std::string::npos ? spec : spec.substr(colon + 1);
+
+                if (kind == "fixed")
+                {
+                    m_kind = FIXED;
+                    m_sizes.push_back(parseSize(args));
+                }
+                else if (kind == "uniform")
+                {
+                    m_kind = UNIFORM;
+                    auto dash = args.find('-');
+                    if (dash == std::string::npos)
+                    {
+                        NDN_THROW(std::invalid_argument("Expected uniform:MIN-MAX, got " + spec));
+                    }
+                    size_t min = parseSize(args.substr(0, dash));
+                    size_t max = parseSize(args.substr(dash + 1));
+                    if (min > max)
+                    {
+                        NDN_THROW(std::invalid_argument("Empty payload size range in " + spec));
+                    }
+                    size_t nSizes = std::min(max - min + 1, N_UNIFORM_SIZES);
+                    for (size_t i = 0; i < nSizes; ++i)
+                    {
+                        m_sizes.push_back(nSizes == 1 ? min : min + (max - min) * i / (nSizes - 1));
+                    }
+                }
+                else if (kind == "bimodal")
+                {
+                    m_kind = BIMODAL;
+                    auto comma1 = args.find(',');
+                    auto comma2 = comma1 == std::string::npos ? comma1 : args.find(',', comma1 + 1);
+                    if (comma2 == std::string::npos)
+                    {
+                        NDN_THROW(std::invalid_argument("Expected bimodal:SMALL,LARGE,P, got " + spec));
+                    }
+                    m_sizes.push_back(parseSize(args.substr(0, comma1)));
+                    m_sizes.push_back(parseSize(args.substr(comma1 + 1, comma2 - comma1 - 1)));
+                    try
+                    {
+                        m_pSmall = std::stod(args.substr(comma2 + 1));
+                    }
+                    catch (const std::exception &)
+                    {
+                        m_pSmall = -1.0;
+                    }
+                    if (!(m_pSmall >= 0.0 && m_pSmall <= 1.0))
+                    {
+                        NDN_THROW(std::invalid_argument("Bimodal probability must be in [0, 1] in " + spec));
+                    }
+                }
+                else if (kind == "trace")
+                {
+                    m_kind = TRACE;
+                    std::ifstream is(args);
+                    if (!is)
+                    {
+                        NDN_THROW(std::runtime_error("Cannot open payload size trace " + args));
+                    }
+                    std::string token;
+                    while (is >> token)
+                    {
+                        m_sizes.push_back(parseSize(token));
+                    }
+                    if (m_sizes.empty())
+                    {
+                        NDN_THROW(std::invalid_argument("Payload size trace " + args + " is empty"));
+                    }
+                }
+                else
+                {
+                    NDN_THROW(std::invalid_argument("Unknown payload size distribution: " + kind));
+                }
+            }
+
+            size_t PayloadDistribution::next()
+            {
+                switch (m_kind)
+                {
+                case FIXED:
+                    break;
+                case UNIFORM:
+                    return m_sizes[std::uniform_int_distribution<size_t>(0, m_sizes.size() - 1)(m_rng)];
+                case BIMODAL:
+                    return std::bernoulli_distribution(m_pSmall)(m_rng) ? m_sizes[0] : m_sizes[1];
+                case TRACE:
+                {
+                    size_t size = m_sizes[m_traceIndex];
+                    m_traceIndex = (m_traceIndex + 1) % m_sizes.size();
+                    return size;
+                }
+                }
+                return m_sizes.front();
+            }
+
+            std::vector<size_t> PayloadDistribution::getSupport() const
+            {
+                std::set<size_t> support(m_sizes.begin(), m_sizes.end());
+                return {support.begin(), support.end()};
+            }
+        }
+    }
+}
@@ -0,0 +1,66 @@
+#ifndef CC_SERVER_PAYLOAD_DISTRIBUTION_H
+#define CC_SERVER_PAYLOAD_DISTRIBUTION_H
+#include "core/common.hpp"
+#include <random>
+
+namespace ndn
+{
+    namespace cc
+    {
+        namespace server
+        {
+            /**
+             * @brief Draws the payload size of responses whose Interest carries no Dsz
+             *
+             * Specifications:
+             *  - "fixed:N" or "N": always N octets
+             *  - "uniform:MIN-MAX": uniform over N_UNIFORM_SIZES evenly spaced sizes in [MIN, MAX]
+             *  - "bimodal:SMALL,LARGE,P": SMALL with probability P, LARGE otherwise
+             *  - "trace:FILE": the sizes listed in FILE (whitespace separated), replayed in a loop
+             *
+             * The set of sizes that can be drawn is known up front, so their Content blocks can be
+             * pre-built, and drawing a size never allocates.
+             */
+            class PayloadDistribution
+            {
+            public:
+                static constexpr size_t N_UNIFORM_SIZES = 64;
+
+                /**
+                 * @throw std::invalid_argument malformed specification
+                 * @throw std::runtime_error trace file cannot be read
+                 */
+                explicit PayloadDistribution(const std::string &spec, uint32_t seed = std::random_device{}());
+
+                /**
+                 * @brief Returns the size of the next response
+                 */
+                size_t
+                next();
+
+                /**
+                 * @brief Returns every size next() may return
+                 */
+                std::vector<size_t>
+                getSupport() const;
+
+            private:
+                enum Kind
+                {
+                    FIXED,
+                    UNIFORM,
+                    BIMODAL,
+                    TRACE
+                };
+
+                Kind m_kind;
+                std::vector<size_t> m_sizes; ///< \brief candidate sizes, or the trace for TRACE
+                double m_pSmall;             ///< \brief probability of m_sizes[0] for BIMODAL
+                size_t m_traceIndex;
+                std::mt19937 m_rng;
+            };
+        }
+    }
+}
+
+#endif // CC_SERVER_PAYLOAD_DISTRIBUTION_H
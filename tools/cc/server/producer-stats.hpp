@@ -0,0 +1,159 @@
+#ifndef CC_SERVER_PRODUCER_STATS_H
+#define CC_SERVER_PRODUCER_STATS_H
+#include "core/common.hpp"
+#include <algorithm>
+#include <atomic>
+
+namespace ndn
+{
+    namespace cc
+    {
+        namespace server
+        {
+            /**
+             * @brief Snapshot of producer counters
+             */
+            struct ProducerStats
+            {
+                uint64_t nInterests = 0; //!< Interests received
+                uint64_t nData = 0;      //!< Data packets sent
+                uint64_t nBytes = 0;     //!< Data bytes sent
+                uint64_t nNacks = 0;     //!< Interests rejected with a Congestion Nack
+                uint64_t nMarked = 0;    //!< Data packets sent with a congestion mark
+
+                uint64_t nBatches = 0;                 //!< egress batches written
+                uint64_t nBatchedPackets = 0;          //!< packets written in those batches
+                time::nanoseconds flushLatency = 0_ns; //!< summed delay from first packet queued to batch written
+
+                ProducerStats &
+                operator+=(const ProducerStats &other)
+                {
+                    nInterests += other.nInterests;
+                    nData += other.nData;
+                    nBytes += other.nBytes;
+                    nNacks += other.nNacks;
+                    nMarked += other.nMarked;
+                    nBatches += other.nBatches;
+                    nBatchedPackets += other.nBatchedPackets;
+                    flushLatency += other.flushLatency;
+                    return *this;
+                }
+
+                ProducerStats
+                operator-(const ProducerStats &other) const
+                {
+                    ProducerStats diff;
+                    diff.nInterests = nInterests - other.nInterests;
+                    diff.nData = nData - other.nData;
+                    diff.nBytes = nBytes - other.nBytes;
+                    diff.nNacks = nNacks - other.nNacks;
+                    diff.nMarked = nMarked - other.nMarked;
+                    diff.nBatches = nBatches - other.nBatches;
+                    diff.nBatchedPackets = nBatchedPackets - other.nBatchedPackets;
+                    diff.flushLatency = flushLatency - other.flushLatency;
+                    return diff;
+                }
+            };
+
+            /**
+             * @brief Increments a counter that only one thread writes
+             *
+             * A relaxed load/store pair is enough for a single writer and avoids a locked
+             * read-modify-write; readers on other threads see a recent value.
+             */
+            inline void
+            bumpCounter(std::atomic<uint64_t> &counter, uint64_t n)
+            {
+                counter.store(counter.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+            }
+
+            /**
+             * @brief Counters of one producer, readable from any thread without locking
+             *
+             * Only the thread running the producer writes the counters.
+             */
+            class ProducerCounters : noncopyable
+            {
+            public:
+                void
+                onInterest()
+                {
+                    bumpCounter(m_nInterests, 1);
+                }
+
+                void
+                onData(size_t size)
+                {
+                    bumpCounter(m_nData, 1);
+                    bumpCounter(m_nBytes, size);
+                }
+
+                void
+                onNack()
+                {
+                    bumpCounter(m_nNacks, 1);
+                }
+
+                void
+                onMarked()
+                {
+                    bumpCounter(m_nMarked, 1);
+                }
+
+                ProducerStats
+                snapshot() const
+                {
+                    ProducerStats stats;
+                    stats.nInterests = m_nInterests.load(std::memory_order_relaxed);
+                    stats.nData = m_nData.load(std::memory_order_relaxed);
+                    stats.nBytes = m_nBytes.load(std::memory_order_relaxed);
+                    stats.nNacks = m_nNacks.load(std::memory_order_relaxed);
+                    stats.nMarked = m_nMarked.load(std::memory_order_relaxed);
+                    return stats;
+                }
+
+            private:
+                std::atomic<uint64_t> m_nInterests{0};
+                std::atomic<uint64_t> m_nData{0};
+                std::atomic<uint64_t> m_nBytes{0};
+                std::atomic<uint64_t> m_nNacks{0};
+                std::atomic<uint64_t> m_nMarked{0};
+            };
+
+            /**
+             * @brief Counters of a batching egress, readable from any thread without locking
+             *
+             * Only the thread running the transport writes the counters.
+             */
+            class EgressCounters : noncopyable
+            {
+            public:
+                void
+                onFlush(size_t nPackets, time::nanoseconds latency)
+                {
+                    bumpCounter(m_nBatches, 1);
+                    bumpCounter(m_nPackets, nPackets);
+                    bumpCounter(m_latencyNs, static_cast<uint64_t>(std::max<time::nanoseconds::rep>(latency.count(), 0)));
+                }
+
+                /**
+                 * @brief Fills the egress fields of @p stats
+                 */
+                void
+                snapshot(ProducerStats &stats) const
+                {
+                    stats.nBatches = m_nBatches.load(std::memory_order_relaxed);
+                    stats.nBatchedPackets = m_nPackets.load(std::memory_order_relaxed);
+                    stats.flushLatency = time::nanoseconds(m_latencyNs.load(std::memory_order_relaxed));
+                }
+
+            private:
+                std::atomic<uint64_t> m_nBatches{0};
+                std::atomic<uint64_t> m_nPackets{0};
+                std::atomic<uint64_t> m_latencyNs{0};
+            };
+        }
+    }
+}
+
+#endif // CC_SERVER_PRODUCER_STATS_H
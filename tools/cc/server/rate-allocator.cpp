@@ -0,0 +1,232 @@
+#include "rate-allocator.hpp"
+#include <algorithm>
+
+namespace ndn
+{
+    namespace cc
+    {
+        namespace server
+        {
+            constexpr size_t SlidingWindowCounter::N_BUCKETS;
+            constexpr size_t RateAllocator::N_CLASSES;
+            constexpr size_t RateAllocator::N_PROBES;
+
+            void SlidingWindowCounter::advance(uint64_t bucket)
+            {
+                if (bucket <= m_lastBucket)
+                {
+                    return;
+                }
+                if (bucket - m_lastBucket >= N_BUCKETS)
+                {
+                    m_buckets.fill(0);
+                    m_total = 0;
+                }
+                else
+                {
+                    for (uint64_t b = m_lastBucket + 1; b <= bucket; ++b)
+                    {
+                        auto &slot = m_buckets[b % N_BUCKETS];
+                        m_total -= slot;
+                        slot = 0;
+                    }
+                }
+                m_lastBucket = bucket;
+            }
+
+            void SlidingWindowCounter::add(uint64_t bucket, uint64_t bytes)
+            {
+                advance(bucket);
+                m_buckets[bucket % N_BUCKETS] += bytes;
+                m_total += bytes;
+            }
+
+            uint64_t SlidingWindowCounter::getTotal(uint64_t bucket)
+            {
+                advance(bucket);
+                return m_total;
+            }
+
+            RateAllocator::RateAllocator(uint64_t capacity, time::nanoseconds window, Policy policy,
+                                         const std::map<int, double> &classWeights, size_t nFlowSlots)
+                : m_capacity(capacity),
+                  m_bucketDuration(std::max<time::nanoseconds>(window / SlidingWindowCounter::N_BUCKETS, 1_ns)),
+                  m_bucketSeconds(m_bucketDuration.count() / 1e9),
+                  m_policy(policy),
+                  m_classWeights(classWeights),
+                  m_lastAllocation(0),
+                  m_fairLevel(static_cast<double>(capacity)),
+                  m_nActiveFlows(0)
+            {
+                size_t size = 1;
+                while (size < nFlowSlots)
+                {
+                    size <<= 1;
+                }
+                m_flows.resize(size);
+                m_flowMask = size - 1;
+            }
+
+            uint64_t RateAllocator::getBucket(time::steady_clock::TimePoint now) const
+            {
+                return time::duration_cast<time::nanoseconds>(now.time_since_epoch()).count() /
+                       m_bucketDuration.count();
+            }
+
+            double RateAllocator::getWeight(int serviceClass) const
+            {
+                if (m_policy == MAX_MIN)
+                {
+                    return 1.0;
+                }
+                auto it = m_classWeights.find(serviceClass);
+                return it == m_classWeights.end() ? 1.0 : it->second;
+            }
+
+            RateAllocator::Flow &RateAllocator::findFlow(uint64_t key, uint64_t bucket)
+            {
+                size_t home = key & m_flowMask;
+                // the flow may sit past a slot freed since it was inserted, so look for it first
+                Flow *freeSlot = nullptr;
+                for (size_t i = 0; i < N_PROBES; ++i)
+                {
+                    Flow &flow = m_flows[(home + i) & m_flowMask];
+                    if (flow.isUsed && flow.key == key)
+                    {
+                        return flow;
+                    }
+                    if (freeSlot == nullptr && (!flow.isUsed || flow.counter.getTotal(bucket) == 0))
+                    {
+                        freeSlot = &flow;
+                    }
+                }
+                if (freeSlot == nullptr)
+                {
+                    return m_flows[home];
+                }
+                // free or idle for a whole window: (re)claim it
+                *freeSlot = Flow();
+                freeSlot->key = key;
+                freeSlot->isUsed = true;
+                return *freeSlot;
+            }
+
+            uint64_t RateAllocator::onInterest(uint64_t key, int serviceClass, uint64_t bytes,
+                                               time::steady_clock::TimePoint now)
+            {
+                uint64_t bucket = getBucket(now);
+                if (bucket != m_lastAllocation)
+                {
+                    reallocate(bucket);
+                }
+
+                if (serviceClass >= 0 && static_cast<size_t>(serviceClass) < N_CLASSES)
+                {
+                    m_classes[serviceClass].add(bucket, bytes);
+                }
+
+                Flow &flow = findFlow(key, bucket);
+                bool isNew = flow.counter.getTotal(bucket) == 0;
+                flow.counter.add(bucket, bytes);
+                if (isNew)
+                {
+                    // not part of the last allocation yet, start at the fair level
+                    flow.weight = getWeight(serviceClass);
+                    flow.targetRate = static_cast<uint64_t>(m_fairLevel * flow.weight);
+                }
+                return flow.targetRate;
+            }
+
+            double RateAllocator::getClassRate(int serviceClass, time::steady_clock::TimePoint now)
+            {
+                if (serviceClass < 0 || static_cast<size_t>(serviceClass) >= N_CLASSES)
+                {
+                    return 0.0;
+                }
+                // the current bucket is only partially elapsed
+                uint64_t bucket = getBucket(now);
+                auto elapsed = time::duration_cast<time::nanoseconds>(now.time_since_epoch()).count() -
+                               bucket * m_bucketDuration.count();
+                double seconds = (SlidingWindowCounter::N_BUCKETS - 1) * m_bucketSeconds + elapsed / 1e9;
+                return m_classes[serviceClass].getTotal(bucket) / seconds;
+            }
+
+            void RateAllocator::reallocate(uint64_t bucket)
+            {
+                m_lastAllocation = bucket;
+
+                struct Demand
+                {
+                    Flow *flow;
+                    double rate;
+                };
+                // called as @p bucket begins, so the window holds N_BUCKETS - 1 complete buckets
+                const double windowSeconds = (SlidingWindowCounter::N_BUCKETS - 1) * m_bucketSeconds;
+                std::vector<Demand> demands;
+                double totalWeight = 0.0;
+                for (auto &flow : m_flows)
+                {
+                    if (!flow.isUsed)
+                    {
+                        continue;
+                    }
+                    uint64_t total = flow.counter.getTotal(bucket);
+                    if (total == 0)
+                    {
+                        continue;
+                    }
+                    demands.push_back({&flow, total / windowSeconds});
+                    totalWeight += flow.weight;
+                }
+                m_nActiveFlows = demands.size();
+
+                if (demands.empty())
+                {
+                    m_fairLevel = static_cast<double>(m_capacity);
+                    return;
+                }
+
+                // water-filling: satisfy flows in increasing order of demand per unit of weight
+                // until the remaining capacity, split by weight, no longer covers the next one
+                std::sort(demands.begin(), demands.end(),
+                          [](const Demand &a, const Demand &b)
+                          { return a.rate / a.flow->weight < b.rate / b.flow->weight; });
+
+                double remainingCapacity = static_cast<double>(m_capacity);
+                double remainingWeight = totalWeight;
+                double level = -1.0;
+                for (const auto &demand : demands)
+                {
+                    double share = remainingCapacity / remainingWeight;
+                    if (demand.rate / demand.flow->weight > share)
+                    {
+                        level = share;
+                        break;
+                    }
+                    remainingCapacity -= demand.rate;
+                    remainingWeight -= demand.flow->weight;
+                }
+
+                if (level < 0)
+                {
+                    // every demand fits: each flow may grow by its weighted part of the spare capacity,
+                    // so that the target rates add up to the capacity
+                    double spareLevel = std::max(remainingCapacity, 0.0) / totalWeight;
+                    // a new flow starts at its spare share, or at its equal share when little is spare
+                    m_fairLevel = std::max(spareLevel, m_capacity / (totalWeight + 1.0));
+                    for (const auto &demand : demands)
+                    {
+                        demand.flow->targetRate = static_cast<uint64_t>(demand.rate + spareLevel * demand.flow->weight);
+                    }
+                    return;
+                }
+
+                m_fairLevel = level;
+                for (const auto &demand : demands)
+                {
+                    demand.flow->targetRate = static_cast<uint64_t>(level * demand.flow->weight);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,146 @@
+#ifndef CC_SERVER_RATE_ALLOCATOR_H
+#define CC_SERVER_RATE_ALLOCATOR_H
+#include "core/common.hpp"
+#include <array>
+
+namespace ndn
+{
+    namespace cc
+    {
+        namespace server
+        {
+            /**
+             * @brief Byte count over a sliding window of fixed-duration buckets
+             *
+             * The window is advanced lazily by the caller-supplied bucket index, so adding a
+             * sample or reading the total touches at most N_BUCKETS buckets.
+             */
+            class SlidingWindowCounter
+            {
+            public:
+                static constexpr size_t N_BUCKETS = 10;
+
+                void
+                add(uint64_t bucket, uint64_t bytes);
+
+                /**
+                 * @brief Returns the bytes counted in the last N_BUCKETS buckets up to @p bucket
+                 */
+                uint64_t
+                getTotal(uint64_t bucket);
+
+            private:
+                void
+                advance(uint64_t bucket);
+
+            private:
+                std::array<uint64_t, N_BUCKETS> m_buckets{};
+                uint64_t m_lastBucket = 0;
+                uint64_t m_total = 0;
+            };
+
+            /**
+             * @brief Computes the TargetRate stamped into Data packets
+             *
+             * Arrival rates are tracked per ServiceClass and per flow (a consumer, identified by
+             * the caller through a hash) over a sliding window. Whenever the window advances by one
+             * bucket the allocator runs a weighted max-min (water-filling) allocation of the egress
+             * capacity over the active flows; every Interest in between only updates counters and
+             * reads the cached share of its flow, which keeps the per-Interest cost O(1).
+             *
+             * Flows live in a fixed-size table. A flow whose slot and probe sequence are all taken by
+             * other active flows shares the home slot with its occupant.
+             *
+             * All rates are in bytes per second.
+             */
+            class RateAllocator : noncopyable
+            {
+            public:
+                enum Policy
+                {
+                    MAX_MIN, //!< every flow weighs the same
+                    WEIGHTED //!< flows are weighted by their ServiceClass weight
+                };
+
+                /**
+                 * @param capacity egress capacity to share, in bytes per second
+                 * @param window duration of the sliding window
+                 * @param policy allocation policy
+                 * @param classWeights weight of each ServiceClass, 1 for classes not listed
+                 * @param nFlowSlots size of the flow table, rounded up to a power of two
+                 */
+                RateAllocator(uint64_t capacity, time::nanoseconds window, Policy policy,
+                              const std::map<int, double> &classWeights, size_t nFlowSlots = 1024);
+
+                /**
+                 * @brief Accounts for an Interest and returns the target rate of its flow
+                 *
+                 * @param flow hash identifying the consumer
+                 * @param serviceClass ServiceClass of the Interest (-1 if absent)
+                 * @param bytes bytes that will be sent in response
+                 */
+                uint64_t
+                onInterest(uint64_t flow, int serviceClass, uint64_t bytes,
+                           time::steady_clock::TimePoint now = time::steady_clock::now());
+
+                /**
+                 * @brief Returns the arrival rate of @p serviceClass over the window
+                 */
+                double
+                getClassRate(int serviceClass, time::steady_clock::TimePoint now = time::steady_clock::now());
+
+                /**
+                 * @brief Returns the number of flows that took part in the last allocation
+                 */
+                size_t
+                getNActiveFlows() const
+                {
+                    return m_nActiveFlows;
+                }
+
+            private:
+                struct Flow
+                {
+                    uint64_t key = 0;
+                    bool isUsed = false;
+                    double weight = 1.0;
+                    uint64_t targetRate = 0;
+                    SlidingWindowCounter counter;
+                };
+
+                Flow &
+                findFlow(uint64_t key, uint64_t bucket);
+
+                double
+                getWeight(int serviceClass) const;
+
+                void
+                reallocate(uint64_t bucket);
+
+                uint64_t
+                getBucket(time::steady_clock::TimePoint now) const;
+
+            public:
+                static constexpr size_t N_CLASSES = 256; //!< ServiceClass values tracked separately
+                static constexpr size_t N_PROBES = 4;
+
+            private:
+                uint64_t m_capacity;
+                time::nanoseconds m_bucketDuration;
+                double m_bucketSeconds;
+                Policy m_policy;
+                std::map<int, double> m_classWeights;
+
+                std::vector<Flow> m_flows;
+                size_t m_flowMask;
+                std::array<SlidingWindowCounter, N_CLASSES> m_classes;
+
+                uint64_t m_lastAllocation;
+                double m_fairLevel; ///< \brief rate per unit of weight granted to unconstrained flows
+                size_t m_nActiveFlows;
+            };
+        }
+    }
+}
+
+#endif // CC_SERVER_RATE_ALLOCATOR_H
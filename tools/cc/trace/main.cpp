@@ -0,0 +1,124 @@
+#include "core/common.hpp"
+#include "core/version.hpp"
+#include "tools/cc/common/trace-writer.hpp"
+
+#include <fstream>
+#include <iostream>
+
+namespace ndn
+{
+    namespace cc
+    {
+        namespace trace
+        {
+            static void
+            usage(const boost::program_options::options_description &options)
+            {
+                std::cout << "Usage: cc-trace [options] TRACE-FILE\n"
+                             "\n"
+                             "Convert a binary trace written by qsccp-client, pcon-client or bbr-client\n"
+                             "with --trace back into the text lines they print, or into CSV.\n"
+                             "\n"
+                          << options;
+                exit(2);
+            }
+
+            static int
+            main(int argc, char *argv[])
+            {
+                std::string formatName;
+
+                namespace po = boost::program_options;
+
+                po::options_description visibleOptDesc("Options");
+                visibleOptDesc.add_options()("help,h", "print this message and exit")("version,V", "display version and exit");
+                visibleOptDesc.add_options()(
+                    "format,f", po::value<std::string>(&formatName)->default_value("text"), "output format, text or csv");
+
+                po::options_description hiddenOptDesc;
+                hiddenOptDesc.add_options()("file", po::value<std::string>(), "trace file to convert");
+
+                po::options_description optDesc;
+                optDesc.add(visibleOptDesc).add(hiddenOptDesc);
+
+                po::positional_options_description optPos;
+                optPos.add("file", -1);
+
+                std::string file;
+                TraceFormat format = TraceFormat::TEXT;
+                try
+                {
+                    po::variables_map optVm;
+                    po::store(po::command_line_parser(argc, argv).options(optDesc).positional(optPos).run(), optVm);
+                    po::notify(optVm);
+
+                    if (optVm.count("help") > 0)
+                    {
+                        usage(visibleOptDesc);
+                    }
+
+                    if (optVm.count("version") > 0)
+                    {
+                        std::cout << "cc-trace " << tools::VERSION << std::endl;
+                        exit(0);
+                    }
+
+                    if (optVm.count("file") > 0)
+                    {
+                        file = optVm["file"].as<std::string>();
+                    }
+                    else
+                    {
+                        std::cerr << "ERROR: No trace file specified" << std::endl;
+                        usage(visibleOptDesc);
+                    }
+
+                    if (formatName == "csv")
+                    {
+                        format = TraceFormat::CSV;
+                    }
+                    else if (formatName != "text")
+                    {
+                        std::cerr << "ERROR: Unknown format " << formatName << std::endl;
+                        usage(visibleOptDesc);
+                    }
+                }
+                catch (const po::error &e)
+                {
+                    std::cerr << "ERROR: " << e.what() << std::endl;
+                    usage(visibleOptDesc);
+                }
+
+                std::ifstream is(file, std::ios::binary);
+                if (!is)
+                {
+                    std::cerr << "ERROR: Cannot open " << file << std::endl;
+                    return 2;
+                }
+
+                try
+                {
+                    TraceReader reader(is);
+                    printTraceHeader(std::cout, format);
+                    TraceRecord record;
+                    while (reader.read(record))
+                    {
+                        printTraceRecord(std::cout, record, format);
+                    }
+                }
+                catch (const std::runtime_error &e)
+                {
+                    std::cout.flush();
+                    std::cerr << "ERROR: " << e.what() << std::endl;
+                    return 1;
+                }
+                return 0;
+            }
+        }
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    return ndn::cc::trace::main(argc, argv);
+}
@@ -86,6 +86,9 @@ main(int argc, char* argv[])
     ("disable-cwa",  po::bool_switch(&options.disableCwa),
                      "disable Conservative Window Adaptation, i.e., reduce the window on "
                      "each timeout or congestion mark instead of at most once per RTT")
+    ("hystart",      po::bool_switch(&options.enableHyStart),
+                     "end slow start when the RTT increases or the Data arrive as an ACK train "
+                     "(HyStart), instead of at the first timeout or congestion mark")
     ("reset-cwnd-to-init", po::bool_switch(&options.resetCwndToInit),
                            "after a timeout or congestion mark, reset the window "
                            "to the initial value instead of resetting to ssthresh")
@@ -51,6 +51,7 @@ struct Options : noncopyable
   time::milliseconds rtoCheckInterval{10}; ///< interval for checking retransmission timer
   bool ignoreCongMarks = false; ///< disable window decrease after receiving congestion mark
   bool disableCwa = false;      ///< disable conservative window adaptation
+  bool enableHyStart = false;   ///< end slow start on an RTT increase or ACK train (HyStart)
 
   // AIMD pipeline options
   double aiStep = 1.0;          ///< AIMD additive increase step (in segments)
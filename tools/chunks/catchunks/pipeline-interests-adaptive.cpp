@@ -44,6 +44,7 @@ PipelineInterestsAdaptive::PipelineInterestsAdaptive(Face& face,
   , m_cwnd(m_options.initCwnd)
   , m_ssthresh(m_options.initSsthresh)
   , m_rttEstimator(rttEstimator)
+  , m_hyStart(HyStart::Options())
   , m_scheduler(m_face.getIoService())
   , m_highData(0)
   , m_highInterest(0)
@@ -235,7 +236,8 @@ PipelineInterestsAdaptive::handleData(const Interest& interest, const Data& data
   }
 
   SegmentInfo& segInfo = segIt->second;
-  time::nanoseconds rtt = time::steady_clock::now() - segInfo.timeSent;
+  auto now = time::steady_clock::now();
+  time::nanoseconds rtt = now - segInfo.timeSent;
   if (m_options.isVerbose) {
     std::cerr << "Received segment #" << recvSegNo
               << ", rtt=" << rtt.count() / 1e6 << "ms"
@@ -246,6 +248,16 @@ PipelineInterestsAdaptive::handleData(const Interest& interest, const Data& data
     m_highData = recvSegNo;
   }
 
+  // same RTT samples as the estimator: segments requested only once
+  bool isRttSample = (segInfo.state == SegmentState::FirstTimeSent ||
+                      segInfo.state == SegmentState::InRetxQueue) &&
+                     m_retxCount.count(recvSegNo) == 0;
+
+  if (m_options.enableHyStart && m_cwnd < m_ssthresh && isRttSample &&
+      m_hyStart.onData(now, recvSegNo, m_highInterest, rtt, m_cwnd)) {
+    exitSlowStart();
+  }
+
   // for segments in retx queue, we must not decrement m_nInFlight
   // because it was already decremented when the segment timed out
   if (segInfo.state != SegmentState::InRetxQueue) {
@@ -262,6 +274,7 @@ PipelineInterestsAdaptive::handleData(const Interest& interest, const Data& data
                                       // per RTT (conservative window adaptation)
         m_nMarkDecr++;
         decreaseWindow();
+        m_hyStart.reset();
 
         if (m_options.isVerbose) {
           std::cerr << "Received congestion mark, value = " << data.getCongestionMark()
@@ -280,9 +293,7 @@ PipelineInterestsAdaptive::handleData(const Interest& interest, const Data& data
   onData(data);
 
   // do not sample RTT for retransmitted segments
-  if ((segInfo.state == SegmentState::FirstTimeSent ||
-       segInfo.state == SegmentState::InRetxQueue) &&
-      m_retxCount.count(recvSegNo) == 0) {
+  if (isRttSample) {
     auto nExpectedSamples = std::max<int64_t>((m_nInFlight + 1) >> 1, 1);
     BOOST_ASSERT(nExpectedSamples > 0);
     m_rttEstimator.addMeasurement(rtt, static_cast<size_t>(nExpectedSamples));
@@ -347,6 +358,17 @@ PipelineInterestsAdaptive::handleLifetimeExpiration(const Interest& interest)
   schedulePackets();
 }
 
+void
+PipelineInterestsAdaptive::exitSlowStart()
+{
+  m_ssthresh = m_cwnd;
+
+  if (m_options.isVerbose) {
+    std::cerr << "Slow start ended by " << m_hyStart.getLastExit()
+              << ", ssthresh = " << m_ssthresh << std::endl;
+  }
+}
+
 void
 PipelineInterestsAdaptive::recordTimeout()
 {
@@ -355,6 +377,7 @@ PipelineInterestsAdaptive::recordTimeout()
     m_recPoint = m_highInterest;
 
     decreaseWindow();
+    m_hyStart.reset();
     m_rttEstimator.backoffRto();
     m_nLossDecr++;
 
@@ -427,6 +450,7 @@ PipelineInterestsAdaptive::printOptions() const
       << "\tRTO check interval = " << m_options.rtoCheckInterval << "\n"
       << "\tReact to congestion marks = " << (m_options.ignoreCongMarks ? "no" : "yes") << "\n"
       << "\tConservative window adaptation = " << (m_options.disableCwa ? "no" : "yes") << "\n"
+      << "\tHyStart = " << (m_options.enableHyStart ? "yes" : "no") << "\n"
       << "\tResetting window to " << (m_options.resetCwndToInit ?
                                         "initial value" : "ssthresh") << " upon loss event\n";
 }
@@ -439,8 +463,12 @@ PipelineInterestsAdaptive::printSummary() const
             << "Timeouts: " << m_nTimeouts << " (caused " << m_nLossDecr << " window decreases)\n"
             << "Retransmitted segments: " << m_nRetransmitted
             << " (" << (m_nSent == 0 ? 0 : (m_nRetransmitted * 100.0 / m_nSent)) << "%)"
-            << ", skipped: " << m_nSkippedRetx << "\n"
-            << "RTT ";
+            << ", skipped: " << m_nSkippedRetx << "\n";
+  if (m_hyStart.getLastExit() != HyStart::NONE) {
+    std::cerr << "Slow start ended by HyStart (" << m_hyStart.getLastExit() << ") at cwnd "
+              << m_hyStart.getExitWindow() << "\n";
+  }
+  std::cerr << "RTT ";
 
   if (m_rttEstimator.getMinRtt() == time::nanoseconds::max() ||
       m_rttEstimator.getMaxRtt() == time::nanoseconds::min()) {
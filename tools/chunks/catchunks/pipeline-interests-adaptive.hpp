@@ -31,6 +31,8 @@
 
 #include "pipeline-interests.hpp"
 
+#include "core/hystart.hpp"
+
 #include <ndn-cxx/util/rtt-estimator.hpp>
 
 #include <queue>
@@ -116,6 +118,12 @@ protected:
   void
   printOptions() const;
 
+  /**
+   * @brief End slow start at the current window, on a HyStart detection.
+   */
+  virtual void
+  exitSlowStart();
+
 private:
   /**
    * @brief Increase congestion window.
@@ -193,6 +201,7 @@ PUBLIC_WITH_TESTS_ELSE_PROTECTED:
   double m_cwnd; ///< current congestion window size (in segments)
   double m_ssthresh; ///< current slow start threshold
   RttEstimatorWithStats& m_rttEstimator;
+  HyStart m_hyStart;
 
 PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   Scheduler m_scheduler;
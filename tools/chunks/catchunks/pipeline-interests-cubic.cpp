@@ -57,20 +57,16 @@ PipelineInterestsCubic::increaseWindow()
     // if m_ssthresh is large enough.
     if (m_wmax < m_options.initCwnd) {
       m_wmax = m_cwnd;
+      m_k = std::cbrt(m_wmax * (1 - m_options.cubicBeta) / CUBIC_C);
     }
 
     // 1. Time since last congestion event in seconds
     const double t = (time::steady_clock::now() - m_lastDecrease).count() / 1e9;
 
-    // 2. Time it takes to increase the window to m_wmax = the cwnd right before the last
-    // window decrease.
-    // K = cubic_root(wmax*(1-beta_cubic)/C) (Eq. 2)
-    const double k = std::cbrt(m_wmax * (1 - m_options.cubicBeta) / CUBIC_C);
+    // 2. Target: W_cubic(t) = C*(t-K)^3 + wmax (Eq. 1), with K computed on the last decrease
+    const double wCubic = CUBIC_C * std::pow(t - m_k, 3) + m_wmax;
 
-    // 3. Target: W_cubic(t) = C*(t-K)^3 + wmax (Eq. 1)
-    const double wCubic = CUBIC_C * std::pow(t - k, 3) + m_wmax;
-
-    // 4. Estimate of Reno Increase (Eq. 4)
+    // 3. Estimate of Reno Increase (Eq. 4)
     const double rtt = m_rttEstimator.getSmoothedRtt().count() / 1e9;
     const double wEst = m_wmax * m_options.cubicBeta +
                         (3 * (1 - m_options.cubicBeta) / (1 + m_options.cubicBeta)) * (t / rtt);
@@ -104,6 +100,11 @@ PipelineInterestsCubic::decreaseWindow()
     m_wmax = m_cwnd;
   }
 
+  // Time it takes to increase the window to m_wmax = the cwnd right before the
+  // window decrease.
+  // K = cubic_root(wmax*(1-beta_cubic)/C) (Eq. 2)
+  m_k = std::cbrt(m_wmax * (1 - m_options.cubicBeta) / CUBIC_C);
+
   m_ssthresh = std::max(m_options.initCwnd, m_cwnd * m_options.cubicBeta);
   m_cwnd = m_ssthresh;
   m_lastDecrease = time::steady_clock::now();
@@ -111,5 +112,17 @@ PipelineInterestsCubic::decreaseWindow()
   emitSignal(afterCwndChange, time::steady_clock::now() - getStartTime(), m_cwnd);
 }
 
+void
+PipelineInterestsCubic::exitSlowStart()
+{
+  PipelineInterestsAdaptive::exitSlowStart();
+
+  // No decrease happened: the window grows from the current cwnd as from the plateau
+  // (K = 0), like tcp_cubic starting an epoch above the last wmax.
+  m_wmax = m_cwnd;
+  m_k = 0.0;
+  m_lastDecrease = time::steady_clock::now();
+}
+
 } // namespace chunks
 } // namespace ndn
@@ -49,9 +49,13 @@ private:
   void
   decreaseWindow() final;
 
-private:
+  void
+  exitSlowStart() final;
+
+PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   double m_wmax = 0.0; ///< window size before last window decrease
   double m_lastWmax = 0.0; ///< last wmax
+  double m_k = 0.0; ///< time to increase the window to wmax after the last decrease, in seconds
   time::steady_clock::TimePoint m_lastDecrease; ///< time of last window decrease
 };
 
@@ -22,6 +22,8 @@
 
 #include "ping-server.hpp"
 
+#include "core/payload-pool.hpp"
+
 #include <ndn-cxx/security/signing-helpers.hpp>
 
 namespace ndn {
@@ -33,10 +35,8 @@ PingServer::PingServer(Face& face, KeyChain& keyChain, const Options& options)
   , m_face(face)
   , m_keyChain(keyChain)
   , m_nPings(0)
+  , m_payload(getPayloadPool().getFilled(m_options.payloadSize))
 {
-  auto b = make_shared<Buffer>();
-  b->assign(m_options.payloadSize, 'a');
-  m_payload = Block(tlv::Content, std::move(b));
 }
 
 void